@@ -39,6 +39,7 @@ private:
 protected:
 
 public:
+	const void *currentMethod; /**< Method dictionary key of the method this thread is running (its top-most stack frame), NULL if none */
 
 	/* Function members */
 private:
@@ -46,7 +47,9 @@ private:
 protected:
 
 public:
-	GC_Environment() {}
+	GC_Environment()
+		: currentMethod(NULL)
+	{}
 };
 
 /***
@@ -163,6 +166,20 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return true; }
 
+	/**
+	 * Return the site of the allocation this thread is performing, when allocation-site sampling is enabled
+	 * (see MM_GCExtensionsBase::allocationSiteSamplingBytesGranularity). This is called for sampled allocations only.
+	 *
+	 * The site should be the key of the allocating method in the method dictionary (see
+	 * ex_omr_insertMethodEntryInMethodDictionary() in Profiling.c), typically the method of the top-most
+	 * frame found by the same stack walk used by ex_omr_sampleStack(), so that reported sites can be resolved
+	 * with the method profiler's dictionary.
+	 *
+	 * This example has no interpreter, so the code driving the thread records the method it is running
+	 * in GC_Environment::currentMethod, and that method is the site.
+	 */
+	const void *getAllocationSite() { return _gcEnv.currentMethod; }
+
 	/**
 	 * Acquire shared VM access. Threads must acquire VM access before accessing any OMR internal
 	 * structures such as the heap. Requests for VM access will be blocked if any other thread is
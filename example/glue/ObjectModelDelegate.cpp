@@ -38,6 +38,73 @@ GC_ObjectModelDelegate::initializeAllocation(MM_EnvironmentBase *env, void *allo
 	return objectPtr;
 }
 
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
+void
+GC_ObjectModelDelegate::sampleHotFieldReference(omrobjectptr_t objectPtr, uintptr_t slotOffset)
+{
+	if (slotOffset < _hotFieldTrackedSlots) {
+		uintptr_t objectSize = getObjectSizeInBytesWithHeader(objectPtr);
+		HotFieldTableEntry *entry = &_hotFieldTable[getHotFieldTableIndex(objectSize)];
+		if (objectSize != entry->objectSize) {
+			resetHotFieldTableEntry(entry, objectSize);
+		}
+
+		entry->sampleCounts[slotOffset] += 1;
+		if (_hotFieldSampleCountMaximum <= entry->sampleCounts[slotOffset]) {
+			/* age all samples for this shape so the ranking can follow changes in the object graph */
+			for (uintptr_t slot = 0; slot < _hotFieldTrackedSlots; slot++) {
+				entry->sampleCounts[slot] >>= 1;
+			}
+		}
+		rankHotFields(entry);
+	}
+}
+
+void
+GC_ObjectModelDelegate::resetHotFieldTableEntry(HotFieldTableEntry *entry, uintptr_t objectSize)
+{
+	for (uintptr_t slot = 0; slot < _hotFieldTrackedSlots; slot++) {
+		entry->sampleCounts[slot] = 0;
+	}
+	for (uintptr_t rank = 0; rank < _hotFieldRankedSlots; rank++) {
+		entry->hotFieldOffsets[rank] = U_8_MAX;
+	}
+	entry->objectSize = objectSize;
+}
+
+void
+GC_ObjectModelDelegate::rankHotFields(HotFieldTableEntry *entry)
+{
+	/* insertion sort of the sampled slots by descending count, keeping only the top _hotFieldRankedSlots */
+	uint32_t rankedCounts[_hotFieldRankedSlots];
+	uint8_t rankedOffsets[_hotFieldRankedSlots];
+	uintptr_t rankedCount = 0;
+	for (uintptr_t slot = 0; slot < _hotFieldTrackedSlots; slot++) {
+		uint32_t count = entry->sampleCounts[slot];
+		if (0 != count) {
+			uintptr_t position = rankedCount;
+			while ((0 < position) && (rankedCounts[position - 1] < count)) {
+				if (position < _hotFieldRankedSlots) {
+					rankedCounts[position] = rankedCounts[position - 1];
+					rankedOffsets[position] = rankedOffsets[position - 1];
+				}
+				position -= 1;
+			}
+			if (position < _hotFieldRankedSlots) {
+				rankedCounts[position] = count;
+				rankedOffsets[position] = (uint8_t)slot;
+				if (rankedCount < _hotFieldRankedSlots) {
+					rankedCount += 1;
+				}
+			}
+		}
+	}
+	for (uintptr_t rank = 0; rank < _hotFieldRankedSlots; rank++) {
+		entry->hotFieldOffsets[rank] = (rank < rankedCount) ? rankedOffsets[rank] : U_8_MAX;
+	}
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 void
 GC_ObjectModelDelegate::calculateObjectDetailsForCopy(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, uintptr_t *objectCopySizeInBytes, uintptr_t *reservedObjectSizeInBytes, uintptr_t *hotFieldAlignmentDescriptor)
@@ -59,6 +59,27 @@ private:
 	static const uintptr_t _objectHeaderSlotFlagsShift = 0;
 	static const uintptr_t _objectHeaderSlotSizeShift = 8;
 
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
+	/**
+	 * Example objects have no class, so hot field samples are aggregated per object shape (size in bytes).
+	 * Shapes hash into a small direct-mapped table and a colliding shape evicts the previous occupant.
+	 * Parallel GC threads update entries without synchronization: samples may be lost and a ranking may
+	 * briefly mix two shapes, so readers bound every offset by the size of the object at hand.
+	 */
+	static const uintptr_t _hotFieldTableSize = 64;
+	static const uintptr_t _hotFieldTrackedSlots = 16;
+	static const uintptr_t _hotFieldRankedSlots = 8;
+	static const uint32_t _hotFieldSampleCountMaximum = 1 << 16;
+
+	struct HotFieldTableEntry {
+		uintptr_t objectSize; /**< shape key (object size in bytes), 0 if the entry is unused */
+		uint32_t sampleCounts[_hotFieldTrackedSlots]; /**< sampled child copies per slot offset */
+		uint8_t hotFieldOffsets[_hotFieldRankedSlots]; /**< slot offsets ranked by sample count, U_8_MAX terminated */
+	};
+
+	HotFieldTableEntry _hotFieldTable[_hotFieldTableSize];
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
+
 protected:
 public:
 
@@ -221,6 +242,46 @@ public:
 	{
 		return U_8_MAX;
 	}
+
+	/**
+	 * Get the hottest sampled reference slots for objects shaped like the object referred to by the forwarded header,
+	 * hottest first. Valid if scavenger hot field co-location is enabled (-Xgc:hotFieldCoLocation=).
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @param[out] offsets receives slot offsets (in slots, relative to the object address) of the hot fields
+	 * @param maxOffsets maximum number of offsets to return
+	 * @return the number of offsets returned
+	 */
+	MMINLINE uintptr_t
+	getCoLocatedHotFieldOffsets(MM_ForwardedHeader *forwardedHeader, uint8_t *offsets, uintptr_t maxOffsets)
+	{
+		ObjectHeader header(forwardedHeader->getPreservedSlot());
+		uintptr_t objectSize = header.sizeInBytes();
+		HotFieldTableEntry *entry = &_hotFieldTable[getHotFieldTableIndex(objectSize)];
+		uintptr_t count = 0;
+		if (objectSize == entry->objectSize) {
+			uintptr_t slotCount = objectSize / sizeof(fomrobject_t);
+			uintptr_t limit = (maxOffsets < _hotFieldRankedSlots) ? maxOffsets : _hotFieldRankedSlots;
+			while (count < limit) {
+				uint8_t offset = entry->hotFieldOffsets[count];
+				if ((U_8_MAX == offset) || (offset >= slotCount)) {
+					break;
+				}
+				offsets[count] = offset;
+				count += 1;
+			}
+		}
+		return count;
+	}
+
+	/**
+	 * Record a sampled parent->child reference whose child was copied while the parent was scanned. The
+	 * samples feed the ranking returned by getCoLocatedHotFieldOffsets().
+	 *
+	 * @param objectPtr the parent object (already copied)
+	 * @param slotOffset offset of the referencing slot (in slots, relative to the object address)
+	 */
+	void sampleHotFieldReference(omrobjectptr_t objectPtr, uintptr_t slotOffset);
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 	/**
@@ -288,9 +349,37 @@ public:
 	MMINLINE void
 	initializeMinimumSizeObject(MM_EnvironmentBase *env, void *allocAddr) {}
 
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
+private:
+	MMINLINE uintptr_t
+	getHotFieldTableIndex(uintptr_t objectSize)
+	{
+		return (objectSize / sizeof(fomrobject_t)) % _hotFieldTableSize;
+	}
+
+	/**
+	 * Claim a hot field table entry for a shape, discarding the samples of the previous occupant.
+	 */
+	void resetHotFieldTableEntry(HotFieldTableEntry *entry, uintptr_t objectSize);
+
+	/**
+	 * Rebuild the ranked hot field offsets of an entry from its sample counts.
+	 */
+	void rankHotFields(HotFieldTableEntry *entry);
+
+public:
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
+
 	/**
 	 * Constructor receives a copy of OMR's object flags mask, normalized to low order byte.
 	 */
-	GC_ObjectModelDelegate(fomrobject_t omrHeaderSlotFlagsMask) {}
+	GC_ObjectModelDelegate(fomrobject_t omrHeaderSlotFlagsMask)
+	{
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
+		for (uintptr_t index = 0; index < _hotFieldTableSize; index++) {
+			resetHotFieldTableEntry(&_hotFieldTable[index], 0);
+		}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
+	}
 };
 #endif /* OBJECTMODELDELEGATE_HPP_ */
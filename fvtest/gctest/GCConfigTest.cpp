@@ -19,19 +19,28 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "HeapMapIterator.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryFormat.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
 
+extern "C" void ex_omr_insertMethodEntryInMethodDictionary(OMR_VM *omrVM, const void *method);
+
 #define MAX_NAME_LENGTH 512
 #define OMRGCTEST_CHECK_RT(rt) \
 	if (0 != (rt)) {\
@@ -43,12 +52,38 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/workstealing_GC_config.xml"
+                        , "fvtest/gctest/configuration/markingprefetch_GC_config.xml"
+                        , "fvtest/gctest/configuration/lazysweep_GC_config.xml"
+                        , "fvtest/gctest/configuration/tlhrefreshtarget_GC_config.xml"
+                        , "fvtest/gctest/configuration/freeentrysizeclasscache_GC_config.xml"
+                        , "fvtest/gctest/configuration/numasplitfreelist_GC_config.xml"
+                        , "fvtest/gctest/configuration/numaawareparallel_GC_config.xml"
+                        , "fvtest/gctest/configuration/pausetimegoal_GC_config.xml"
+                        , "fvtest/gctest/configuration/releasefreepages_GC_config.xml"
+                        , "fvtest/gctest/configuration/asynclogging_GC_config.xml"
+                        , "fvtest/gctest/configuration/binaryverbose_GC_config.xml"
+                        , "fvtest/gctest/configuration/allocationsitesampling_GC_config.xml"
+                        , "fvtest/gctest/configuration/markedobjectswalk_GC_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/elasticconhelpers_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/adaptivescancache_GC_config.xml"
+                        , "fvtest/gctest/configuration/hotfieldcolocation_GC_config.xml"
+                        , "fvtest/gctest/configuration/rememberedsetoverflowcards_GC_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregatedsweep_GC_config.xml"
+                        , "fvtest/gctest/configuration/segregatedsweepbudget_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/summarycompaction_GC_config.xml"
+                        , "fvtest/gctest/configuration/incrementalcompaction_GC_config.xml"
+                        , "fvtest/gctest/configuration/incrementalcompactionthreshold_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
@@ -116,6 +151,12 @@ GCConfigTest::SetUp()
 	verboseManager->enableVerboseGC();
 	verboseManager->setInitializedTime(omrtime_hires_clock());
 
+	/* simulated NUMA nodes have no threads running on them, so place the test thread on one explicitly */
+	uintptr_t mutatorNUMANode = (uintptr_t)optionNode.attribute("mutatorNUMANode").as_int();
+	if (0 != mutatorNUMANode) {
+		env->setNumaNode(mutatorNUMANode);
+	}
+
 	/* Initialize root table */
 	exampleVM->rootTable = hashTableNew(
 			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
@@ -714,6 +755,8 @@ GCConfigTest::allocationWalker(pugi::xml_node node)
 	AttributeElem *breadthElem = NULL;
 	int32_t depth = 0;
 	OMRGCObjectType objType = INVALID;
+	GC_Environment *gcEnv = env->getGCEnvironment();
+	const void *callerMethod = gcEnv->currentMethod;
 
 	const char *namePrefixStr = node.attribute(xs.namePrefix).value();
 	const char *numOfFieldsStr = node.attribute(xs.numOfFields).value();
@@ -745,6 +788,10 @@ GCConfigTest::allocationWalker(pugi::xml_node node)
 	rt = parseAttribute(&breadthElem, breadthStr);
 	OMRGCTEST_CHECK_RT(rt);
 
+	/* each object node is allocated by a method of its own (keyed by its name prefix), which calls the methods of its child nodes */
+	ex_omr_insertMethodEntryInMethodDictionary(exampleVM->_omrVM, namePrefixStr);
+	gcEnv->currentMethod = namePrefixStr;
+
 	/* process current xml node, perform allocation for single object or object tree */
 	rt = processObjNode(node, namePrefixStr, objType, numOfFieldsElem, breadthElem, depth);
 	OMRGCTEST_CHECK_RT(rt);
@@ -789,6 +836,7 @@ GCConfigTest::allocationWalker(pugi::xml_node node)
 	}
 
 done:
+	gcEnv->currentMethod = callerMethod;
 	freeAttributeList(breadthElem);
 	freeAttributeList(numOfFieldsElem);
 	return rt;
@@ -809,6 +857,93 @@ printFile(const char *name)
 }
 #endif
 
+/**
+ * XML text accumulated while converting a binary verbose log.
+ */
+typedef struct VerboseLogText {
+	OMRPortLibrary *portLib;
+	char *text;
+	uintptr_t length;
+	uintptr_t size;
+	bool failed;
+} VerboseLogText;
+
+static void
+appendVerboseLogText(void *userData, const char *text, uintptr_t length)
+{
+	VerboseLogText *logText = (VerboseLogText *)userData;
+	OMRPORT_ACCESS_FROM_OMRPORT(logText->portLib);
+	if ((logText->length + length) > logText->size) {
+		uintptr_t newSize = (logText->size * 2) + length;
+		char *newText = (char *)omrmem_reallocate_memory(logText->text, newSize, OMRMEM_CATEGORY_MM);
+		if (NULL == newText) {
+			logText->failed = true;
+			return;
+		}
+		logText->text = newText;
+		logText->size = newSize;
+	}
+	memcpy(logText->text + logText->length, text, length);
+	logText->length += length;
+}
+
+/**
+ * Load a verbose log written either as XML or in the binary format (-Xgc:verboseBinaryFormat),
+ * which is converted back to XML first.
+ */
+pugi::xml_parse_result
+GCConfigTest::loadVerboseLog(pugi::xml_document *verboseDoc, const char *name)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	pugi::xml_parse_result result;
+	VerboseLogText logText = {gcTestEnv->portLib, NULL, 0, 0, false};
+	char *contents = NULL;
+	intptr_t bytesRead = 0;
+
+	intptr_t fileDescriptor = omrfile_open(name, EsOpenRead, 0444);
+	if (-1 == fileDescriptor) {
+		result.status = pugi::status_file_not_found;
+		return result;
+	}
+	int64_t fileLength = omrfile_flength(fileDescriptor);
+	if (0 <= fileLength) {
+		contents = (char *)omrmem_allocate_memory((uintptr_t)fileLength + 1, OMRMEM_CATEGORY_MM);
+	}
+	if (NULL != contents) {
+		while (bytesRead < fileLength) {
+			intptr_t count = omrfile_read(fileDescriptor, contents + bytesRead, (intptr_t)fileLength - bytesRead);
+			if (0 >= count) {
+				break;
+			}
+			bytesRead += count;
+		}
+	}
+	omrfile_close(fileDescriptor);
+	if ((NULL == contents) || (bytesRead != fileLength)) {
+		omrmem_free_memory(contents);
+		result.status = pugi::status_io_error;
+		return result;
+	}
+
+	if (MM_VerboseBinaryDecoder::isBinaryLog((const uint8_t *)contents, (uintptr_t)bytesRead)) {
+		MM_VerboseBinaryXMLConverter converter(appendVerboseLogText, &logText);
+		MM_VerboseBinaryDecoder decoder(&converter);
+		intptr_t consumed = decoder.decode((const uint8_t *)contents, (uintptr_t)bytesRead);
+		if ((consumed != bytesRead) || logText.failed) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode binary verbose log %s.\n", __FILE__, __LINE__, name);
+			result.status = pugi::status_io_error;
+		} else {
+			result = verboseDoc->load_buffer(logText.text, logText.length, pugi::parse_default | pugi::parse_comments);
+		}
+		omrmem_free_memory(logText.text);
+	} else {
+		result = verboseDoc->load_buffer(contents, (size_t)bytesRead, pugi::parse_default | pugi::parse_comments);
+	}
+	omrmem_free_memory(contents);
+
+	return result;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -830,7 +965,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseLog(&verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,7 +973,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseLog(&verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -953,6 +1088,111 @@ done:
 	return rt;
 }
 
+/**
+ * Results of the walk made by the markedObjectsWalk operation from within a global collection.
+ */
+typedef struct MarkedObjectsWalk {
+	uintptr_t globalCycles; /**< number of global cycles which ended during the operation */
+	bool compacted; /**< true if the global cycle compacted, which invalidates the mark map */
+	bool markedObjectsOnly; /**< value returned by MM_ParallelHeapWalker::allMarkedObjectsDo() */
+	uintptr_t walkedObjects; /**< number of objects walked by MM_ParallelHeapWalker::allMarkedObjectsDo() */
+	uintptr_t markedObjects; /**< number of objects found by a serial scan of the mark map */
+} MarkedObjectsWalk;
+
+static void
+countWalkedObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	MM_AtomicOperations::add((volatile uintptr_t *)userData, 1);
+}
+
+static uintptr_t
+countMarkedObjects(MM_GCExtensionsBase *extensions, MM_MarkMap *markMap)
+{
+	uintptr_t markedObjects = 0;
+	GC_HeapRegionIterator regionIterator(extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		MM_HeapMapIterator markedObjectIterator(extensions, markMap, (uintptr_t *)region->getLowAddress(), (uintptr_t *)region->getHighAddress());
+		while (NULL != markedObjectIterator.nextObject()) {
+			markedObjects += 1;
+		}
+	}
+	return markedObjects;
+}
+
+static void
+walkMarkedObjectsAtCycleEnd(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_GCCycleEndEvent *event = (MM_GCCycleEndEvent *)eventData;
+	if (OMR_GC_CYCLE_TYPE_GLOBAL == event->cycleType) {
+		MarkedObjectsWalk *walk = (MarkedObjectsWalk *)userData;
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+
+		walk->globalCycles += 1;
+#if defined(OMR_GC_MODRON_COMPACTION)
+		walk->compacted = (COMPACT_NONE != extensions->globalGCStats.compactStats._compactReason);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+		walk->markedObjects = countMarkedObjects(extensions, heapWalker->getMarkMap());
+		walk->walkedObjects = 0;
+		walk->markedObjectsOnly = heapWalker->allMarkedObjectsDo(env, countWalkedObject, &walk->walkedObjects, 0);
+	}
+}
+
+/**
+ * Walk the marked objects of the heap from within a global collection (from the cycle end hook) and check the
+ * walk against a serial count of the mark map, then check that the same walk outside of a collection reports
+ * that it fell back to walking all objects.
+ */
+int32_t
+GCConfigTest::verifyMarkedObjectsWalk(uint32_t gcCode)
+{
+	int32_t rt = 0;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	J9HookInterface **omrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+	MarkedObjectsWalk walk;
+	memset(&walk, 0, sizeof(walk));
+
+	(*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GC_CYCLE_END, walkMarkedObjectsAtCycleEnd, OMR_GET_CALLSITE(), &walk);
+	rt = (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, gcCode);
+	(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_GC_CYCLE_END, walkMarkedObjectsAtCycleEnd, &walk);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_SystemCollect with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+
+	gcTestEnv->log("Marked objects walk: %zu global cycles, compacted %d, marked objects only %d, walked %zu objects, %zu objects marked.\n",
+		walk.globalCycles, walk.compacted, walk.markedObjectsOnly, walk.walkedObjects, walk.markedObjects);
+	if (1 != walk.globalCycles) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Expected a single global cycle, saw %zu.\n", __FILE__, __LINE__, walk.globalCycles);
+	} else if (walk.compacted) {
+		if (walk.markedObjectsOnly) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Marked objects walked after a compaction invalidated the mark map.\n", __FILE__, __LINE__);
+		}
+	} else if (!walk.markedObjectsOnly || (0 == walk.markedObjects) || (walk.walkedObjects != walk.markedObjects)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Marked objects walk within the collection walked %zu objects (marked objects only %d), the mark map holds %zu.\n",
+			__FILE__, __LINE__, walk.walkedObjects, walk.markedObjectsOnly, walk.markedObjects);
+	}
+
+	if (0 == rt) {
+		/* the collection is over and the mark map no longer describes the heap: all objects, dead ones included, are walked */
+		MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+		uintptr_t walkedObjects = 0;
+		if (heapWalker->allMarkedObjectsDo(env, countWalkedObject, &walkedObjects, 0) || (walkedObjects < walk.markedObjects)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Marked objects walk outside of a collection walked %zu objects, expected a fall back to all %zu or more objects.\n",
+				__FILE__, __LINE__, walkedObjects, walk.markedObjects);
+		}
+	}
+
+done:
+	return rt;
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -973,6 +1213,12 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "markedObjectsWalk")) {
+			uint32_t gcCode = (uint32_t)node.attribute("gcCode").as_int();
+			gcTestEnv->log("Walking marked objects within a gc system collect with gcCode %d...\n", gcCode);
+			rt = verifyMarkedObjectsWalk(gcCode);
+			OMRGCTEST_CHECK_RT(rt);
+			verboseManager->getWriterChain()->endOfCycle(env);
 		}
 	}
 done:
@@ -1044,6 +1290,8 @@ TEST_P(GCConfigTest, test)
 			/* select verboseGC nodes with right spec info */
 			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "verboseGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
+			/* writers which queue their output (asyncLogging) may not have written it all yet */
+			verboseManager->flushStreams(env);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
@@ -107,9 +107,11 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
+	pugi::xml_parse_result loadVerboseLog(pugi::xml_document *verboseDoc, const char *name);
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t verifyMarkedObjectsWalk(uint32_t gcCode);
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
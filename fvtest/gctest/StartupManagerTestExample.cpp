@@ -83,7 +83,8 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,23 +92,95 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, segregated or optavgpause): %s\n", attr.value());
 						result = false;
 					}
+				} else if (0 == strcmp(attr.name(), "sweepIncrementMicro")) {
+					extensions->sweepIncrementMicro = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "workStealingMarking")) {
+					extensions->workStealingMarking = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDepth")) {
+					extensions->markingPrefetchDepth = OMR_MIN((uintptr_t)atoi(attr.value()), MARKING_PREFETCH_DEPTH_MAXIMUM);
+				} else if (0 == strcmp(attr.name(), "lazySweep")) {
+					extensions->lazySweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhRefreshTarget")) {
+					extensions->tlhRefreshTarget = OMR_MIN((uintptr_t)atoi(attr.value()), TLH_REFRESH_TARGET_MAXIMUM);
+				} else if (0 == strcmp(attr.name(), "tlhMaximumSize")) {
+					extensions->tlhMaximumSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "freeEntrySizeClassCache")) {
+					extensions->freeEntrySizeClassCache = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "numaSplitFreeList")) {
+					extensions->numaSplitFreeList = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "numaAwareParallelGC")) {
+					extensions->numaAwareParallelGC = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+				} else if (0 == strcmp(attr.name(), "pauseTimeGoal")) {
+					extensions->pauseTimeGoal = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "throughputGoal")) {
+					extensions->throughputGoal = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "releaseFreePagesAfterGC")) {
+					extensions->releaseFreePagesAfterGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "releaseFreePagesGranule")) {
+					extensions->releaseFreePagesGranule = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "asyncLogging")) {
+					extensions->asyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLoggingBufferSize")) {
+					extensions->asyncLoggingBufferSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "verboseBinaryFormat")) {
+					extensions->verboseBinaryFormat = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationSiteSamplingBytes")) {
+					extensions->allocationSiteSamplingBytesGranularity = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "allocationSiteSamplingDepth")) {
+					extensions->allocationSiteSamplingDepth = OMR_MAX(OMR_MIN((uintptr_t)atoi(attr.value()), ALLOCATION_SITE_STATS_SIZE), 1);
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 					extensions->concurrentMark = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "concurrentBackgroundMax")) {
+					extensions->concurrentBackgroundMax = atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveScanCacheSizing")) {
+					extensions->adaptiveScanCacheSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hotFieldCoLocation")) {
+					extensions->scavengerHotFieldCoLocation = OMR_MIN((uintptr_t)atoi(attr.value()), HOT_FIELD_CO_LOCATION_MAXIMUM);
+				} else if (0 == strcmp(attr.name(), "rememberedSetOverflowCards")) {
+					extensions->scavengerRememberedSetOverflowCards = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "rememberedSetMaxSize")) {
+					/* bound the remembered set so that a test can drive it into overflow */
+					extensions->rememberedSet.setMaxSize(atoi(attr.value()) * unitSize);
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
-				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+					extensions->noCompactOnGlobalGC = 1 - extensions->compactOnGlobalGC;
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: compactOnGlobalGC=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "summaryCompaction")) {
+					extensions->summaryCompaction = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "incrementalCompactionBudget")) {
+					extensions->incrementalCompactionBudget = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "incrementalCompactionGarbageThreshold")) {
+					extensions->incrementalCompactionGarbageThreshold = OMR_MIN((uintptr_t)atoi(attr.value()), 100);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit")) || (0 == strcmp(attr.name(), "mutatorNUMANode"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
 					result = false;
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "AllocationCacheSizingModel.hpp"
+
+#include <gtest/gtest.h>
+
+/* replenish a whole replenish size at a time until the size stops changing */
+static uintptr_t
+growUntilStable(MM_AllocationCacheSizingModel *model, uintptr_t replenishSize, uint64_t microsPerReplenish, uintptr_t otherHotBytes)
+{
+    uint64_t bytes = 0;
+    uint64_t replenishes = 0;
+    for (;;) {
+        bytes += replenishSize;
+        replenishes += 1;
+        uintptr_t newSize = model->grow(replenishSize, bytes, replenishes, replenishes * microsPerReplenish, otherHotBytes + model->getHotBytes(replenishSize));
+        if (newSize == replenishSize) {
+            return replenishSize;
+        }
+        replenishSize = newSize;
+    }
+}
+
+TEST(TestAllocationCacheSizingModel, AllocationCacheSizingModel)
+{
+    uintptr_t initialSize = 256;
+    uintptr_t maximumSize = 16 * 1024;
+    uintptr_t hotMaximumSize = 64 * 1024;
+    uintptr_t hotRate = 4096; /* bytes per millisecond */
+    uintptr_t hotFootprint = 256 * 1024;
+
+    MM_AllocationCacheSizingModel model;
+    model.initialize(initialSize, 256, maximumSize, hotMaximumSize, hotRate, hotFootprint);
+
+    /* hot takes two replenishes at the hot rate */
+    EXPECT_FALSE(model.isHot(hotMaximumSize, 1, 0));
+    EXPECT_TRUE(model.isHot(hotRate, 2, 1000));
+    EXPECT_FALSE(model.isHot(hotRate - 1, 2, 1000));
+    EXPECT_FALSE(model.isHot(hotRate, 2, 2000));
+
+    /* a cold size class grows to the maximum size, and a partly drained cache does not grow */
+    EXPECT_EQ(growUntilStable(&model, initialSize, 1000000, 0), maximumSize);
+    EXPECT_EQ(model.getHotBytes(maximumSize), 0);
+    EXPECT_EQ(model.grow(initialSize, initialSize - 1, 1, 1000, 0), initialSize);
+
+    /* a hot size class doubles up to the hot maximum */
+    EXPECT_EQ(model.grow(2 * initialSize, 3 * initialSize, 2, 2, 0), 4 * initialSize);
+    EXPECT_EQ(growUntilStable(&model, initialSize, 1, 0), hotMaximumSize);
+    EXPECT_EQ(model.getHotBytes(hotMaximumSize), hotMaximumSize);
+
+    /* hot growth stops short of the hot footprint of the thread; once that is used up, hot grows like cold */
+    uintptr_t otherHotBytes = hotFootprint - hotMaximumSize + maximumSize;
+    EXPECT_EQ(growUntilStable(&model, initialSize, 1, otherHotBytes), hotMaximumSize / 2);
+    EXPECT_EQ(growUntilStable(&model, initialSize, 1, hotFootprint), maximumSize);
+
+    /* back off what was not used since the last restart, or a single cache that was not used up */
+    EXPECT_EQ(model.backOff(initialSize, 0, 0, 1000), initialSize);
+    EXPECT_EQ(model.backOff(hotMaximumSize, 0, 0, 1000), initialSize);
+    EXPECT_EQ(model.backOff(hotMaximumSize, hotMaximumSize, 1, 1000), hotMaximumSize / 2);
+    EXPECT_EQ(model.backOff(maximumSize, maximumSize / 2, 2, 1000000), maximumSize / 2);
+
+    /* keep the maximum size while cold and the hot maximum while hot, then cool down a step at a time */
+    EXPECT_EQ(model.backOff(maximumSize, 4 * maximumSize, 4, 1000000), maximumSize);
+    EXPECT_EQ(model.backOff(hotMaximumSize, 4 * hotMaximumSize, 4, 1000), hotMaximumSize);
+    uintptr_t replenishSize = hotMaximumSize;
+    while (model.getHotBytes(replenishSize) > 0) {
+        EXPECT_EQ(model.backOff(replenishSize, 4 * replenishSize, 4, 1000000), replenishSize / 2);
+        replenishSize /= 2;
+    }
+    EXPECT_EQ(replenishSize, maximumSize);
+}
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "AllocationSiteStats.hpp"
+
+#include <gtest/gtest.h>
+
+/* distinct sites, spread over the buffer slots the same way method addresses would be */
+#define TEST_SITE(index) ((const void *)(((uintptr_t)(index) + 1) << 3))
+
+static MM_AllocationSiteSample *
+findSite(MM_AllocationSiteStats *stats, const void *site)
+{
+	for (uintptr_t i = 0; i < stats->getEntryCount(); i++) {
+		if (site == stats->getEntry(i)->site) {
+			return stats->getEntry(i);
+		}
+	}
+	return NULL;
+}
+
+TEST(TestAllocationSiteStats, SampleBufferAccumulatesPerSite)
+{
+	MM_AllocationSiteSampleBuffer buffer;
+	buffer.add(TEST_SITE(0), 100);
+	buffer.add(TEST_SITE(1), 10);
+	buffer.add(TEST_SITE(0), 200);
+	buffer.add(NULL, 1);
+
+	MM_AllocationSiteStats stats;
+	stats.merge(&buffer);
+
+	EXPECT_EQ((uintptr_t)3, stats.getEntryCount());
+	EXPECT_EQ((uintptr_t)311, stats._sampledBytes);
+	EXPECT_EQ((uintptr_t)4, stats._samples);
+	ASSERT_TRUE(NULL != findSite(&stats, TEST_SITE(0)));
+	EXPECT_EQ((uintptr_t)300, findSite(&stats, TEST_SITE(0))->bytes);
+	EXPECT_EQ((uintptr_t)2, findSite(&stats, TEST_SITE(0))->samples);
+	ASSERT_TRUE(NULL != findSite(&stats, NULL));
+	EXPECT_EQ((uintptr_t)1, findSite(&stats, NULL)->samples);
+}
+
+TEST(TestAllocationSiteStats, SampleBufferOverflowDropsSamples)
+{
+	MM_AllocationSiteSampleBuffer buffer;
+	for (uintptr_t i = 0; i < ALLOCATION_SITE_SAMPLE_BUFFER_SIZE; i++) {
+		buffer.add(TEST_SITE(i), 64);
+	}
+	EXPECT_EQ((uintptr_t)0, buffer._droppedSamples);
+
+	/* the table is full: new sites are dropped, sites already in it still accumulate */
+	buffer.add(TEST_SITE(ALLOCATION_SITE_SAMPLE_BUFFER_SIZE), 32);
+	buffer.add(TEST_SITE(ALLOCATION_SITE_SAMPLE_BUFFER_SIZE + 1), 16);
+	buffer.add(TEST_SITE(0), 64);
+	EXPECT_EQ((uintptr_t)2, buffer._droppedSamples);
+	EXPECT_EQ((uintptr_t)48, buffer._droppedBytes);
+
+	/* dropped samples still count towards the totals, and draining the buffer clears it */
+	MM_AllocationSiteStats stats;
+	stats.merge(&buffer);
+	EXPECT_EQ((uintptr_t)ALLOCATION_SITE_SAMPLE_BUFFER_SIZE, stats.getEntryCount());
+	EXPECT_EQ((uintptr_t)(ALLOCATION_SITE_SAMPLE_BUFFER_SIZE + 3), stats._samples);
+	EXPECT_EQ((uintptr_t)((ALLOCATION_SITE_SAMPLE_BUFFER_SIZE + 1) * 64) + 48, stats._sampledBytes);
+	EXPECT_EQ((uintptr_t)128, findSite(&stats, TEST_SITE(0))->bytes);
+	EXPECT_TRUE(NULL == findSite(&stats, TEST_SITE(ALLOCATION_SITE_SAMPLE_BUFFER_SIZE)));
+
+	EXPECT_EQ((uintptr_t)0, buffer._droppedSamples);
+	EXPECT_EQ((uintptr_t)0, buffer._droppedBytes);
+	for (uintptr_t i = 0; i < ALLOCATION_SITE_SAMPLE_BUFFER_SIZE; i++) {
+		EXPECT_EQ((uintptr_t)0, buffer.getEntry(i)->samples);
+	}
+}
+
+TEST(TestAllocationSiteStats, SpaceSavingEvictsLightestSite)
+{
+	MM_AllocationSiteStats stats;
+	MM_AllocationSiteSampleBuffer buffer;
+
+	/* fill the table with distinct sites, site i weighing (i + 1) * 8 bytes, so site 0 is the lightest */
+	for (uintptr_t i = 0; i < ALLOCATION_SITE_STATS_SIZE; i++) {
+		buffer.add(TEST_SITE(i), (i + 1) * 8);
+		if (0 == ((i + 1) % (ALLOCATION_SITE_SAMPLE_BUFFER_SIZE / 2))) {
+			stats.merge(&buffer);
+		}
+	}
+	stats.merge(&buffer);
+	ASSERT_EQ((uintptr_t)ALLOCATION_SITE_STATS_SIZE, stats.getEntryCount());
+
+	/* a new site replaces the lightest one and inherits its count, so its bytes are overestimated, never under */
+	const void *newSite = TEST_SITE(ALLOCATION_SITE_STATS_SIZE);
+	buffer.add(newSite, 4);
+	stats.merge(&buffer);
+	EXPECT_EQ((uintptr_t)ALLOCATION_SITE_STATS_SIZE, stats.getEntryCount());
+	EXPECT_TRUE(NULL == findSite(&stats, TEST_SITE(0)));
+	ASSERT_TRUE(NULL != findSite(&stats, newSite));
+	EXPECT_EQ((uintptr_t)(8 + 4), findSite(&stats, newSite)->bytes);
+	EXPECT_EQ((uintptr_t)2, findSite(&stats, newSite)->samples);
+
+	/* the new site (12 bytes) is now the lightest, so the next new site replaces it, while the heavy sites stay */
+	const void *secondSite = TEST_SITE(ALLOCATION_SITE_STATS_SIZE + 1);
+	buffer.add(secondSite, 4);
+	stats.merge(&buffer);
+	EXPECT_TRUE(NULL == findSite(&stats, newSite));
+	ASSERT_TRUE(NULL != findSite(&stats, secondSite));
+	EXPECT_EQ((uintptr_t)(8 + 4 + 4), findSite(&stats, secondSite)->bytes);
+	EXPECT_EQ((uintptr_t)3, findSite(&stats, secondSite)->samples);
+	for (uintptr_t i = 1; i < ALLOCATION_SITE_STATS_SIZE; i++) {
+		EXPECT_TRUE(NULL != findSite(&stats, TEST_SITE(i)));
+	}
+
+	/* a site already in the table accumulates instead of evicting anything */
+	buffer.add(TEST_SITE(1), 100);
+	stats.merge(&buffer);
+	EXPECT_EQ((uintptr_t)(16 + 100), findSite(&stats, TEST_SITE(1))->bytes);
+	EXPECT_TRUE(NULL != findSite(&stats, secondSite));
+
+	uintptr_t expectedBytes = ((ALLOCATION_SITE_STATS_SIZE * (ALLOCATION_SITE_STATS_SIZE + 1) / 2) * 8) + 4 + 4 + 100;
+	EXPECT_EQ(expectedBytes, stats._sampledBytes);
+	EXPECT_EQ((uintptr_t)(ALLOCATION_SITE_STATS_SIZE + 3), stats._samples);
+}
+
+TEST(TestAllocationSiteStats, SortOrdersByBytes)
+{
+	MM_AllocationSiteStats stats;
+	MM_AllocationSiteSampleBuffer buffer;
+	uintptr_t weights[] = {30, 10, 50, 20, 40};
+	uintptr_t siteCount = sizeof(weights) / sizeof(weights[0]);
+
+	for (uintptr_t i = 0; i < siteCount; i++) {
+		buffer.add(TEST_SITE(i), weights[i]);
+	}
+	stats.merge(&buffer);
+	stats.sort();
+
+	ASSERT_EQ(siteCount, stats.getEntryCount());
+	EXPECT_EQ(TEST_SITE(2), stats.getEntry(0)->site);
+	for (uintptr_t i = 1; i < siteCount; i++) {
+		EXPECT_GE(stats.getEntry(i - 1)->bytes, stats.getEntry(i)->bytes);
+	}
+	EXPECT_EQ(TEST_SITE(1), stats.getEntry(siteCount - 1)->site);
+
+	stats.clear();
+	EXPECT_EQ((uintptr_t)0, stats.getEntryCount());
+	EXPECT_EQ((uintptr_t)0, stats._samples);
+	EXPECT_EQ((uintptr_t)0, stats._sampledBytes);
+}
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ConcurrentCardTable.hpp"
+#include "Math.hpp"
+
+#include <gtest/gtest.h>
+
+#define TEST_CARD_TABLE_SLOTS 67
+
+/**
+ * Reference scan: a card at a time, returning the slot holding the first card which is not clean.
+ */
+static uintptr_t *
+skipCleanSlotsByCard(uintptr_t *nextSlot, uintptr_t *lastSlot)
+{
+	for (Card *card = (Card *)nextSlot; card < (Card *)lastSlot; card++) {
+		if ((Card)CARD_CLEAN != *card) {
+			return (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)card);
+		}
+	}
+	return lastSlot;
+}
+
+/**
+ * Compare the stride scan with the card at a time scan from every start slot to every end slot,
+ * so that both aligned and unaligned strides and the slot at a time tail are covered.
+ */
+static void
+verifyAllRanges(uintptr_t *slots)
+{
+	for (uintptr_t start = 0; start <= TEST_CARD_TABLE_SLOTS; start++) {
+		for (uintptr_t end = start; end <= TEST_CARD_TABLE_SLOTS; end++) {
+			ASSERT_EQ(skipCleanSlotsByCard(slots + start, slots + end), MM_ConcurrentCardTable::skipCleanSlots(slots + start, slots + end))
+				<< "start " << start << " end " << end;
+		}
+	}
+}
+
+class TestConcurrentCardTable : public ::testing::Test
+{
+protected:
+	uintptr_t _buffer[TEST_CARD_TABLE_SLOTS + CARD_SCAN_STRIDE_SLOTS];
+	uintptr_t *_slots;
+
+	virtual void
+	SetUp()
+	{
+		/* start the table on a stride boundary so the stride and slot paths are both taken */
+		_slots = (uintptr_t *)MM_Math::roundToCeiling(CARD_SCAN_STRIDE_BYTES, (uintptr_t)_buffer);
+		memset(_slots, CARD_CLEAN, TEST_CARD_TABLE_SLOTS * sizeof(uintptr_t));
+	}
+
+	Card *
+	cards()
+	{
+		return (Card *)_slots;
+	}
+};
+
+TEST_F(TestConcurrentCardTable, SkipCleanSlotsEmpty)
+{
+	verifyAllRanges(_slots);
+}
+
+TEST_F(TestConcurrentCardTable, SkipCleanSlotsSingleDirtyCard)
+{
+	/* one dirty card at every position, including every card within a slot */
+	for (uintptr_t card = 0; card < (TEST_CARD_TABLE_SLOTS * sizeof(uintptr_t)); card++) {
+		cards()[card] = CARD_DIRTY;
+		verifyAllRanges(_slots);
+		cards()[card] = CARD_CLEAN;
+		if (HasFatalFailure()) {
+			return;
+		}
+	}
+}
+
+TEST_F(TestConcurrentCardTable, SkipCleanSlotsRandomCards)
+{
+	/* sparse to dense tables, with values other than CARD_DIRTY which are not clean either */
+	srand(42);
+	for (uintptr_t density = 1; density <= 64; density *= 4) {
+		for (uintptr_t iteration = 0; iteration < 8; iteration++) {
+			for (uintptr_t card = 0; card < (TEST_CARD_TABLE_SLOTS * sizeof(uintptr_t)); card++) {
+				cards()[card] = (0 == (rand() % (1024 / density))) ? (Card)(1 + (rand() % 0xFF)) : (Card)CARD_CLEAN;
+			}
+			verifyAllRanges(_slots);
+			if (HasFatalFailure()) {
+				return;
+			}
+		}
+	}
+}
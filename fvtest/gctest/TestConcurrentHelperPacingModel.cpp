@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ConcurrentHelperPacingModel.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(TestConcurrentHelperPacingModel, ConcurrentHelperPacingModel)
+{
+    uint32_t idleCPUs = 64;
+
+    MM_ConcurrentHelperPacingModel model;
+    model.initialize(1, 4);
+    EXPECT_TRUE(model.isElastic());
+    EXPECT_EQ(model.getCycleStartTarget(), 1);
+
+    /* without a trace rate yet, grow a helper at a time */
+    EXPECT_EQ(model.calculateTarget(1, 1000, 1000, 0.0f, idleCPUs), 2);
+    EXPECT_EQ(model.calculateTarget(4, 1000, 1000, 0.0f, idleCPUs), 4);
+
+    /* 1000 bytes to trace in 1000 free bytes, with 25% headroom, needs 1.25 bytes traced per byte allocated */
+    EXPECT_EQ(model.calculateTarget(1, 1000, 1000, 0.5f, idleCPUs), 3);
+    EXPECT_EQ(model.calculateTarget(2, 1000, 1000, 1.5f, idleCPUs), 2);
+
+    /* never below the configured helpers, nor above the started ones */
+    EXPECT_EQ(model.calculateTarget(4, 10, 1000, 4.0f, idleCPUs), 1);
+    EXPECT_EQ(model.calculateTarget(1, 1000, 10, 0.1f, idleCPUs), 4);
+
+    /* every helper once the free memory above the kickoff buffer or the predicted work is used up */
+    EXPECT_EQ(model.calculateTarget(1, 1000, 0, 10.0f, idleCPUs), 4);
+    EXPECT_EQ(model.calculateTarget(1, 0, 1000, 10.0f, idleCPUs), 4);
+
+    /* growing needs idle CPUs, shrinking does not */
+    EXPECT_EQ(model.calculateTarget(1, 1000, 0, 0.0f, 0), 1);
+    EXPECT_EQ(model.calculateTarget(1, 1000, 0, 0.0f, 1), 2);
+    EXPECT_EQ(model.calculateTarget(4, 10, 1000, 4.0f, 0), 1);
+
+    /* a pool of fixed size never paces */
+    MM_ConcurrentHelperPacingModel fixed;
+    fixed.initialize(4, 4);
+    EXPECT_FALSE(fixed.isElastic());
+    fixed.initialize(4, 1);
+    EXPECT_FALSE(fixed.isElastic());
+    EXPECT_EQ(fixed.getCycleStartTarget(), 1);
+}
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#include "omrgcstartup.hpp"
+#include "omrvm.h"
+
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "LockingHeapRegionQueue.hpp"
+#include "StartupManagerImpl.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#define TEST_REGION_COUNT 6
+
+/**
+ * Batch dequeue splices a chain of regions from the front of one queue onto the back of another.
+ * Regions are only linked, never touched as heap memory, so descriptors are built outside the heap
+ * on an environment of a default collector.
+ */
+class TestLockingHeapRegionQueue : public ::testing::Test
+{
+protected:
+	OMR_VMThread *_omrVMThread;
+	MM_EnvironmentBase *_env;
+	MM_HeapRegionDescriptorSegregated *_regions;
+
+	virtual void SetUp()
+	{
+		OMR_VM *omrVM = gcTestEnv->exampleVM._omrVM;
+		MM_StartupManagerImpl startupManager(omrVM);
+
+		_omrVMThread = NULL;
+		_env = NULL;
+		_regions = NULL;
+
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(omrVM, NULL, &_omrVMThread, "TestLockingHeapRegionQueue"));
+		_env = MM_EnvironmentBase::getEnvironment(_omrVMThread);
+
+		_regions = (MM_HeapRegionDescriptorSegregated *)_env->getForge()->allocate(TEST_REGION_COUNT * sizeof(MM_HeapRegionDescriptorSegregated), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		ASSERT_TRUE(NULL != _regions);
+		for (uintptr_t i = 0; i < TEST_REGION_COUNT; i++) {
+			new (&_regions[i]) MM_HeapRegionDescriptorSegregated(_env, NULL, NULL);
+			/* distinct range counts so that a miscounted splice shows in the total */
+			_regions[i].setRangeCount(i + 1);
+		}
+	}
+
+	virtual void TearDown()
+	{
+		if (NULL != _regions) {
+			_env->getForge()->free(_regions);
+			_regions = NULL;
+		}
+		if (NULL != _omrVMThread) {
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(_omrVMThread));
+			_omrVMThread = NULL;
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(gcTestEnv->exampleVM._omrVM));
+	}
+
+	/**
+	 * Enqueue regions [first, first + count) on the queue in order.
+	 */
+	void fill(MM_LockingHeapRegionQueue *queue, uintptr_t first, uintptr_t count)
+	{
+		for (uintptr_t i = first; i < (first + count); i++) {
+			queue->enqueue(&_regions[i]);
+		}
+	}
+
+	/**
+	 * Check the queue holds exactly regions [first, first + count) in order, with consistent links and counts.
+	 */
+	void verify(MM_LockingHeapRegionQueue *queue, uintptr_t first, uintptr_t count)
+	{
+		uintptr_t expectedTotalRegions = 0;
+		for (uintptr_t i = first; i < (first + count); i++) {
+			expectedTotalRegions += _regions[i].getRange();
+		}
+		EXPECT_EQ(count, queue->length());
+		EXPECT_EQ(0 == count, queue->isEmpty());
+		EXPECT_EQ(expectedTotalRegions, queue->getTotalRegions());
+
+		if (0 != count) {
+			EXPECT_TRUE(NULL == _regions[first].getPrev());
+			EXPECT_TRUE(NULL == _regions[first + count - 1].getNext());
+			for (uintptr_t i = first + 1; i < (first + count); i++) {
+				EXPECT_EQ(&_regions[i], _regions[i - 1].getNext()) << "region " << i;
+				EXPECT_EQ(&_regions[i - 1], _regions[i].getPrev()) << "region " << i;
+			}
+		}
+
+		/* dequeue one at a time must see the same order and unlink each region */
+		for (uintptr_t i = first; i < (first + count); i++) {
+			MM_HeapRegionDescriptorSegregated *region = queue->dequeue();
+			EXPECT_EQ(&_regions[i], region);
+			if (NULL != region) {
+				EXPECT_TRUE(NULL == region->getNext());
+				region->setPrev(NULL);
+			}
+		}
+		EXPECT_TRUE(NULL == queue->dequeue());
+	}
+};
+
+TEST_F(TestLockingHeapRegionQueue, DequeueFewerThanLength)
+{
+	MM_LockingHeapRegionQueue source(MM_HeapRegionList::HRL_KIND_SWEEP, false, false, false);
+	MM_LockingHeapRegionQueue target(MM_HeapRegionList::HRL_KIND_LOCAL_WORK, false, false, false);
+	fill(&source, 0, 4);
+	fill(&target, 4, 2);
+
+	EXPECT_EQ((uintptr_t)3, source.dequeue(&target, 3));
+
+	/* the source keeps its last region, the target gains the first three behind its own */
+	EXPECT_TRUE(NULL == _regions[3].getPrev());
+	EXPECT_EQ(&_regions[0], _regions[5].getNext());
+	EXPECT_EQ(&_regions[5], _regions[0].getPrev());
+	EXPECT_TRUE(NULL == _regions[2].getNext());
+	EXPECT_EQ((uintptr_t)1, source.length());
+	EXPECT_EQ(_regions[3].getRange(), source.getTotalRegions());
+	EXPECT_EQ((uintptr_t)5, target.length());
+	EXPECT_EQ(_regions[4].getRange() + _regions[5].getRange() + _regions[0].getRange() + _regions[1].getRange() + _regions[2].getRange(), target.getTotalRegions());
+
+	EXPECT_EQ(&_regions[3], source.dequeue());
+	EXPECT_TRUE(source.isEmpty());
+	EXPECT_EQ(&_regions[4], target.dequeue());
+	_regions[4].setPrev(NULL);
+	EXPECT_EQ(&_regions[5], target.dequeue());
+	_regions[5].setPrev(NULL);
+	verify(&target, 0, 3);
+}
+
+TEST_F(TestLockingHeapRegionQueue, DequeueExactlyLength)
+{
+	MM_LockingHeapRegionQueue source(MM_HeapRegionList::HRL_KIND_SWEEP, false, false, false);
+	MM_LockingHeapRegionQueue target(MM_HeapRegionList::HRL_KIND_LOCAL_WORK, false, false, false);
+	fill(&source, 0, TEST_REGION_COUNT);
+
+	EXPECT_EQ((uintptr_t)TEST_REGION_COUNT, source.dequeue(&target, TEST_REGION_COUNT));
+
+	verify(&source, 0, 0);
+	verify(&target, 0, TEST_REGION_COUNT);
+}
+
+TEST_F(TestLockingHeapRegionQueue, DequeueMoreThanLength)
+{
+	MM_LockingHeapRegionQueue source(MM_HeapRegionList::HRL_KIND_SWEEP, false, false, false);
+	MM_LockingHeapRegionQueue target(MM_HeapRegionList::HRL_KIND_LOCAL_WORK, false, false, false);
+	fill(&source, 2, 3);
+	fill(&target, 0, 2);
+
+	EXPECT_EQ((uintptr_t)3, source.dequeue(&target, TEST_REGION_COUNT * 2));
+
+	verify(&source, 0, 0);
+	verify(&target, 0, 5);
+}
+
+TEST_F(TestLockingHeapRegionQueue, DequeueNothing)
+{
+	MM_LockingHeapRegionQueue source(MM_HeapRegionList::HRL_KIND_SWEEP, false, false, false);
+	MM_LockingHeapRegionQueue target(MM_HeapRegionList::HRL_KIND_LOCAL_WORK, false, false, false);
+
+	/* from an empty queue */
+	EXPECT_EQ((uintptr_t)0, source.dequeue(&target, 3));
+	verify(&target, 0, 0);
+
+	/* a count of zero */
+	fill(&source, 0, 2);
+	EXPECT_EQ((uintptr_t)0, source.dequeue(&target, 0));
+	verify(&target, 0, 0);
+	verify(&source, 0, 2);
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "MarkMapScanner.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#define TEST_MARK_MAP_SLOTS 67
+
+static void
+verifyScanner(MM_MarkMapScanner::FindNonEmptySlotFunction scanner)
+{
+	uintptr_t slots[TEST_MARK_MAP_SLOTS];
+
+	/* an empty range runs off the end */
+	memset(slots, 0, sizeof(slots));
+	for (uintptr_t start = 0; start <= TEST_MARK_MAP_SLOTS; start++) {
+		EXPECT_EQ(slots + TEST_MARK_MAP_SLOTS, scanner(slots + start, slots + TEST_MARK_MAP_SLOTS));
+	}
+
+	/* every position of a single set slot is found from every start, covering vector and tail paths */
+	for (uintptr_t set = 0; set < TEST_MARK_MAP_SLOTS; set++) {
+		slots[set] = ((uintptr_t)1) << (set % (sizeof(uintptr_t) * 8));
+		for (uintptr_t start = 0; start <= TEST_MARK_MAP_SLOTS; start++) {
+			uintptr_t *expected = (start <= set) ? (slots + set) : (slots + TEST_MARK_MAP_SLOTS);
+			EXPECT_EQ(expected, scanner(slots + start, slots + TEST_MARK_MAP_SLOTS));
+		}
+		/* the top bound is exclusive */
+		EXPECT_EQ(slots + set, scanner(slots, slots + set));
+		slots[set] = 0;
+	}
+}
+
+TEST(TestMarkMapScanner, Scalar)
+{
+	verifyScanner(MM_MarkMapScanner::findNonEmptySlotScalar);
+}
+
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+TEST(TestMarkMapScanner, SSE42)
+{
+	if (!__builtin_cpu_supports("sse4.2")) {
+		GTEST_SKIP() << "SSE4.2 is not supported by this CPU";
+	}
+	verifyScanner(MM_MarkMapScanner::findNonEmptySlotSSE42);
+}
+
+TEST(TestMarkMapScanner, AVX2)
+{
+	if (!__builtin_cpu_supports("avx2")) {
+		GTEST_SKIP() << "AVX2 is not supported by this CPU";
+	}
+	verifyScanner(MM_MarkMapScanner::findNonEmptySlotAVX2);
+}
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "PauseTimeGoalModel.hpp"
+
+#include <gtest/gtest.h>
+
+/* collections at 1MB, 2MB, ... 4MB of space above a 1MB live set, pausing one microsecond per KB of space */
+static void
+recordHistory(MM_PauseTimeGoalModel *model, uintptr_t count)
+{
+    uintptr_t mb = 1024 * 1024;
+    for (uintptr_t gcCount = 1; gcCount <= count; gcCount++) {
+        uintptr_t spaceSize = mb + (gcCount * mb);
+        model->recordSample(gcCount, spaceSize / 1024, 10000, mb, spaceSize, spaceSize - mb);
+    }
+}
+
+TEST(TestPauseTimeGoalModel, PauseTimeGoalModel)
+{
+    uintptr_t mb = 1024 * 1024;
+    uintptr_t liveBytes = mb;
+    uintptr_t currentSize = 4 * mb;
+    uintptr_t maximumSize = 64 * mb;
+    uint64_t pauseAtCurrentSize = currentSize / 1024;
+
+    MM_PauseTimeGoalModel model;
+
+    /* a single collection, recorded twice, is not enough history to fit */
+    EXPECT_EQ(model.calculateTargetSize(liveBytes, pauseAtCurrentSize, 0, liveBytes, maximumSize), 0);
+    recordHistory(&model, 1);
+    recordHistory(&model, 1);
+    EXPECT_EQ(model.calculateTargetSize(liveBytes, pauseAtCurrentSize, 0, liveBytes, maximumSize), 0);
+
+    recordHistory(&model, 4);
+
+    /* a goal met by the current size keeps it */
+    EXPECT_NEAR((double)model.calculateTargetSize(liveBytes, pauseAtCurrentSize, 0, liveBytes, maximumSize), (double)currentSize, 1024.0);
+    EXPECT_LE(model.predictPauseTime(liveBytes, currentSize), pauseAtCurrentSize);
+
+    /* a goal missed contracts to the size that meets it, but not below the minimum */
+    uintptr_t contracted = model.calculateTargetSize(liveBytes, (pauseAtCurrentSize / 2) + 1, 0, liveBytes, maximumSize);
+    EXPECT_NEAR((double)contracted, (double)(currentSize / 2), 1024.0);
+    EXPECT_LE(model.predictPauseTime(liveBytes, contracted), (pauseAtCurrentSize / 2) + 1);
+    EXPECT_EQ(model.calculateTargetSize(liveBytes, 1, 0, liveBytes, maximumSize), liveBytes);
+
+    /* a goal with room to spare expands up to it, but not above the maximum */
+    EXPECT_NEAR((double)model.calculateTargetSize(liveBytes, 2 * pauseAtCurrentSize, 0, liveBytes, maximumSize), (double)(2 * currentSize), 1024.0);
+    EXPECT_EQ(model.calculateTargetSize(liveBytes, maximumSize, 0, liveBytes, maximumSize), maximumSize);
+
+    /* spending less time in GC takes more space, and the pause time goal wins over the throughput goal */
+    uintptr_t relaxed = model.calculateTargetSize(liveBytes, maximumSize, 50, liveBytes, maximumSize);
+    uintptr_t strict = model.calculateTargetSize(liveBytes, maximumSize, 25, liveBytes, maximumSize);
+    EXPECT_LT(liveBytes, relaxed);
+    EXPECT_LT(relaxed, strict);
+    EXPECT_LT(strict, maximumSize);
+    EXPECT_NEAR((double)model.calculateTargetSize(liveBytes, (strict / 1024) / 2, 25, liveBytes, maximumSize), (double)(strict / 2), 1024.0);
+}
@@ -0,0 +1,227 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#include "omrgcstartup.hpp"
+#include "omrgcstartup.hpp"
+#include "omrvm.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "RememberedSetSATB.hpp"
+#include "StartupManagerImpl.hpp"
+#include "WorkPacketsSATB.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#if defined(OMR_GC_REALTIME)
+
+#define TEST_OBJECT_COUNT 1024
+#define TEST_OBJECT_STRIDE 64
+
+/**
+ * The SATB remembered set is driven directly through a thread's fragment, on work packets of its own
+ * and the marking scheme of a default collector.  Barrier entries are addresses in the heap, which
+ * are only ever looked up in the mark map, so no objects need to be allocated.
+ */
+class TestRememberedSetSATB : public ::testing::Test
+{
+protected:
+	OMR_VMThread *_omrVMThread;
+	MM_EnvironmentBase *_env;
+	MM_MarkingScheme *_markingScheme;
+	MM_WorkPacketsSATB *_workPackets;
+	MM_RememberedSetSATB *_rememberedSet;
+	MM_GCRememberedSetFragment _fragment;
+	omrobjectptr_t _objects[TEST_OBJECT_COUNT];
+
+	virtual void SetUp()
+	{
+		OMR_VM *omrVM = gcTestEnv->exampleVM._omrVM;
+		MM_StartupManagerImpl startupManager(omrVM);
+
+		_omrVMThread = NULL;
+		_env = NULL;
+		_workPackets = NULL;
+		_rememberedSet = NULL;
+
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(omrVM, NULL, &_omrVMThread, "TestRememberedSetSATB"));
+		_env = MM_EnvironmentBase::getEnvironment(_omrVMThread);
+
+		MM_GCExtensionsBase *extensions = _env->getExtensions();
+		_markingScheme = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme();
+		uint8_t *heapBase = (uint8_t *)extensions->heap->getHeapBase();
+		ASSERT_TRUE((heapBase + (TEST_OBJECT_COUNT * TEST_OBJECT_STRIDE)) <= (uint8_t *)extensions->heap->getHeapTop());
+		for (uintptr_t i = 0; i < TEST_OBJECT_COUNT; i++) {
+			_objects[i] = (omrobjectptr_t)(heapBase + (i * TEST_OBJECT_STRIDE));
+			_markingScheme->getMarkMap()->clearBit(_objects[i]);
+		}
+
+		_workPackets = MM_WorkPacketsSATB::newInstance(_env);
+		ASSERT_TRUE(NULL != _workPackets);
+		_rememberedSet = MM_RememberedSetSATB::newInstance(_env, _workPackets, _markingScheme);
+		ASSERT_TRUE(NULL != _rememberedSet);
+
+		/* the barrier starts disabled */
+		_rememberedSet->restoreGlobalFragmentIndex(_env);
+		_rememberedSet->initializeFragment(_env, &_fragment);
+	}
+
+	virtual void TearDown()
+	{
+		for (uintptr_t i = 0; i < TEST_OBJECT_COUNT; i++) {
+			_markingScheme->getMarkMap()->clearBit(_objects[i]);
+		}
+		if (NULL != _rememberedSet) {
+			_rememberedSet->kill(_env);
+			_rememberedSet = NULL;
+		}
+		if (NULL != _workPackets) {
+			_workPackets->kill(_env);
+			_workPackets = NULL;
+		}
+		if (NULL != _omrVMThread) {
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(_omrVMThread));
+			_omrVMThread = NULL;
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(gcTestEnv->exampleVM._omrVM));
+	}
+
+	void remember(omrobjectptr_t object)
+	{
+		_rememberedSet->storeInFragment(_env, &_fragment, (UDATA *)object);
+	}
+
+	/**
+	 * Remember distinct objects until the current fragment is full, so that the next store publishes it.
+	 */
+	void fillFragment(uintptr_t first)
+	{
+		do {
+			remember(_objects[first % TEST_OBJECT_COUNT]);
+			first += 1;
+		} while (*_fragment.fragmentAlloc != *_fragment.fragmentTop);
+	}
+
+	uintptr_t fragmentFreeSlots()
+	{
+		return (uintptr_t)(*_fragment.fragmentTop - *_fragment.fragmentAlloc);
+	}
+};
+
+TEST_F(TestRememberedSetSATB, PublishedFragmentIsFiltered)
+{
+	uintptr_t slots = _rememberedSet->getFragmentSlots();
+	ASSERT_EQ(MM_WorkPackets::getSlotsInPacket(), slots);
+	ASSERT_TRUE(slots <= (2 * TEST_OBJECT_COUNT));
+
+	/* every object is remembered twice in a row, and every third one is already marked */
+	for (uintptr_t i = 0; i < (slots / 2); i++) {
+		if (0 == (i % 3)) {
+			_markingScheme->getMarkMap()->setBit(_objects[i]);
+		}
+	}
+	for (uintptr_t i = 0; i < slots; i++) {
+		remember(_objects[i / 2]);
+	}
+	EXPECT_EQ((uintptr_t)0, fragmentFreeSlots());
+
+	/* the next store publishes the full fragment */
+	remember(_objects[TEST_OBJECT_COUNT - 1]);
+
+	omrobjectptr_t expected[TEST_OBJECT_COUNT];
+	uintptr_t expectedCount = 0;
+	for (uintptr_t i = 0; i < (slots / 2); i++) {
+		if (0 != (i % 3)) {
+			expected[expectedCount] = _objects[i];
+			expectedCount += 1;
+		}
+	}
+
+	/* entries come back last in first, with the marked objects and the repeats gone */
+	MM_Packet *packet = _workPackets->getInputPacketNoWait(_env);
+	ASSERT_TRUE(NULL != packet);
+	uintptr_t poppedCount = 0;
+	for (void *entry = packet->pop(_env); NULL != entry; entry = packet->pop(_env)) {
+		ASSERT_TRUE(poppedCount < expectedCount);
+		poppedCount += 1;
+		EXPECT_EQ((void *)expected[expectedCount - poppedCount], entry);
+	}
+	EXPECT_EQ(expectedCount, poppedCount);
+	_workPackets->putPacket(_env, packet);
+}
+
+TEST_F(TestRememberedSetSATB, FragmentSlotsFollowUnpublishedShare)
+{
+	uintptr_t fullSlots = MM_WorkPackets::getSlotsInPacket();
+
+	/* one fragment is published, but more than a quarter of all entries are still held in fragments */
+	fillFragment(0);
+	remember(_objects[0]);
+	for (uintptr_t i = 1; i < (fullSlots / 2); i++) {
+		remember(_objects[i]);
+	}
+	_rememberedSet->tuneFragmentSlots(_env, _workPackets->moveInUseToNonEmpty(_env));
+	EXPECT_EQ(fullSlots / 2, _rememberedSet->getFragmentSlots());
+
+	/* the next fragment handed out is limited to the new size */
+	_rememberedSet->flushFragments(_env);
+	remember(_objects[0]);
+	EXPECT_EQ((fullSlots / 2) - 1, fragmentFreeSlots());
+
+	/* with almost every entry published, fragments grow back to a full packet */
+	fillFragment(1);
+	remember(_objects[0]);
+	_rememberedSet->tuneFragmentSlots(_env, 0);
+	EXPECT_EQ(fullSlots, _rememberedSet->getFragmentSlots());
+
+	/* each decision only counts the entries published since the previous one */
+	_rememberedSet->tuneFragmentSlots(_env, 1);
+	EXPECT_EQ(fullSlots / 2, _rememberedSet->getFragmentSlots());
+}
+
+TEST_F(TestRememberedSetSATB, FragmentSlotsStayWithinPacket)
+{
+	uintptr_t fullSlots = MM_WorkPackets::getSlotsInPacket();
+
+	for (uintptr_t i = 0; i < 32; i++) {
+		_rememberedSet->tuneFragmentSlots(_env, 1);
+	}
+	EXPECT_EQ((uintptr_t)SATB_FRAGMENT_MINIMUM_SLOTS, _rememberedSet->getFragmentSlots());
+
+	/* nothing published and nothing held leaves the size alone */
+	_rememberedSet->tuneFragmentSlots(_env, 0);
+	EXPECT_EQ((uintptr_t)SATB_FRAGMENT_MINIMUM_SLOTS, _rememberedSet->getFragmentSlots());
+
+	for (uintptr_t i = 0; i < 32; i++) {
+		fillFragment(i);
+		remember(_objects[i]);
+		_rememberedSet->tuneFragmentSlots(_env, 0);
+	}
+	EXPECT_EQ(fullSlots, _rememberedSet->getFragmentSlots());
+}
+
+#endif /* defined(OMR_GC_REALTIME) */
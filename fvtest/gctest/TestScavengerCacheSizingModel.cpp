@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ScavengerCacheSizingModel.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(TestScavengerCacheSizingModel, ScavengerCacheSizingModel)
+{
+    uintptr_t minimumSize = 8 * 1024;
+    uintptr_t maximumSize = 128 * 1024;
+    double aliasThreshold = 0.20;
+    uintptr_t threadCount = 16;
+    float starved = 0.50f;
+    float busy = 0.0f;
+
+    MM_ScavengerCacheSizingModel model;
+    model.initialize(minimumSize, maximumSize, aliasThreshold, 8);
+
+    /* starvation halves the maximum and inhibits aliasing sooner */
+    model.update(starved, 0, threadCount);
+    EXPECT_EQ(model.getMinimumSize(), minimumSize);
+    EXPECT_EQ(model.getMaximumSize(), maximumSize / 2);
+    EXPECT_DOUBLE_EQ(model.getAliasInhibitingThresholdPercentage(), aliasThreshold / 2);
+
+    /* sustained starvation collapses the maximum onto the minimum, and inhibits aliasing once a single thread waits */
+    for (uintptr_t cycle = 0; cycle < 64; cycle++) {
+        model.update(starved, 0, threadCount);
+    }
+    EXPECT_EQ(model.getMinimumSize(), minimumSize);
+    EXPECT_EQ(model.getMaximumSize(), minimumSize);
+    EXPECT_DOUBLE_EQ(model.getAliasInhibitingThresholdPercentage(), 1.0 / (double)threadCount);
+
+    /* caches filled completely restore aliasing and leave the bounds alone */
+    for (uintptr_t cycle = 0; cycle < 64; cycle++) {
+        model.update(busy, maximumSize, threadCount);
+    }
+    EXPECT_DOUBLE_EQ(model.getAliasInhibitingThresholdPercentage(), aliasThreshold);
+    EXPECT_EQ(model.getMaximumSize(), minimumSize);
+
+    /* caches refreshed long before they fill grow the maximum back first, then the minimum */
+    for (uintptr_t cycle = 0; cycle < 64; cycle++) {
+        model.update(busy, 0, threadCount);
+        EXPECT_LE(model.getMinimumSize(), model.getMaximumSize());
+        EXPECT_LE(model.getMaximumSize(), maximumSize);
+        EXPECT_EQ(model.getMaximumSize() % 8, 0);
+    }
+    EXPECT_EQ(model.getMaximumSize(), maximumSize);
+    EXPECT_EQ(model.getMinimumSize(), maximumSize / 2);
+
+    /* with two threads one waiting thread is more than the configured threshold, which is never exceeded */
+    MM_ScavengerCacheSizingModel twoThreads;
+    twoThreads.initialize(minimumSize, maximumSize, aliasThreshold, 8);
+    twoThreads.update(starved, 0, 2);
+    EXPECT_DOUBLE_EQ(twoThreads.getAliasInhibitingThresholdPercentage(), aliasThreshold);
+}
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "SweepIncrementBudgetModel.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(TestSweepIncrementBudgetModel, SweepIncrementBudgetModel)
+{
+    MM_SweepIncrementBudgetModel model;
+    model.initialize(500);
+
+    /* the cost model sizes the first batch */
+    EXPECT_EQ(model.getRegionsPerIncrement(80), 80);
+    EXPECT_EQ(model.getRegionsPerIncrement(0), 1);
+
+    /* 4 regions in 200us: 50us a region, so 10 regions fit 500us, and the cost model still bounds the batch */
+    model.startIncrement();
+    for (uint64_t region = 1; region <= 4; region++) {
+        EXPECT_FALSE(model.regionSwept(region * 50));
+    }
+    EXPECT_EQ(model.getRegionsPerIncrement(80), 10);
+    EXPECT_EQ(model.getRegionsPerIncrement(5), 5);
+
+    /* an increment is over budget once it has used up 500us, and the next one is timed from its own start */
+    model.startIncrement();
+    EXPECT_FALSE(model.regionSwept(499));
+    EXPECT_TRUE(model.regionSwept(1000));
+    EXPECT_EQ(model.getOverBudgetIncrements(), 1);
+    model.startIncrement();
+    EXPECT_FALSE(model.regionSwept(10));
+    EXPECT_EQ(model.getOverBudgetIncrements(), 1);
+
+    /* slow regions shrink the batch to one, and the cost carries over to later increments as regions get cheaper */
+    model.startIncrement();
+    EXPECT_TRUE(model.regionSwept(1000));
+    EXPECT_EQ(model.getRegionsPerIncrement(80), 1);
+    for (uintptr_t increment = 0; increment < 8; increment++) {
+        model.startIncrement();
+        EXPECT_FALSE(model.regionSwept(25));
+    }
+    EXPECT_LT(1, model.getRegionsPerIncrement(80));
+
+    /* without a budget the cost model batch is kept */
+    MM_SweepIncrementBudgetModel unbounded;
+    unbounded.initialize(0);
+    unbounded.startIncrement();
+    EXPECT_FALSE(unbounded.regionSwept(50000));
+    EXPECT_EQ(unbounded.getOverBudgetIncrements(), 0);
+    EXPECT_EQ(unbounded.getRegionsPerIncrement(80), 80);
+}
@@ -131,3 +131,31 @@ printMemUsed(const char *where, OMRPortLibrary *portLib)
 	/* memory info not supported */
 #endif /* defined(OMR_OS_WINDOWS) */
 }
+
+#if defined(GCTEST_SKIP_REPORTER)
+void
+GCTestSkipReporter::OnTestIterationEnd(const ::testing::UnitTest &unitTest, int iteration)
+{
+	std::vector<std::string> skipped;
+	for (int i = 0; i < unitTest.total_test_case_count(); i++) {
+		const ::testing::TestCase *testCase = unitTest.GetTestCase(i);
+		for (int j = 0; j < testCase->total_test_count(); j++) {
+			const ::testing::TestInfo *testInfo = testCase->GetTestInfo(j);
+			const ::testing::TestResult *result = testInfo->result();
+			for (int k = 0; k < result->test_property_count(); k++) {
+				const ::testing::TestProperty &property = result->GetTestProperty(k);
+				if (0 == strcmp(property.key(), "skipped")) {
+					skipped.push_back(std::string(testCase->name()) + "." + testInfo->name() + ": " + property.value());
+				}
+			}
+		}
+	}
+
+	if (!skipped.empty()) {
+		std::cout << "[  SKIPPED ] " << skipped.size() << " test(s) skipped, counted as passed below:" << std::endl;
+		for (std::vector<std::string>::const_iterator it = skipped.begin(); it != skipped.end(); ++it) {
+			std::cout << "[  SKIPPED ] " << *it << std::endl;
+		}
+	}
+}
+#endif /* defined(GCTEST_SKIP_REPORTER) */
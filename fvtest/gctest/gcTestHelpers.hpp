@@ -32,6 +32,8 @@
 #include "omrvm.h"
 #include "StartupManagerImpl.hpp"
 #include "testEnvironment.hpp"
+#include <iostream>
+#include <string>
 #include <vector>
 
 class GCTestEnvironment: public BaseEnvironment
@@ -65,6 +67,38 @@ public:
 	}
 };
 
+#if !defined(GTEST_SKIP)
+/**
+ * The bundled Google Test predates GTEST_SKIP(). Until it is updated, a skipped test reports the skip,
+ * records it as a property of the test in the generated results, and returns from the test body.
+ * Google Test still counts the test as passed, so GCTestSkipReporter lists the skipped tests again
+ * next to the run summary.
+ * Use it as GTEST_SKIP() << "reason";
+ */
+class GCTestSkipHelper
+{
+public:
+	void operator=(const ::testing::Message &message) const
+	{
+		const ::testing::TestInfo *const testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+		::testing::Test::RecordProperty("skipped", message.GetString());
+		std::cout << "[  SKIPPED ] " << testInfo->test_case_name() << "." << testInfo->name() << ": " << message << std::endl;
+	}
+};
+
+/**
+ * Lists the tests skipped by GTEST_SKIP() at the end of each iteration, as they are otherwise reported as passed.
+ */
+class GCTestSkipReporter : public ::testing::EmptyTestEventListener
+{
+public:
+	virtual void OnTestIterationEnd(const ::testing::UnitTest &unitTest, int iteration);
+};
+
+#define GCTEST_SKIP_REPORTER
+#define GTEST_SKIP() return GCTestSkipHelper() = ::testing::Message()
+#endif /* !defined(GTEST_SKIP) */
+
 /**
  * To help detect memory leaks, print out the amount of physical memory and virtual memory consumed by the test process.
  *
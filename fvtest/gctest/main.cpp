@@ -34,6 +34,9 @@ omr_main_entry(int argc, char **argv, char **envp)
 	::testing::InitGoogleTest(&argc, argv);
 
 	OMREventListener::setDefaultTestListener();
+#if defined(GCTEST_SKIP_REPORTER)
+	::testing::UnitTest::GetInstance()->listeners().Append(new GCTestSkipReporter());
+#endif /* defined(GCTEST_SKIP_REPORTER) */
 
 	gcTestEnv = (GCTestEnvironment *)testing::AddGlobalTestEnvironment(new GCTestEnvironment(argc, argv));
 	gcTestEnv->GCTestSetUp();
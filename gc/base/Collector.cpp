@@ -232,6 +232,27 @@ MM_Collector::preCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* subSpace, M
 		}
 	}
 
+	/* Drain the allocation-site samples of all threads and report the heaviest sites */
+	if (UDATA_MAX != extensions->allocationSiteSamplingBytesGranularity) {
+		MM_AllocationSiteStats *allocationSiteStats = &extensions->allocationSiteStats;
+		OMR_VMThread *omrVMThread = NULL;
+
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while (NULL != (omrVMThread = threadListIterator.nextOMRVMThread())) {
+			allocationSiteStats->merge(&MM_EnvironmentBase::getEnvironment(omrVMThread)->_allocationSiteSamples);
+		}
+		if (0 != allocationSiteStats->_samples) {
+			allocationSiteStats->sort();
+			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+			TRIGGER_J9HOOK_MM_PRIVATE_ALLOCATION_SITES_SAMPLED(
+				extensions->privateHookInterface,
+				env->getOmrVMThread(),
+				omrtime_hires_clock(),
+				J9HOOK_MM_PRIVATE_ALLOCATION_SITES_SAMPLED);
+			allocationSiteStats->clear();
+		}
+	}
+
 	_bytesRequested = (allocDescription ? allocDescription->getBytesRequested() : 0);
 
 	internalPreCollect(env, subSpace, allocDescription, gcCode);
@@ -494,6 +494,15 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 	}
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
+	/* with node-local GC work lists each affinity leader needs at least one sublist of its own */
+	uintptr_t affinityLeaderCount = extensions->_numaManager.getAffinityLeaderCount();
+	if (extensions->numaAwareParallelGC && (1 < affinityLeaderCount)) {
+		extensions->packetListSplit = MM_Math::roundToCeiling(affinityLeaderCount, extensions->packetListSplit);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		extensions->cacheListSplit = MM_Math::roundToCeiling(affinityLeaderCount, extensions->cacheListSplit);
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	}
+
 	/* initialize default split freelist split amount */
 	if (0 == extensions->splitFreeListSplitAmount) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -506,6 +515,11 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 			extensions->splitFreeListSplitAmount = (omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE) - 1) / 8  +  1;
 		}
 	}
+
+	/* with node-local free lists each affinity leader needs at least one free list of its own */
+	if (extensions->numaSplitFreeList && (1 < affinityLeaderCount)) {
+		extensions->splitFreeListSplitAmount = MM_Math::roundToCeiling(affinityLeaderCount, extensions->splitFreeListSplitAmount);
+	}
 }
 
 bool
@@ -106,8 +106,8 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 	}
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
-	/* Disable dynamic depth copying if scavengerDynamicBreadthFirstScanOrdering is not selected */ 
-	if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST != extensions->scavengerScanOrdering) {
+	/* Disable dynamic depth copying if neither scavengerDynamicBreadthFirstScanOrdering nor hot field co-location is selected */
+	if ((MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST != extensions->scavengerScanOrdering) && (0 == extensions->scavengerHotFieldCoLocation)) {
 		disableHotFieldDepthCopy();
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
@@ -126,6 +126,7 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 		if (NULL == _regionLocalFull) {
 			return false;
 		}
+		_sweepIncrementBudget.initialize(extensions->sweepIncrementMicro);
 	}
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
@@ -28,6 +28,7 @@
 #include "omr.h"
 #include "thread_api.h"
 
+#include "AllocationSiteStats.hpp"
 #include "BaseVirtual.hpp"
 #include "CardCleaningStats.hpp"
 #include "CycleState.hpp"
@@ -39,6 +40,7 @@
 #include "MarkStats.hpp"
 #include "RootScannerStats.hpp"
 #include "ScavengerStats.hpp"
+#include "SweepIncrementBudgetModel.hpp"
 #include "SweepStats.hpp"
 #include "WorkPacketStats.hpp"
 #include "WorkStack.hpp"
@@ -78,6 +80,7 @@ class MM_EnvironmentBase : public MM_BaseVirtual
 private:
 	uintptr_t _workerID;
 	uintptr_t _environmentId;
+	uintptr_t _numaNode; /**< The affinity leader (1-based, 0 for none) this GC thread was bound to by the dispatcher under -Xgc:numaAwareParallelGC */
 
 protected:
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
@@ -149,6 +152,8 @@ public:
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 	uintptr_t _traceAllocationBytes;  /**< Tracks the bytes allocated since the last object trace */
 	uintptr_t _traceAllocationBytesCurrentTLH; /**< keep the bytes of times of sampling threshold for last object trace(include allocation bytes inside TLH) */
+	uintptr_t _allocationSiteSampleBytes; /**< Tracks the bytes allocated since the last allocation-site sample */
+	MM_AllocationSiteSampleBuffer _allocationSiteSamples; /**< Allocation-site samples taken by this thread since the last collection */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
@@ -162,6 +167,7 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedAllocationTracker* _allocationTracker; /**< tracks bytes allocated per thread and periodically flushes allocation data to MM_MemoryPoolSegregated */
+	MM_SweepIncrementBudgetModel _sweepIncrementBudget; /**< sizes and times this thread's small region sweep increments, keeping its sweep cost across increments and cycles */
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
 	volatile uint32_t _allocationColor; /**< Flag field to indicate whether premarking is enabled on the thread */
@@ -359,6 +365,17 @@ public:
 	 */
 	MMINLINE void setWorkerID(uintptr_t workerID) { _workerID = workerID; }
 
+	/**
+	 * Get the NUMA node the GC thread was bound to for node-local GC work distribution.
+	 * @return the affinity leader index, where 1 is the first node (0 indicates no binding)
+	 */
+	MMINLINE uintptr_t getNumaNode() { return _numaNode; }
+
+	/**
+	 * Sets the NUMA node the GC thread was bound to.
+	 */
+	MMINLINE void setNumaNode(uintptr_t numaNode) { _numaNode = numaNode; }
+
 	/**
 	 * Enguires if this thread is the main.
 	 * return true if the thread is the main thread, false otherwise.
@@ -426,6 +443,11 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return _delegate.objectAllocationNotify(omrObject); }
 
+	/**
+	 * Return the allocation site (method dictionary key of the allocating method) of the current allocation.
+	 */
+	const void *getAllocationSite() { return _delegate.getAllocationSite(); }
+
 	/**
 	 *	Verbose: allocation Failure Start Report if required
 	 *	set flag allocation Failure Start Report required
@@ -558,11 +580,11 @@ public:
 		_hotFieldCopyDepthCount = getExtensions()->depthCopyMax;
 	}
 	/**
-	 * Enable scavenger hot field depth copying for dynamicBreadthFirstScanOrdering
+	 * Enable scavenger hot field depth copying for dynamicBreadthFirstScanOrdering or hot field co-location
 	 */
 	MMINLINE void enableHotFieldDepthCopy()
 	{ 
-		if (getExtensions()->scavengerScanOrdering == MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST) {
+		if ((getExtensions()->scavengerScanOrdering == MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST) || (0 != getExtensions()->scavengerHotFieldCoLocation)) {
 			_hotFieldCopyDepthCount = 0;
 		}
 	}
@@ -696,6 +718,7 @@ public:
 		MM_BaseVirtual()
 		,_workerID(0)
 		,_environmentId(0)
+		,_numaNode(0)
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 		, _compressObjectReferences(OMRVMTHREAD_COMPRESS_OBJECT_REFERENCES(omrVMThread))
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
@@ -733,6 +756,8 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSiteSampleBytes(0)
+		,_allocationSiteSamples()
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -754,6 +779,7 @@ public:
 		MM_BaseVirtual()
 		,_workerID(0)
 		,_environmentId(0)
+		,_numaNode(0)
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 		, _compressObjectReferences(OMRVM_COMPRESS_OBJECT_REFERENCES(omrVM))
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
@@ -790,6 +816,8 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSiteSampleBytes(0)
+		,_allocationSiteSamples()
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "FreeEntrySizeClassCache.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "LargeObjectAllocateStats.hpp"
+
+MM_FreeEntrySizeClassCache *
+MM_FreeEntrySizeClassCache::newInstance(MM_EnvironmentBase *env, MM_LargeObjectAllocateStats *largeObjectAllocateStats, uintptr_t minimumSize, uintptr_t maximumSize)
+{
+	MM_FreeEntrySizeClassCache *cache = (MM_FreeEntrySizeClassCache *)env->getForge()->allocate(sizeof(MM_FreeEntrySizeClassCache), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != cache) {
+		new(cache) MM_FreeEntrySizeClassCache(env, largeObjectAllocateStats, minimumSize, maximumSize);
+		if (!cache->initialize(env)) {
+			cache->kill(env);
+			cache = NULL;
+		}
+	}
+	return cache;
+}
+
+void
+MM_FreeEntrySizeClassCache::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_FreeEntrySizeClassCache::initialize(MM_EnvironmentBase *env)
+{
+	if ((0 == _minimumSize) || (_minimumSize > _maximumSize)) {
+		return false;
+	}
+
+	_firstSizeClassIndex = _largeObjectAllocateStats->getSizeClassIndex(_minimumSize);
+	uintptr_t lastSizeClassIndex = _largeObjectAllocateStats->getSizeClassIndex(_maximumSize);
+	_sizeClassCount = (lastSizeClassIndex - _firstSizeClassIndex) + 2;
+
+	_sizeClasses = (SizeClass *)env->getForge()->allocate(_sizeClassCount * sizeof(SizeClass), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _sizeClasses) {
+		return false;
+	}
+	reset();
+
+	return true;
+}
+
+void
+MM_FreeEntrySizeClassCache::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sizeClasses) {
+		env->getForge()->free(_sizeClasses);
+		_sizeClasses = NULL;
+	}
+}
+
+void
+MM_FreeEntrySizeClassCache::reset()
+{
+	for (uintptr_t slot = 0; slot < _sizeClassCount; slot++) {
+		SizeClass *sizeClass = &_sizeClasses[slot];
+		sizeClass->_head = 0;
+		sizeClass->_freeBytes = 0;
+		sizeClass->_freeEntryCount = 0;
+		sizeClass->_fillTail = NULL;
+	}
+}
+
+uintptr_t
+MM_FreeEntrySizeClassCache::getSlot(uintptr_t freeEntrySize)
+{
+	uintptr_t slot = 0;
+	if (freeEntrySize >= _minimumSize) {
+		uintptr_t sizeClassIndex = _largeObjectAllocateStats->getSizeClassIndex(freeEntrySize);
+		if (sizeClassIndex >= _firstSizeClassIndex) {
+			slot = OMR_MIN((sizeClassIndex - _firstSizeClassIndex) + 1, _sizeClassCount - 1);
+		}
+	}
+	return slot;
+}
+
+bool
+MM_FreeEntrySizeClassCache::fill(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t freeEntrySize)
+{
+	if ((freeEntrySize < _minimumSize) || (freeEntrySize > _maximumSize)) {
+		return false;
+	}
+
+	SizeClass *sizeClass = &_sizeClasses[getSlot(freeEntrySize)];
+	freeEntry->setNext(NULL, _compressObjectReferences);
+	if (NULL == sizeClass->_fillTail) {
+		sizeClass->_head = (uintptr_t)freeEntry;
+	} else {
+		sizeClass->_fillTail->setNext(freeEntry, _compressObjectReferences);
+	}
+	sizeClass->_fillTail = freeEntry;
+	sizeClass->_freeBytes += freeEntrySize;
+	sizeClass->_freeEntryCount += 1;
+
+	return true;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeClassCache::pop(SizeClass *sizeClass, uintptr_t minimumSize)
+{
+	uintptr_t head = sizeClass->_head;
+	while (0 != head) {
+		/* The head may be claimed by another thread while we look at it, in which case the values read
+		 * here are meaningless but the exchange below fails and we retry with the new head.
+		 */
+		MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)head;
+		uintptr_t freeEntrySize = freeEntry->getSize();
+		if (freeEntrySize < minimumSize) {
+			break;
+		}
+		uintptr_t next = (uintptr_t)freeEntry->getNext(_compressObjectReferences);
+		uintptr_t value = MM_AtomicOperations::lockCompareExchange(&sizeClass->_head, head, next);
+		if (value == head) {
+			MM_AtomicOperations::subtract(&sizeClass->_freeBytes, freeEntrySize);
+			MM_AtomicOperations::subtract(&sizeClass->_freeEntryCount, 1);
+			return freeEntry;
+		}
+		head = value;
+	}
+	return NULL;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeClassCache::allocate(uintptr_t sizeInBytesRequired)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = NULL;
+	for (uintptr_t slot = getSlot(sizeInBytesRequired); (NULL == freeEntry) && (slot < _sizeClassCount); slot++) {
+		freeEntry = pop(&_sizeClasses[slot], sizeInBytesRequired);
+	}
+	return freeEntry;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeClassCache::allocateRemainder()
+{
+	return pop(&_sizeClasses[0], 0);
+}
+
+void
+MM_FreeEntrySizeClassCache::push(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t freeEntrySize)
+{
+	SizeClass *sizeClass = &_sizeClasses[getSlot(freeEntrySize)];
+
+	/* Count the entry before publishing it so that detachAll() never sees the counters go negative */
+	MM_AtomicOperations::add(&sizeClass->_freeBytes, freeEntrySize);
+	MM_AtomicOperations::add(&sizeClass->_freeEntryCount, 1);
+
+	uintptr_t head = sizeClass->_head;
+	while (true) {
+		freeEntry->setNext((MM_HeapLinkedFreeHeader *)head, _compressObjectReferences);
+		uintptr_t value = MM_AtomicOperations::lockCompareExchange(&sizeClass->_head, head, (uintptr_t)freeEntry);
+		if (value == head) {
+			break;
+		}
+		head = value;
+	}
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeClassCache::detachAll(uintptr_t *freeEntryCount, uintptr_t *freeBytes)
+{
+	MM_HeapLinkedFreeHeader *detached = NULL;
+	uintptr_t detachedCount = 0;
+	uintptr_t detachedBytes = 0;
+
+	for (uintptr_t slot = 0; slot < _sizeClassCount; slot++) {
+		SizeClass *sizeClass = &_sizeClasses[slot];
+		uintptr_t head = sizeClass->_head;
+		while (0 != head) {
+			uintptr_t value = MM_AtomicOperations::lockCompareExchange(&sizeClass->_head, head, 0);
+			if (value == head) {
+				break;
+			}
+			head = value;
+		}
+		sizeClass->_fillTail = NULL;
+
+		if (0 != head) {
+			uintptr_t slotCount = 0;
+			uintptr_t slotBytes = 0;
+			MM_HeapLinkedFreeHeader *tail = (MM_HeapLinkedFreeHeader *)head;
+			while (true) {
+				slotCount += 1;
+				slotBytes += tail->getSize();
+				MM_HeapLinkedFreeHeader *next = tail->getNext(_compressObjectReferences);
+				if (NULL == next) {
+					break;
+				}
+				tail = next;
+			}
+			tail->setNext(detached, _compressObjectReferences);
+			detached = (MM_HeapLinkedFreeHeader *)head;
+
+			MM_AtomicOperations::subtract(&sizeClass->_freeBytes, slotBytes);
+			MM_AtomicOperations::subtract(&sizeClass->_freeEntryCount, slotCount);
+			detachedCount += slotCount;
+			detachedBytes += slotBytes;
+		}
+	}
+
+	*freeEntryCount = detachedCount;
+	*freeBytes = detachedBytes;
+
+	return sortByAddress(detached, detachedCount);
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeClassCache::sortByAddress(MM_HeapLinkedFreeHeader *freeEntries, uintptr_t freeEntryCount)
+{
+	if (freeEntryCount < 2) {
+		return freeEntries;
+	}
+
+	uintptr_t leftCount = freeEntryCount / 2;
+	MM_HeapLinkedFreeHeader *leftTail = freeEntries;
+	for (uintptr_t i = 1; i < leftCount; i++) {
+		leftTail = leftTail->getNext(_compressObjectReferences);
+	}
+	MM_HeapLinkedFreeHeader *right = leftTail->getNext(_compressObjectReferences);
+	leftTail->setNext(NULL, _compressObjectReferences);
+
+	MM_HeapLinkedFreeHeader *left = sortByAddress(freeEntries, leftCount);
+	right = sortByAddress(right, freeEntryCount - leftCount);
+
+	MM_HeapLinkedFreeHeader *head = NULL;
+	MM_HeapLinkedFreeHeader *tail = NULL;
+	while ((NULL != left) || (NULL != right)) {
+		MM_HeapLinkedFreeHeader *next = NULL;
+		if ((NULL == right) || ((NULL != left) && (left < right))) {
+			next = left;
+			left = left->getNext(_compressObjectReferences);
+		} else {
+			next = right;
+			right = right->getNext(_compressObjectReferences);
+		}
+		if (NULL == tail) {
+			head = next;
+		} else {
+			tail->setNext(next, _compressObjectReferences);
+		}
+		tail = next;
+	}
+	tail->setNext(NULL, _compressObjectReferences);
+
+	return head;
+}
+
+uintptr_t
+MM_FreeEntrySizeClassCache::getFreeBytes()
+{
+	uintptr_t freeBytes = 0;
+	for (uintptr_t slot = 0; slot < _sizeClassCount; slot++) {
+		freeBytes += _sizeClasses[slot]._freeBytes;
+	}
+	return freeBytes;
+}
+
+uintptr_t
+MM_FreeEntrySizeClassCache::getFreeEntryCount()
+{
+	uintptr_t freeEntryCount = 0;
+	for (uintptr_t slot = 0; slot < _sizeClassCount; slot++) {
+		freeEntryCount += _sizeClasses[slot]._freeEntryCount;
+	}
+	return freeEntryCount;
+}
+
+bool
+MM_FreeEntrySizeClassCache::isEmpty()
+{
+	for (uintptr_t slot = 0; slot < _sizeClassCount; slot++) {
+		if (0 != _sizeClasses[slot]._head) {
+			return false;
+		}
+	}
+	return true;
+}
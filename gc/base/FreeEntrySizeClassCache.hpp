@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(FREEENTRYSIZECLASSCACHE_HPP_)
+#define FREEENTRYSIZECLASSCACHE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+
+class MM_LargeObjectAllocateStats;
+
+/**
+ * Per size class stacks of free entries kept in front of an address ordered free list.
+ * Entries are moved in at the end of a stop-the-world sweep and popped by allocating threads with a
+ * compare and swap, without the pool lock.  Size classes are those of the pool's MM_FreeEntrySizeClassStats.
+ * Slot 0 holds entries smaller than the first cached size class (allocation remainders), which only feed TLHs
+ * and small allocates.
+ *
+ * Entries are only ever pushed by the sweep (while mutators are stopped) or as the unused tail of an entry
+ * that was just popped.  An address can therefore not reappear at the head of a stack while another thread
+ * is still between reading and swapping that head, which keeps the pop free of ABA problems.
+ */
+class MM_FreeEntrySizeClassCache : public MM_BaseVirtual
+{
+public:
+protected:
+private:
+	struct SizeClass {
+		volatile uintptr_t _head; /**< First cached free entry (MM_HeapLinkedFreeHeader *), linked through the free header next pointers */
+		volatile uintptr_t _freeBytes; /**< Bytes currently held by this size class */
+		volatile uintptr_t _freeEntryCount; /**< Entries currently held by this size class */
+		MM_HeapLinkedFreeHeader *_fillTail; /**< Last entry appended during fill(), keeps the sweep's address order */
+	};
+
+	SizeClass *_sizeClasses; /**< Remainder slot followed by one slot per cached size class */
+	uintptr_t _sizeClassCount; /**< Number of slots in _sizeClasses */
+	uintptr_t _firstSizeClassIndex; /**< Free entry size class index held by _sizeClasses[1] */
+	uintptr_t _minimumSize; /**< Smallest entry moved in by the sweep */
+	uintptr_t _maximumSize; /**< Largest entry moved in by the sweep */
+	MM_LargeObjectAllocateStats *_largeObjectAllocateStats; /**< Owning pool's stats, used to map sizes to size classes */
+	bool const _compressObjectReferences;
+
+	volatile uintptr_t _allocCount; /**< Allocations satisfied from the cache since the last resetAllocateStats() */
+	volatile uintptr_t _allocBytes; /**< Bytes allocated from the cache since the last resetAllocateStats() */
+	volatile uintptr_t _allocDiscardedBytes; /**< Remainders too small to keep since the last resetAllocateStats() */
+
+public:
+	static MM_FreeEntrySizeClassCache *newInstance(MM_EnvironmentBase *env, MM_LargeObjectAllocateStats *largeObjectAllocateStats, uintptr_t minimumSize, uintptr_t maximumSize);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Empty the cache without touching the entries.  Only valid while no thread can allocate from the cache,
+	 * e.g. when the owning pool is being rebuilt.
+	 */
+	void reset();
+
+	/**
+	 * Append a free entry to the stack of its size class if the entry is within the cached range.
+	 * Single threaded, called by the sweep while mutators are stopped.  Entries must be offered in address order.
+	 * @return true if the entry was taken (its next pointer has been overwritten), false otherwise
+	 */
+	bool fill(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t freeEntrySize);
+
+	/**
+	 * Pop an entry of at least the given size, scanning from the size class of the request upwards.
+	 * Thread safe.
+	 * @return the entry, or NULL if no size class head was large enough
+	 */
+	MM_HeapLinkedFreeHeader *allocate(uintptr_t sizeInBytesRequired);
+
+	/**
+	 * Pop any entry from the remainder slot.  Thread safe.
+	 * @return the entry, or NULL if the remainder slot is empty
+	 */
+	MM_HeapLinkedFreeHeader *allocateRemainder();
+
+	/**
+	 * Push a free entry (typically the unused tail of a popped entry).  Thread safe.
+	 */
+	void push(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t freeEntrySize);
+
+	/**
+	 * Detach every cached entry.  Thread safe with respect to concurrent pops and pushes.
+	 * @param[out] freeEntryCount number of detached entries
+	 * @param[out] freeBytes size of the detached entries
+	 * @return the detached entries, linked in ascending address order
+	 */
+	MM_HeapLinkedFreeHeader *detachAll(uintptr_t *freeEntryCount, uintptr_t *freeBytes);
+
+	/**
+	 * Account for bytes handed out of a popped entry, or dropped because they were too small to keep.
+	 */
+	MMINLINE void recordAllocate(uintptr_t allocBytes, uintptr_t discardedBytes)
+	{
+		MM_AtomicOperations::add(&_allocCount, 1);
+		MM_AtomicOperations::add(&_allocBytes, allocBytes);
+		if (0 != discardedBytes) {
+			MM_AtomicOperations::add(&_allocDiscardedBytes, discardedBytes);
+		}
+	}
+
+	MMINLINE uintptr_t getAllocCount() { return _allocCount; }
+	MMINLINE uintptr_t getAllocBytes() { return _allocBytes; }
+	MMINLINE uintptr_t getAllocDiscardedBytes() { return _allocDiscardedBytes; }
+	MMINLINE void resetAllocateStats()
+	{
+		_allocCount = 0;
+		_allocBytes = 0;
+		_allocDiscardedBytes = 0;
+	}
+
+	/**
+	 * @return bytes currently held by the cache
+	 */
+	uintptr_t getFreeBytes();
+
+	/**
+	 * @return entries currently held by the cache
+	 */
+	uintptr_t getFreeEntryCount();
+
+	/**
+	 * @return true if the cache holds no entry (racy, for use as a hint only)
+	 */
+	bool isEmpty();
+
+	MM_FreeEntrySizeClassCache(MM_EnvironmentBase *env, MM_LargeObjectAllocateStats *largeObjectAllocateStats, uintptr_t minimumSize, uintptr_t maximumSize)
+		: MM_BaseVirtual()
+		, _sizeClasses(NULL)
+		, _sizeClassCount(0)
+		, _firstSizeClassIndex(0)
+		, _minimumSize(minimumSize)
+		, _maximumSize(maximumSize)
+		, _largeObjectAllocateStats(largeObjectAllocateStats)
+		, _compressObjectReferences(env->compressObjectReferences())
+		, _allocCount(0)
+		, _allocBytes(0)
+		, _allocDiscardedBytes(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * @return the slot holding entries of the given size, 0 for sizes below the first cached size class
+	 */
+	uintptr_t getSlot(uintptr_t freeEntrySize);
+
+	/**
+	 * Pop the head of a slot if it is at least the given size.
+	 */
+	MM_HeapLinkedFreeHeader *pop(SizeClass *sizeClass, uintptr_t minimumSize);
+
+	/**
+	 * Sort a NULL terminated chain of free entries by address.
+	 */
+	MM_HeapLinkedFreeHeader *sortByAddress(MM_HeapLinkedFreeHeader *freeEntries, uintptr_t freeEntryCount);
+};
+
+#endif /* FREEENTRYSIZECLASSCACHE_HPP_ */
@@ -30,6 +30,7 @@
 #include "modronbase.h"
 #include "omr.h"
 
+#include "AllocationSiteStats.hpp"
 #include "AllocationStats.hpp"
 #include "ArrayObjectModel.hpp"
 #include "BaseVirtual.hpp"
@@ -102,6 +103,15 @@ class HeapRegionStateTable;
 #define DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE 512
 #define DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE 16384
 
+/* Upper bound on the number of referents held in the marking prefetch FIFO (see -Xgc:markingPrefetchDepth=). */
+#define MARKING_PREFETCH_DEPTH_MAXIMUM 16
+
+/* Upper bound on the number of hot children the scavenger copies adjacent to their parent (see -Xgc:hotFieldCoLocation=). */
+#define HOT_FIELD_CO_LOCATION_MAXIMUM 8
+
+/* Upper bound on the per-thread TLH refresh target between collections (see -Xgc:tlhRefreshTarget=). */
+#define TLH_REFRESH_TARGET_MAXIMUM 4096
+
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
@@ -319,6 +329,10 @@ public:
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
 
+	uintptr_t allocationSiteSamplingBytesGranularity; /**< How often (in bytes allocated by a thread) the allocating site is sampled, UDATA_MAX disables allocation-site sampling */
+	uintptr_t allocationSiteSamplingDepth; /**< # of heaviest allocation sites reported at each collection */
+	MM_AllocationSiteStats allocationSiteStats; /**< Allocation-site samples of all threads, aggregated at the start of each collection */
+
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
 	uintptr_t largeObjectAllocationProfilingThreshold; /**< object size threshold above which the object is large enough for allocation profiling */
@@ -346,6 +360,7 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	uintptr_t tlhRefreshTarget; /**< Number of TLH refreshes per thread between collections the adaptive TLH sizing aims for (set through -Xgc:tlhRefreshTarget=).  0 keeps the fixed increment scheme */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 
@@ -387,6 +402,10 @@ public:
 	float pageFragmentationCompactThreshold; /**< Enables compaction when page-fragmented memory and dark matter exceed this limit. The larger this number, the more memory can be fragmented before compact is triggered **/
 
 	uintptr_t parSweepChunkSize;
+	bool lazySweep; /**< Enabled by -Xgc:lazySweep.  End the global GC pause after marking and sweep the remaining chunks on demand as allocation exhausts the free list */
+	bool freeEntrySizeClassCache; /**< Enabled by -Xgc:freeEntrySizeClassCache.  After a stop-the-world sweep, move mid sized free entries of the address ordered tenure pool into lock free per size class stacks */
+	uintptr_t freeEntrySizeClassCacheMinimumSize; /**< Smallest free entry moved into the size class cache */
+	uintptr_t freeEntrySizeClassCacheMaximumSize; /**< Largest free entry moved into the size class cache, and largest object allocated from it */
 	uintptr_t heapExpansionMinimumSize;
 	uintptr_t heapExpansionMaximumSize;
 	uintptr_t heapFreeMinimumRatioDivisor;
@@ -399,6 +418,8 @@ public:
 
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	uintptr_t pauseTimeGoal; /**< Longest stop-the-world pause in milliseconds the heap is sized for (set through -Xgc:pauseTimeGoal=).  0 keeps the free ratio and GC time ratio heuristics */
+	uintptr_t throughputGoal; /**< Percentage of time outside GC the heap is sized for under a pause time goal (set through -Xgc:throughputGoal=) */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */
@@ -406,6 +427,8 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workStealingMarking; /**< Enabled by -Xgc:workStealingMarking.  Distribute stop-the-world marking work through per-thread work-stealing deques instead of the shared packet lists */
+	uintptr_t markingPrefetchDepth; /**< set by -Xgc:markingPrefetchDepth=.  Number of referents whose mark word and header are prefetched before being marked (0 disables the prefetch FIFO) */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -488,6 +511,7 @@ public:
 	uint32_t maxHotFieldListLength;
 	uintptr_t minCpuUtil;
 	/* End of options relating to dynamicBreadthFirstScanOrdering */
+	uintptr_t scavengerHotFieldCoLocation; /**< set by -Xgc:hotFieldCoLocation=.  Number of sampled hot children copied immediately after their parent, up to depthCopyMax deep (0 disables co-location) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	uintptr_t scvTenureRatioHigh;
 	uintptr_t scvTenureRatioLow;
@@ -500,6 +524,7 @@ public:
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
+	bool scavengerRememberedSetOverflowCards; /**< Enabled by -Xgc:rememberedSetOverflowCards.  Record remembered objects on a card table when the remembered set overflows so overflow handling walks only dirty cards */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS, complimentary to concurrentScavengerHWSupport with CS active */
@@ -550,6 +575,7 @@ public:
 	float adaptiveThreadingWeightActiveThreads; /**< Weight given to current active threads when averaging projected threads with current active threads (set through adaptiveThreadingWeightActiveThreads=) */
 	float adaptiveThreadBooster; /**< Used to boost calculated thread count, gives opportunity for low thread count to grow. */
 	/* End of variables relating to Adaptive Threading */
+	bool adaptiveScanCacheSizing; /**< Enabled by -Xgc:adaptiveScanCacheSizing.  Retune the copy-scan cache size bounds and copy cache aliasing threshold after each scavenge from the cycle's stall and cache refresh statistics */
 
 	enum HeapInitializationSplitHeapSection {
 		HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN = 0,
@@ -585,6 +611,9 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool summaryCompaction; /**< Enabled by -Xgc:summaryCompaction.  Slide each region to its base using forwarding addresses summarized per mark map word, so that the move and fixup phases run fully in parallel */
+	uintptr_t incrementalCompactionBudget; /**< set by -Xgc:incrementalCompactionBudget=.  Maximum live bytes moved by one non-aggressive compaction, the most fragmented subAreas being compacted first and the rest left for following global collections (0 compacts the whole heap) */
+	uintptr_t incrementalCompactionGarbageThreshold; /**< set by -Xgc:incrementalCompactionGarbageThreshold=.  Percentage of a subArea which must be free for an incremental compaction to move it; denser subAreas are left in place and their gaps returned to the free list */
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	bool payAllocationTax;
@@ -597,6 +626,7 @@ public:
 	bool optimizeConcurrentWB;
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
+	uintptr_t concurrentBackgroundMax; /**< size of the elastic concurrent helper pool; helpers above concurrentBackground are only activated on idle CPUs while mutators pay allocation tax */
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
@@ -706,7 +736,11 @@ public:
 	uintptr_t allocationCacheMaximumSize;
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
+	uintptr_t allocationCacheHotMaximumSize; /**< Upper bound of the replenish size for a size class a thread allocates heavily from (may cover a whole region) */
+	uintptr_t allocationCacheHotAllocationRate; /**< Bytes per millisecond a thread has to pre-allocate from a size class at for the size class to be hot */
+	uintptr_t allocationCacheHotFootprint; /**< Upper bound of the sum of the replenish sizes of the hot size classes of one thread */
 	bool nonDeterministicSweep;
+	uintptr_t sweepIncrementMicro; /**< Time budget of one segregated small region sweep increment in microseconds, 0 for no budget */
 /* OMR_GC_REALTIME (in for all) */
 
 	MM_ConfigurationOptions configurationOptions; /**< holds the options struct, used during startup for selecting a Configuration */
@@ -718,6 +752,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Queue logs (e.g. verbose:gc) written to a file in a ring buffer drained by a dedicated I/O thread */
+	uintptr_t asyncLoggingBufferSize; /**< Size of the ring buffer used by -Xgc:asyncLogging (set through -Xgc:asyncLoggingBufferSize=); records which do not fit are dropped and counted */
+	bool verboseBinaryFormat; /**< Enabled by -Xgc:verboseBinaryFormat.  Write verbose:gc log files in the compact binary format of VerboseBinaryFormat.hpp instead of XML */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -752,6 +789,8 @@ public:
 	uintptr_t regionSize; /**< The size, in bytes, of a fixed-size table-backed region of the heap (does not apply to AUX regions) */
 	MM_NUMAManager _numaManager; /**< The object which abstracts the details of our NUMA support so that the GCExtensions and the callers don't need to duplicate the support to interpret our intention */
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
+	bool numaSplitFreeList; /**< Enabled by -Xgc:numaSplitFreeList.  Give each NUMA node a contiguous share of the heap and of the split free lists, and draw TLHs from the lists of the allocating thread's node first */
+	bool numaAwareParallelGC; /**< Enabled by -Xgc:numaAwareParallelGC.  Bind GC threads to NUMA nodes and split packet and scan cache lists per node, taking work from remote nodes only when local lists are empty */
 
 	bool padToPageSize;
 
@@ -858,6 +897,8 @@ public:
 	bool pretouchHeapOnExpand; /**< True to pretouch memory during initial heap inflation or heap expansion */
 
 	uintptr_t decommitMinimumFree; /**< percentage of free heap to be retained as committed, default=0 for gencon, complete tenture free memory will be decommitted */
+	bool releaseFreePagesAfterGlobalGC; /**< Enabled by -Xgc:releaseFreePagesAfterGC.  After each global GC, decommit the tenure free memory not expected to be allocated before the next one */
+	uintptr_t releaseFreePagesGranule; /**< Alignment and minimum size of a range released by -Xgc:releaseFreePagesAfterGC (set through -Xgc:releaseFreePagesGranule=), so that transparent huge pages are released whole */
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
@@ -1529,6 +1570,9 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSiteSamplingBytesGranularity(UDATA_MAX) /* default UDATA_MAX (disabled) */
+		, allocationSiteSamplingDepth(16)
+		, allocationSiteStats()
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1550,6 +1594,7 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, tlhRefreshTarget(0)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
 		, allocationStats()
@@ -1579,6 +1624,10 @@ public:
 		, darkMatterCompactThreshold((float)0.15)
 		, pageFragmentationCompactThreshold((float)0.10)
 		, parSweepChunkSize(0)
+		, lazySweep(false)
+		, freeEntrySizeClassCache(false)
+		, freeEntrySizeClassCacheMinimumSize(8 * 1024)
+		, freeEntrySizeClassCacheMaximumSize(64 * 1024)
 		, heapExpansionMinimumSize(1024 * 1024)
 		, heapExpansionMaximumSize(0)
 		, heapFreeMinimumRatioDivisor(100)
@@ -1589,11 +1638,15 @@ public:
 		, heapContractionGCRatioThreshold()
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, pauseTimeGoal(0)
+		, throughputGoal(95)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workStealingMarking(false)
+		, markingPrefetchDepth(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1658,6 +1711,7 @@ public:
 		, maxHotFieldListLength(10)
 		, minCpuUtil (1)
 		/* End of options relating to dynamicBreadthFirstScanOrdering */
+		, scavengerHotFieldCoLocation(0)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, scvTenureRatioHigh(OMR_SCV_TENURE_RATIO_HIGH)
@@ -1671,6 +1725,7 @@ public:
 		, scvTenureStrategyHistory(true)
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
+		, scavengerRememberedSetOverflowCards(false)
 		, cacheListSplit(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
@@ -1716,6 +1771,7 @@ public:
 		, adaptiveThreadingSensitivityFactor(1.0f)
 		, adaptiveThreadingWeightActiveThreads(0.50f)
 		, adaptiveThreadBooster(0.85f)
+		, adaptiveScanCacheSizing(false)
 		, splitHeapSection(HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN)
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 		, globalMaximumContraction(0.05) /* by default, contract must be at most 5% of the committed heap */
@@ -1739,6 +1795,9 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, summaryCompaction(false)
+		, incrementalCompactionBudget(0)
+		, incrementalCompactionGarbageThreshold(0)
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1749,6 +1808,7 @@ public:
 		, optimizeConcurrentWB(true)
 		, concurrentLevel(8)
 		, concurrentBackground(1)
+		, concurrentBackgroundMax(0)
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
@@ -1832,13 +1892,20 @@ public:
 		, allocationCacheMaximumSize(16384)
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
+		, allocationCacheHotMaximumSize(65536)
+		, allocationCacheHotAllocationRate(4096)
+		, allocationCacheHotFootprint(262144)
 		, nonDeterministicSweep(false)
+		, sweepIncrementMicro(500)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
 		, verbosegcCycleTime(1000)  /* by default metronome outputs verbosegc every 1sec */
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, asyncLoggingBufferSize(1024 * 1024)
+		, verboseBinaryFormat(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1858,6 +1925,8 @@ public:
 		, regionSize(0)
 		, _numaManager()
 		, numaForced(false)
+		, numaSplitFreeList(false)
+		, numaAwareParallelGC(false)
 		, padToPageSize(false)
 		, fvtest_disableExplictMainThread(false)
 #if defined(OMR_GC_VLHGC)
@@ -1939,6 +2008,8 @@ public:
 		, darkMatterSampleRate(32)
 		, pretouchHeapOnExpand(false)
 		, decommitMinimumFree(0)
+		, releaseFreePagesAfterGlobalGC(false)
+		, releaseFreePagesGranule(2 * 1024 * 1024)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, gcOnIdle(false)
 		, compactOnIdle(false)
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+#include <immintrin.h>
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+
+#include "MarkMapScanner.hpp"
+
+#include "EnvironmentBase.hpp"
+
+uintptr_t *
+MM_MarkMapScanner::findNonEmptySlotScalar(uintptr_t *current, uintptr_t *top)
+{
+	/* test four slots per iteration to cut down on branches over long empty runs */
+	while ((current + 4) <= top) {
+		if (0 != (current[0] | current[1] | current[2] | current[3])) {
+			break;
+		}
+		current += 4;
+	}
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+__attribute__((target("sse4.2")))
+uintptr_t *
+MM_MarkMapScanner::findNonEmptySlotSSE42(uintptr_t *current, uintptr_t *top)
+{
+	const uintptr_t slotsPerIteration = (2 * sizeof(__m128i)) / sizeof(uintptr_t);
+	while ((current + slotsPerIteration) <= top) {
+		__m128i low = _mm_loadu_si128((const __m128i *)current);
+		__m128i high = _mm_loadu_si128((const __m128i *)current + 1);
+		__m128i both = _mm_or_si128(low, high);
+		if (!_mm_testz_si128(both, both)) {
+			break;
+		}
+		current += slotsPerIteration;
+	}
+	/* the non-empty slot, if any, is within the next iteration's worth of slots */
+	return findNonEmptySlotScalar(current, top);
+}
+
+__attribute__((target("avx2")))
+uintptr_t *
+MM_MarkMapScanner::findNonEmptySlotAVX2(uintptr_t *current, uintptr_t *top)
+{
+	const uintptr_t slotsPerIteration = (2 * sizeof(__m256i)) / sizeof(uintptr_t);
+	while ((current + slotsPerIteration) <= top) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)current);
+		__m256i high = _mm256_loadu_si256((const __m256i *)current + 1);
+		__m256i both = _mm256_or_si256(low, high);
+		if (!_mm256_testz_si256(both, both)) {
+			break;
+		}
+		current += slotsPerIteration;
+	}
+	/* the non-empty slot, if any, is within the next iteration's worth of slots */
+	return findNonEmptySlotScalar(current, top);
+}
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+
+MM_MarkMapScanner::FindNonEmptySlotFunction
+MM_MarkMapScanner::selectFindNonEmptySlot(MM_EnvironmentBase *env)
+{
+	FindNonEmptySlotFunction function = findNonEmptySlotScalar;
+
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	OMRProcessorDesc processorDescription;
+	if (0 == omrsysinfo_get_processor_description(&processorDescription)) {
+		/* AVX state must also be enabled by the operating system */
+		if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX2)
+			&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_OSXSAVE)
+		) {
+			function = findNonEmptySlotAVX2;
+		} else if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_SSE4_2)) {
+			function = findNonEmptySlotSSE42;
+		}
+	}
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+
+	return function;
+}
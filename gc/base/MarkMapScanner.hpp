@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(MARKMAPSCANNER_HPP_)
+#define MARKMAPSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+class MM_EnvironmentBase;
+
+/**
+ * Bulk scanners over raw mark map words, used by sweep to skip runs of empty (all dead) mark map slots.
+ * A vector implementation is chosen once at startup from the features of the processor, falling back
+ * to a portable scalar loop.
+ * @ingroup GC_Base
+ */
+class MM_MarkMapScanner
+{
+public:
+	/**
+	 * Find the first non-empty mark map slot in [current, top).
+	 * @return pointer to the first slot which is not zero, or top if all slots in the range are zero
+	 */
+	typedef uintptr_t *(*FindNonEmptySlotFunction)(uintptr_t *current, uintptr_t *top);
+
+	static uintptr_t *findNonEmptySlotScalar(uintptr_t *current, uintptr_t *top);
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+	static uintptr_t *findNonEmptySlotSSE42(uintptr_t *current, uintptr_t *top);
+	static uintptr_t *findNonEmptySlotAVX2(uintptr_t *current, uintptr_t *top);
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+
+	/**
+	 * Select the fastest scanner supported by the processor the GC is running on.
+	 * @param env[in] the current thread
+	 * @return the scanner to use
+	 */
+	static FindNonEmptySlotFunction selectFindNonEmptySlot(MM_EnvironmentBase *env);
+};
+
+#endif /* MARKMAPSCANNER_HPP_ */
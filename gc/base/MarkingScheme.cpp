@@ -46,6 +46,7 @@
 #else
 #include "WorkPacketsStandard.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#include "WorkPacketsWorkStealing.hpp"
 
 /**
  * Allocate and initialize a new instance of the receiver.
@@ -312,6 +313,71 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 	return sizeToDo;
 }
 
+/**
+ * Private internal. Called exclusively from completeScan() when -Xgc:markingPrefetchDepth= is non-zero.
+ * Referents are queued in a bounded FIFO as they are discovered and a prefetch is issued for their
+ * mark map word and object header. A referent is marked only once the FIFO is full, by which time its
+ * cache lines are likely to have arrived. The FIFO is not drained at the end of the object, so the
+ * referents of a run of one or two slot objects keep each other's prefetches in flight.
+ */
+uintptr_t
+MM_MarkingScheme::scanObjectWithPrefetch(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MM_MarkingPrefetchFIFO *fifo)
+{
+	uintptr_t sizeToDo = UDATA_MAX;
+	GC_ObjectScannerState objectScannerState;
+	GC_ObjectScanner *objectScanner = _delegate.getObjectScanner(env, objectPtr, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
+	if (NULL != objectScanner) {
+		uintptr_t const depth = _extensions->markingPrefetchDepth;
+		bool isLeafSlot = false;
+		GC_SlotObject *slotObject;
+#if defined(OMR_GC_LEAF_BITS)
+		while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
+#else /* OMR_GC_LEAF_BITS */
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+#endif /* OMR_GC_LEAF_BITS */
+			fixupForwardedSlot(slotObject);
+
+			omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+			if (!isHeapObject(referent)) {
+				/* Nothing to prefetch or mark */
+				continue;
+			}
+			MM_PREFETCH_READ(_markMap->getSlotPtrForAddress(referent));
+			MM_PREFETCH_READ(referent);
+
+			if (fifo->count < depth) {
+				fifo->objects[(fifo->head + fifo->count) % depth] = referent;
+				fifo->leafTypes[(fifo->head + fifo->count) % depth] = isLeafSlot;
+				fifo->count += 1;
+			} else {
+				/* FIFO is full: mark the oldest entry and reuse its position for the new referent */
+				inlineMarkObjectNoCheck(env, fifo->objects[fifo->head], fifo->leafTypes[fifo->head]);
+				env->_markStats._slotsPrefetched += 1;
+				fifo->objects[fifo->head] = referent;
+				fifo->leafTypes[fifo->head] = isLeafSlot;
+				fifo->head += 1;
+				if (fifo->head == depth) {
+					fifo->head = 0;
+				}
+			}
+		}
+	}
+	return sizeToDo;
+}
+
+void
+MM_MarkingScheme::drainPrefetchFIFO(MM_EnvironmentBase *env, MM_MarkingPrefetchFIFO *fifo)
+{
+	uintptr_t const depth = _extensions->markingPrefetchDepth;
+	while (0 != fifo->count) {
+		inlineMarkObjectNoCheck(env, fifo->objects[fifo->head], fifo->leafTypes[fifo->head]);
+		fifo->head += 1;
+		if (fifo->head == depth) {
+			fifo->head = 0;
+		}
+		fifo->count -= 1;
+	}
+}
 
 /**
  * Scan until there are no more work packets to be processed.
@@ -321,13 +387,38 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
-	do {
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			env->_markStats._bytesScanned += scanObject(env, objectPtr);
-			env->_markStats._objectsScanned += 1;
-		}
-	} while (_workPackets->handleWorkPacketOverflow(env));
+	if (0 != _extensions->markingPrefetchDepth) {
+		MM_MarkingPrefetchFIFO fifo;
+		do {
+			for (;;) {
+				omrobjectptr_t objectPtr = (omrobjectptr_t )env->_workStack.popNoWait(env);
+				if (NULL == objectPtr) {
+					if (0 != fifo.count) {
+						/* Work stack ran dry: the queued referents are the only source of more work.
+						 * Marking them must happen before pop() below, which may block in termination.
+						 */
+						env->_markStats._slotsDrained += fifo.count;
+						drainPrefetchFIFO(env, &fifo);
+						continue;
+					}
+					objectPtr = (omrobjectptr_t )env->_workStack.pop(env);
+					if (NULL == objectPtr) {
+						break;
+					}
+				}
+				env->_markStats._bytesScanned += scanObjectWithPrefetch(env, objectPtr, &fifo);
+				env->_markStats._objectsScanned += 1;
+			}
+		} while (_workPackets->handleWorkPacketOverflow(env));
+	} else {
+		do {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+			}
+		} while (_workPackets->handleWorkPacketOverflow(env));
+	}
 }
 
 /****************************************
@@ -395,7 +486,7 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env)
 		if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
 #if defined(OMR_GC_REALTIME)
 			MM_WorkPacketsSATB *workPacketsSATB = MM_WorkPacketsSATB::newInstance(env);
-			_extensions->sATBBarrierRememberedSet = MM_RememberedSetSATB::newInstance(env, workPacketsSATB);
+			_extensions->sATBBarrierRememberedSet = MM_RememberedSetSATB::newInstance(env, workPacketsSATB, this);
 			workPackets = workPacketsSATB;
 #endif /* defined(OMR_GC_REALTIME) */
 		} else {
@@ -403,6 +494,8 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env)
 			workPackets = MM_WorkPacketsConcurrent::newInstance(env);
 #endif /* defined OMR_GC_MODRON_CONCURRENT_MARK */
 		}
+	} else if (_extensions->workStealingMarking) {
+		workPackets = MM_WorkPacketsWorkStealing::newInstance(env);
 	} else {
 		workPackets = MM_WorkPacketsStandard::newInstance(env);
 	}
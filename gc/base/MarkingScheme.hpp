@@ -38,6 +38,23 @@
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
 
+/**
+ * Referents waiting to be marked while their prefetches are in flight (-Xgc:markingPrefetchDepth=).
+ * One instance lives for a whole completeScan() so the referents of consecutive small objects
+ * (list and tree nodes with one or two slots) share it and still hide each other's latency.
+ */
+struct MM_MarkingPrefetchFIFO {
+	omrobjectptr_t objects[MARKING_PREFETCH_DEPTH_MAXIMUM]; /**< Queued referents, oldest at head */
+	bool leafTypes[MARKING_PREFETCH_DEPTH_MAXIMUM]; /**< Leaf flag of each queued referent */
+	uintptr_t head; /**< Index of the oldest queued referent */
+	uintptr_t count; /**< Number of queued referents */
+
+	MM_MarkingPrefetchFIFO()
+		: head(0)
+		, count(0)
+	{}
+};
+
 /**
  * @todo Provide class documentation
  */
@@ -76,6 +93,22 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Private internal. Called exclusively from completeScan() when -Xgc:markingPrefetchDepth= is non-zero.
+	 * @param[in] env calling thread environment
+	 * @param[in] objectPtr object popped from the work stack
+	 * @param[in] fifo prefetch FIFO shared by every object of the scan loop
+	 * @return the number of bytes scanned
+	 */
+	uintptr_t scanObjectWithPrefetch(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MM_MarkingPrefetchFIFO *fifo);
+
+	/**
+	 * Private internal. Mark every referent still queued in the prefetch FIFO, oldest first.
+	 * @param[in] env calling thread environment
+	 * @param[in] fifo prefetch FIFO to empty
+	 */
+	void drainPrefetchFIFO(MM_EnvironmentBase *env, MM_MarkingPrefetchFIFO *fifo);
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
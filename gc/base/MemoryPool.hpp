@@ -422,6 +422,14 @@ public:
 	 * @return bytes of free memory in the pool released/decommited back to OS
 	 */
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	/**
+	 * Release the free memory of the pool that is not expected to be allocated before the next collection.
+	 * Free memory is retained from the lowest address up, where allocation starts, and only whole granules are released.
+	 * @param granule the alignment and minimum size of a released range, a multiple of the heap page size
+	 * @param[in,out] retainBytes free bytes to keep committed, reduced by the free memory the pool retained
+	 * @return bytes of free memory in the pool released/decommited back to OS
+	 */
+	virtual uintptr_t releaseIdleFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t granule, uintptr_t* retainBytes) { return 0; }
 	/**
 	 * Create a MemoryPool object.
 	 */
@@ -32,6 +32,7 @@
 #include "AllocateDescription.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
+#include "FreeEntrySizeClassCache.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Collector.hpp"
 #include "MemoryPool.hpp"
@@ -128,6 +129,13 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 		return false;
 	} 
 
+	if (ext->freeEntrySizeClassCache && ext->isStandardGC()) {
+		_sizeClassCache = MM_FreeEntrySizeClassCache::newInstance(env, _largeObjectAllocateStats, ext->freeEntrySizeClassCacheMinimumSize, ext->freeEntrySizeClassCacheMaximumSize);
+		if (NULL == _sizeClassCache) {
+			return false;
+		}
+	}
+
 	/* At this moment we do not know who is creator of this pool, so we do not set _largeObjectCollectorAllocateStats yet.
 	 * Tenure SubSpace for Gencon will set _largeObjectCollectorAllocateStats to _largeObjectAllocateStats (we append collector stats to mutator stats)
 	 * SemiSpace will leave _largeObjectCollectorAllocateStats at NULL (no interest in Collector stats)
@@ -200,6 +208,11 @@ MM_MemoryPoolAddressOrderedList::tearDown(MM_EnvironmentBase *env)
 		globalCollector->deleteSweepPoolState(env, _sweepPoolState);
 	}
 
+	if (NULL != _sizeClassCache) {
+		_sizeClassCache->kill(env);
+		_sizeClassCache = NULL;
+	}
+
 	if (NULL != _largeObjectAllocateStats) {
 		_largeObjectAllocateStats->kill(env);
 	}
@@ -448,14 +461,19 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	J9ModronAllocateHint *allocateHintUsed;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
+
+	if ((NULL != _sizeClassCache) && (sizeInBytesRequired <= _extensions->freeEntrySizeClassCacheMaximumSize)) {
+		addrBase = allocateFromSizeClassCache(env, sizeInBytesRequired);
+		if (NULL != addrBase) {
+			return addrBase;
+		}
+	}
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
 	}
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 retry:
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	currentFreeEntry = _heapFreeList;
 	previousFreeEntry = NULL;
@@ -504,11 +522,12 @@ retry:
 
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
-#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (flushSizeClassCache(env)) {
+			goto retry;
+		}
 		if(_memorySubSpace->replenishPoolForAllocate(env, this, sizeInBytesRequired)) {
 			goto retry;
 		}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 		goto fail_allocate;
 	}
 
@@ -641,6 +660,13 @@ MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, ui
 	MM_HeapLinkedFreeHeader *freeEntry = NULL;
 	uintptr_t consumedSize = 0;
 	uintptr_t recycleEntrySize = 0;
+
+	/* Remainders left in the size class cache by object allocations would otherwise sit idle until the cache is flushed */
+	if ((NULL != _sizeClassCache) && !isAlignmentForParallelGCRequired()) {
+		if (allocateTLHFromSizeClassCache(env, maximumSizeInBytesRequired, addrBase, addrTop)) {
+			return true;
+		}
+	}
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
@@ -648,22 +674,17 @@ MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, ui
 
 retry:
 	freeEntry = _heapFreeList;
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 
 	/* Check if an entry was found */
 	if(!freeEntry) {
+		if (flushSizeClassCache(env)) {
+			goto retry;
+		}
 		if(_memorySubSpace->replenishPoolForAllocate(env, this, _minimumFreeEntrySize)) {
 			goto retry;
 		}
 		goto fail_allocate;
 	}
-#else /* OMR_GC_CONCURRENT_SWEEP */
-
-	/* Check if an entry was found */
-	if(!freeEntry) {
-		goto fail_allocate;
-	}
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	if (doesNeedCardAlignment(env, freeEntry)) {
 		freeEntry = doFreeEntryCardAlignmentUpTo(env, freeEntry);
@@ -770,6 +791,149 @@ MM_MemoryPoolAddressOrderedList::getConsumedSizeForTLH(MM_EnvironmentBase *env,
 	return consumedSize;
 }
 
+/**
+ * Allocate an object from the size class cache without taking the heap lock.
+ * @return the object address, or NULL if no cached entry was large enough
+ */
+void *
+MM_MemoryPoolAddressOrderedList::allocateFromSizeClassCache(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = _sizeClassCache->allocate(sizeInBytesRequired);
+	if (NULL != freeEntry) {
+		uintptr_t recycleEntrySize = freeEntry->getSize() - sizeInBytesRequired;
+		recycleSizeClassCacheRemainder((void *)freeEntry, sizeInBytesRequired, recycleEntrySize);
+	}
+	return freeEntry;
+}
+
+/**
+ * Allocate a TLH from the remainder slot of the size class cache without taking the heap lock.
+ * @return true if a TLH was allocated
+ */
+bool
+MM_MemoryPoolAddressOrderedList::allocateTLHFromSizeClassCache(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = _sizeClassCache->allocateRemainder();
+	if (NULL == freeEntry) {
+		return false;
+	}
+
+	uintptr_t freeEntrySize = freeEntry->getSize();
+	uintptr_t consumedSize = OMR_MIN(freeEntrySize, maximumSizeInBytesRequired);
+	uintptr_t recycleEntrySize = freeEntrySize - consumedSize;
+	if (recycleEntrySize < _minimumFreeEntrySize) {
+		consumedSize = freeEntrySize;
+		recycleEntrySize = 0;
+	}
+
+	addrBase = (void *)freeEntry;
+	addrTop = (void *)(((uint8_t *)addrBase) + consumedSize);
+	recycleSizeClassCacheRemainder(addrBase, consumedSize, recycleEntrySize);
+
+	return true;
+}
+
+/**
+ * Return the unused tail of an entry popped from the size class cache, or abandon it if it is too small to be a free entry.
+ */
+void
+MM_MemoryPoolAddressOrderedList::recycleSizeClassCacheRemainder(void *addrBase, uintptr_t allocBytes, uintptr_t recycleEntrySize)
+{
+	void *recycleEntry = (void *)(((uint8_t *)addrBase) + allocBytes);
+	uintptr_t discardedBytes = 0;
+
+	if (recycleEntrySize >= _minimumFreeEntrySize) {
+		_sizeClassCache->push(MM_HeapLinkedFreeHeader::fillWithHoles(recycleEntry, recycleEntrySize, compressObjectReferences()), recycleEntrySize);
+	} else if (0 != recycleEntrySize) {
+		abandonHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize);
+		discardedBytes = recycleEntrySize;
+	}
+
+	_sizeClassCache->recordAllocate(allocBytes, discardedBytes);
+}
+
+void
+MM_MemoryPoolAddressOrderedList::fillSizeClassCache(MM_EnvironmentBase *env)
+{
+	if ((NULL == _sizeClassCache) || (MEMORY_TYPE_OLD != _memorySubSpace->getTypeFlags())) {
+		return;
+	}
+
+	bool const compressed = compressObjectReferences();
+	flushSizeClassCache(env);
+	_sizeClassCache->reset();
+
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *currentFreeEntry = _heapFreeList;
+	while (NULL != currentFreeEntry) {
+		MM_HeapLinkedFreeHeader *nextFreeEntry = currentFreeEntry->getNext(compressed);
+		if (NULL == nextFreeEntry) {
+			/* Leave the last entry on the list */
+			break;
+		}
+		uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
+		if (_sizeClassCache->fill(currentFreeEntry, currentFreeEntrySize)) {
+			if (NULL == previousFreeEntry) {
+				_heapFreeList = nextFreeEntry;
+			} else {
+				previousFreeEntry->setNext(nextFreeEntry, compressed);
+			}
+			_freeMemorySize -= currentFreeEntrySize;
+			_freeEntryCount -= 1;
+		} else {
+			previousFreeEntry = currentFreeEntry;
+		}
+		currentFreeEntry = nextFreeEntry;
+	}
+
+	clearHints();
+}
+
+bool
+MM_MemoryPoolAddressOrderedList::flushSizeClassCache(MM_EnvironmentBase *env)
+{
+	if ((NULL == _sizeClassCache) || _sizeClassCache->isEmpty()) {
+		return false;
+	}
+
+	bool const compressed = compressObjectReferences();
+	uintptr_t cachedEntryCount = 0;
+	uintptr_t cachedBytes = 0;
+	MM_HeapLinkedFreeHeader *cachedFreeEntry = _sizeClassCache->detachAll(&cachedEntryCount, &cachedBytes);
+	if (NULL == cachedFreeEntry) {
+		return false;
+	}
+
+	/* Both lists are address ordered, merge the cached entries in */
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *currentFreeEntry = _heapFreeList;
+	while (NULL != cachedFreeEntry) {
+		MM_HeapLinkedFreeHeader *nextCachedFreeEntry = cachedFreeEntry->getNext(compressed);
+		while ((NULL != currentFreeEntry) && (currentFreeEntry < cachedFreeEntry)) {
+			previousFreeEntry = currentFreeEntry;
+			currentFreeEntry = currentFreeEntry->getNext(compressed);
+		}
+		cachedFreeEntry->setNext(currentFreeEntry, compressed);
+		if (NULL == previousFreeEntry) {
+			_heapFreeList = cachedFreeEntry;
+		} else {
+			previousFreeEntry->setNext(cachedFreeEntry, compressed);
+		}
+		/* Remainders pushed by allocations are not in the size class stats yet; entries moved in by the sweep are
+		 * counted twice until the next sweep rebuilds the stats, which only overstates the free space briefly.
+		 */
+		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(cachedFreeEntry->getSize());
+		previousFreeEntry = cachedFreeEntry;
+		cachedFreeEntry = nextCachedFreeEntry;
+	}
+
+	_freeMemorySize += cachedBytes;
+	_freeEntryCount += cachedEntryCount;
+	clearHints();
+
+	return true;
+}
+
 void *
 MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription,
 											uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
@@ -823,6 +987,9 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 
 	clearHints();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
+	if (NULL != _sizeClassCache) {
+		_sizeClassCache->reset();
+	}
 	_scannableBytes = 0;
 	_nonScannableBytes = 0;
 	_firstCardUnalignedFreeEntry = FREE_ENTRY_END;
@@ -1029,6 +1196,8 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	flushSizeClassCache(env);
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -1210,6 +1379,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	void *currentFreeEntryTop, *baseAddr, *topAddr;
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry, *nextFreeEntry, *tailFreeEntry;
 
+	flushSizeClassCache(env);
+
 	retListHead = NULL;
 	retListTail = NULL;
 	retListMemoryCount = 0;
@@ -1377,6 +1548,7 @@ MM_MemoryPoolAddressOrderedList::findAddressAfterFreeSize(MM_EnvironmentBase *en
 {
 	bool const compressed = compressObjectReferences();
 	uintptr_t remainingBytesNeeded = sizeRequired;
+	flushSizeClassCache(env);
 	MM_HeapLinkedFreeHeader *currentFreeEntry = _heapFreeList;
 
 	/* Count full free entries until an entry needs to be split. */
@@ -1470,6 +1642,7 @@ MM_MemoryPoolAddressOrderedList::findFreeEntryEndingAtAddr(MM_EnvironmentBase *e
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry;
 
+	flushSizeClassCache(env);
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
 		if(((void *)currentFreeEntry->afterEnd()) == addr) {
@@ -1530,6 +1703,7 @@ MM_MemoryPoolAddressOrderedList::findFreeEntryTopStartingAtAddr(MM_EnvironmentBa
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry;
 
+	flushSizeClassCache(env);
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
 		if((void *)currentFreeEntry == addr) {
@@ -1556,6 +1730,7 @@ MM_MemoryPoolAddressOrderedList::findFreeEntryTopStartingAtAddr(MM_EnvironmentBa
 void *
 MM_MemoryPoolAddressOrderedList::getFirstFreeStartingAddr(MM_EnvironmentBase *env)
 {
+	flushSizeClassCache(env);
 	return _heapFreeList;
 }
 
@@ -1587,6 +1762,7 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	flushSizeClassCache(env);
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1832,6 +2008,48 @@ MM_MemoryPoolAddressOrderedList::recalculateMemoryPoolStatistics(MM_EnvironmentB
 	updateMemoryPoolStatistics(env, freeBytes, freeEntryCount, largestFreeEntry);
 }
 
+uintptr_t
+MM_MemoryPoolAddressOrderedList::getActualFreeMemorySize()
+{
+	uintptr_t freeMemorySize = _freeMemorySize - _adjustedBytesForCardAlignment;
+	if (NULL != _sizeClassCache) {
+		freeMemorySize += _sizeClassCache->getFreeBytes();
+	}
+	return freeMemorySize;
+}
+
+uintptr_t
+MM_MemoryPoolAddressOrderedList::getActualFreeEntryCount()
+{
+	uintptr_t freeEntryCount = _freeEntryCount;
+	if (NULL != _sizeClassCache) {
+		freeEntryCount += _sizeClassCache->getFreeEntryCount();
+	}
+	return freeEntryCount;
+}
+
+void
+MM_MemoryPoolAddressOrderedList::resetHeapStatistics(bool memoryPoolCollected)
+{
+	MM_MemoryPool::resetHeapStatistics(memoryPoolCollected);
+	if (NULL != _sizeClassCache) {
+		_sizeClassCache->resetAllocateStats();
+	}
+}
+
+void
+MM_MemoryPoolAddressOrderedList::mergeHeapStats(MM_HeapStats *heapStats, bool active)
+{
+	MM_MemoryPool::mergeHeapStats(heapStats, active);
+	if (NULL != _sizeClassCache) {
+		heapStats->_allocCount += _sizeClassCache->getAllocCount();
+		heapStats->_allocBytes += _sizeClassCache->getAllocBytes();
+		heapStats->_allocDiscardedBytes += _sizeClassCache->getAllocDiscardedBytes();
+		heapStats->_sizeClassCacheAllocCount += _sizeClassCache->getAllocCount();
+		heapStats->_sizeClassCacheAllocBytes += _sizeClassCache->getAllocBytes();
+	}
+}
+
 void
 MM_MemoryPoolAddressOrderedList::appendCollectorLargeAllocateStats()
 {
@@ -1843,11 +2061,23 @@ MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
 {
 	uintptr_t releasedBytes = 0;
 	_heapLock.acquire();
+	flushSizeClassCache(env);
 	releasedBytes = releaseFreeEntryMemoryPages(env, _heapFreeList);
 	_heapLock.release();
 	return releasedBytes;
 }
 
+uintptr_t
+MM_MemoryPoolAddressOrderedList::releaseIdleFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t granule, uintptr_t* retainBytes)
+{
+	uintptr_t releasedBytes = 0;
+	_heapLock.acquire();
+	flushSizeClassCache(env);
+	releasedBytes = releaseIdleFreeEntryMemoryPages(env, _heapFreeList, granule, retainBytes);
+	_heapLock.release();
+	return releasedBytes;
+}
+
 MM_HeapLinkedFreeHeader *
 MM_MemoryPoolAddressOrderedList::doFreeEntryCardAlignmentUpTo(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *lastFreeEntryToAlign)
 {
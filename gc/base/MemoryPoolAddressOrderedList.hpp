@@ -35,6 +35,8 @@
 #include "AtomicOperations.hpp"
 
 class MM_AllocateDescription;
+class MM_FreeEntrySizeClassCache;
+class MM_LazySweepScheme;
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 class MM_ConcurrentSweepScheme;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -68,6 +70,8 @@ private:
 
 	void *_parallelGCAlignmentBase; /**< Base address of the region where the pool resides */
 	uintptr_t _parallelGCAlignmentSize; /**<  Fixed Size used to determine boundaries for alignment. */
+
+	MM_FreeEntrySizeClassCache *_sizeClassCache; /**< Lock free per size class free entries taken off the list after a sweep (NULL if disabled) */
 protected:
 public:
 	
@@ -85,6 +89,11 @@ private:
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	uintptr_t getConsumedSizeForTLH(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t maximumSizeInBytesRequired);
 
+	/* Size class cache support - allocation from the cache does not take the heap lock */
+	void *allocateFromSizeClassCache(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
+	bool allocateTLHFromSizeClassCache(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
+	void recycleSizeClassCacheRemainder(void *addrBase, uintptr_t allocBytes, uintptr_t recycleEntrySize);
+
 	/* Align a TLH to meet boundary restrictions. Certain phases of some GCs may require that TLHs not span heap chunks for parallel processing. */
 	bool alignTLHForParallelGC(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t *consumedSize);
 
@@ -187,9 +196,28 @@ public:
 	virtual void recalculateMemoryPoolStatistics(MM_EnvironmentBase *env);
 
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseIdleFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t granule, uintptr_t* retainBytes);
 
 	void setParallelGCAlignment(MM_EnvironmentBase *env, bool alignmentEnabled);
 
+	/**
+	 * Move the free entries within the size class cache range from the free list into the size class cache.
+	 * The last entry of the list is left in place, so that expansion and contraction keep seeing the top of the pool.
+	 * Called at the end of a stop-the-world sweep.
+	 */
+	void fillSizeClassCache(MM_EnvironmentBase *env);
+
+	/**
+	 * Return all entries held by the size class cache to the free list.
+	 * The caller must hold the pool lock or have exclusive access.
+	 * @return true if any entry was returned
+	 */
+	bool flushSizeClassCache(MM_EnvironmentBase *env);
+
+	virtual void resetHeapStatistics(bool memoryPoolCollected);
+	virtual void mergeHeapStats(MM_HeapStats *heapStats, bool active);
+	virtual uintptr_t getActualFreeEntryCount();
+
 	/**
 	 * remove a free entry from freelist
 	 */
@@ -242,10 +270,7 @@ public:
 		return _darkMatterBytes + _adjustedBytesForCardAlignment;
 	}
 
-	MMINLINE virtual uintptr_t getActualFreeMemorySize()
-	{
-		return _freeMemorySize - _adjustedBytesForCardAlignment;
-	}
+	virtual uintptr_t getActualFreeMemorySize();
 
 	/**
 	 * Create a MemoryPoolAddressOrderedList object.
@@ -258,6 +283,7 @@ public:
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_parallelGCAlignmentBase(NULL)
 		,_parallelGCAlignmentSize(0)
+		,_sizeClassCache(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -270,6 +296,7 @@ public:
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_parallelGCAlignmentBase(NULL)
 		,_parallelGCAlignmentSize(0)
+		,_sizeClassCache(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -277,6 +304,7 @@ public:
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	friend class MM_ConcurrentSweepScheme;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
+	friend class MM_LazySweepScheme;
 	
 	friend class MM_SweepPoolManagerAddressOrderedList;
 	friend class MM_SweepPoolManagerVLHGC;
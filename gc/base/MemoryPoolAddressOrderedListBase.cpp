@@ -220,3 +220,33 @@ MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentB
 	}
 	return releasedMemory;
 }
+
+/**
+ * Decommit the granules of the free entries in the list starting at freeEntry that are not needed
+ * to keep *retainBytes of free memory committed.  The list is address ordered, so the lowest entries
+ * are the ones retained.  The header of an entry always stays committed.
+ */
+uintptr_t
+MM_MemoryPoolAddressOrderedListBase::releaseIdleFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, uintptr_t granule, uintptr_t* retainBytes)
+{
+	bool const compressed = compressObjectReferences();
+	uintptr_t releasedMemory = 0;
+	MM_HeapLinkedFreeHeader* currentFreeEntry = freeEntry;
+	while (NULL != currentFreeEntry) {
+		uintptr_t freeEntrySize = currentFreeEntry->getSize();
+		uintptr_t retainedSize = OMR_MIN(*retainBytes, freeEntrySize);
+		*retainBytes -= retainedSize;
+		if (granule <= (freeEntrySize - retainedSize)) {
+			uintptr_t addressBase = (uintptr_t)currentFreeEntry + OMR_MAX(retainedSize, sizeof(MM_HeapLinkedFreeHeader));
+			addressBase = MM_Math::roundToCeiling(granule, addressBase);
+			uintptr_t addressTop = MM_Math::roundToFloor(granule, (uintptr_t)currentFreeEntry->afterEnd());
+			if (addressBase < addressTop) {
+				if (_extensions->heap->decommitMemory((void*)addressBase, addressTop - addressBase, NULL, currentFreeEntry->afterEnd())) {
+					releasedMemory += addressTop - addressBase;
+				}
+			}
+		}
+		currentFreeEntry = currentFreeEntry->getNext(compressed);
+	}
+	return releasedMemory;
+}
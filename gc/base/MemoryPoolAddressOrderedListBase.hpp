@@ -233,6 +233,7 @@ public:
 	}
 
 	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry);
+	uintptr_t releaseIdleFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, uintptr_t granule, uintptr_t* retainBytes);
 	/**
 	 * Create a MemoryPoolAddressOrderedList object.
 	 */
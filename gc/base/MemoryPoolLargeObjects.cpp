@@ -1134,3 +1134,12 @@ MM_MemoryPoolLargeObjects::releaseFreeMemoryPages(MM_EnvironmentBase* env)
 	releasedMemory += _memoryPoolLargeObjects->releaseFreeMemoryPages(env);
 	return releasedMemory;
 }
+
+uintptr_t
+MM_MemoryPoolLargeObjects::releaseIdleFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t granule, uintptr_t* retainBytes)
+{
+	/* The LOA is at the top of the pool, so the SOA retains first */
+	uintptr_t releasedMemory = _memoryPoolSmallObjects->releaseIdleFreeMemoryPages(env, granule, retainBytes);
+	releasedMemory += _memoryPoolLargeObjects->releaseIdleFreeMemoryPages(env, granule, retainBytes);
+	return releasedMemory;
+}
@@ -262,6 +262,7 @@ public:
 	}
 
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseIdleFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t granule, uintptr_t* retainBytes);
 
 	/**
 	 * Create a MemoryPoolLargeObjects object.
@@ -34,12 +34,16 @@
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
 #include "Heap.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapLinkedFreeHeader.hpp"
+#include "HeapStats.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "ParallelSweepChunk.hpp"
 #include "SweepHeapSectioning.hpp"
@@ -73,11 +77,72 @@ MM_MemoryPoolSplitAddressOrderedList::newInstance(MM_EnvironmentBase* env, uintp
 	return memoryPool;
 }
 
+bool
+MM_MemoryPoolSplitAddressOrderedList::initialize(MM_EnvironmentBase* env)
+{
+	if (!MM_MemoryPoolSplitAddressOrderedListBase::initialize(env)) {
+		return false;
+	}
+
+	uintptr_t affinityLeaderCount = _extensions->_numaManager.getAffinityLeaderCount();
+	if (_extensions->numaSplitFreeList && (1 < affinityLeaderCount) && (0 == (_heapFreeListCount % affinityLeaderCount))) {
+		_numaNodeFreeBytes = (uintptr_t*)env->getForge()->allocate(sizeof(uintptr_t) * affinityLeaderCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _numaNodeFreeBytes) {
+			return false;
+		}
+
+		/* Node ranges are page aligned so that each can be bound to its node on its own */
+		MM_Heap* heap = _extensions->heap;
+		uintptr_t heapSize = (uintptr_t)heap->getHeapTop() - (uintptr_t)heap->getHeapBase();
+		_numaNodeCount = affinityLeaderCount;
+		_freeListsPerNode = _heapFreeListCount / affinityLeaderCount;
+		_numaNodeRangeBase = heap->getHeapBase();
+		_numaNodeRangeSize = MM_Math::roundToCeiling(heap->getPageSize(), OMR_MAX(heapSize / affinityLeaderCount, 1));
+	}
+
+	return true;
+}
+
+void
+MM_MemoryPoolSplitAddressOrderedList::tearDown(MM_EnvironmentBase* env)
+{
+	if (NULL != _numaNodeFreeBytes) {
+		env->getForge()->free(_numaNodeFreeBytes);
+		_numaNodeFreeBytes = NULL;
+	}
+
+	MM_MemoryPoolSplitAddressOrderedListBase::tearDown(env);
+}
+
 /****************************************
  * Allocation
  ****************************************
  */
 
+uintptr_t
+MM_MemoryPoolSplitAddressOrderedList::getStartFreeList(MM_EnvironmentBase* env, uintptr_t* homeFreeListCount)
+{
+	uintptr_t startFreeList = _currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount];
+	*homeFreeListCount = 0;
+
+	if (0 != _numaNodeCount) {
+		/* GC threads remember the node the dispatcher bound them to, other threads are looked up where they run now */
+		uintptr_t numaNode = env->getNumaNode();
+		if (0 == numaNode) {
+			numaNode = _extensions->_numaManager.getAffinityLeaderForCurrentThread();
+		}
+		if ((0 != numaNode) && (numaNode <= _numaNodeCount)) {
+			uintptr_t nodeStart = (numaNode - 1) * _freeListsPerNode;
+			if ((startFreeList < nodeStart) || (startFreeList >= (nodeStart + _freeListsPerNode))) {
+				startFreeList = nodeStart + (env->getEnvironmentId() % _freeListsPerNode);
+			}
+			*homeFreeListCount = _freeListsPerNode;
+		}
+	}
+
+	return startFreeList;
+}
+
 MMINLINE MM_HeapLinkedFreeHeader*
 MM_MemoryPoolSplitAddressOrderedList::internalAllocateFromList(MM_EnvironmentBase* env, uintptr_t sizeInBytesRequired, uintptr_t curFreeList, MM_HeapLinkedFreeHeader** previousFreeEntry, uintptr_t* largestFreeEntry)
 {
@@ -311,6 +376,7 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase* en
 	uintptr_t recycleEntrySize = 0;
 	uintptr_t suggestedFreeList;
 	uintptr_t curFreeList;
+	uintptr_t homeNode = 0;
 
 	/* first pass iterating if skipReserved = true */
 	bool skipReserved = true;
@@ -318,10 +384,14 @@ retry:
 
 	bool firstIteration = true;
 	bool jumpedToSuggested = false;
+	uintptr_t homeFreeListCount = 0;
 
 
 	if (skipReserved) {
-		curFreeList = _currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount];
+		curFreeList = getStartFreeList(env, &homeFreeListCount);
+		if (0 != homeFreeListCount) {
+			homeNode = (curFreeList / _freeListsPerNode) + 1;
+		}
 	} else {
 		/* tried all lists and the only thing to try is reserved free entry */
 		curFreeList = _reservedFreeListIndex;
@@ -370,7 +440,13 @@ retry:
 		}
 
 		jumpedToSuggested = false;
-		if (firstIteration) {
+		if (1 < homeFreeListCount) {
+			/* try the other free lists of the thread's NUMA node before any remote one */
+			uintptr_t nodeStart = curFreeList - (curFreeList % _freeListsPerNode);
+			curFreeList = nodeStart + (((curFreeList - nodeStart) + 1) % _freeListsPerNode);
+			homeFreeListCount -= 1;
+			jumpedToSuggested = true;
+		} else if (firstIteration) {
 			firstIteration = false;
 			suggestedFreeList = findGoodStartFreeList();
 			curFreeList = suggestedFreeList;
@@ -422,6 +498,13 @@ skipSearch:
 
 	_allocCount += 1;
 	_allocBytes += consumedSize;
+	if (0 != homeNode) {
+		if (homeNode == ((curFreeList / _freeListsPerNode) + 1)) {
+			_numaLocalTLHAllocCount += 1;
+		} else {
+			_numaRemoteTLHAllocCount += 1;
+		}
+	}
 	/* Collector TLH allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStatsForFreeList is null for Survivor) */
 	if (NULL != largeObjectAllocateStatsForFreeList) {
 		largeObjectAllocateStatsForFreeList[curFreeList].incrementTlhAllocSizeClassStats(consumedSize);
@@ -467,6 +550,27 @@ skipSearch:
 	return true;
 }
 
+/****************************************
+ * Statistics
+ ****************************************
+ */
+
+void
+MM_MemoryPoolSplitAddressOrderedList::resetHeapStatistics(bool memoryPoolCollected)
+{
+	MM_MemoryPoolSplitAddressOrderedListBase::resetHeapStatistics(memoryPoolCollected);
+	_numaLocalTLHAllocCount = 0;
+	_numaRemoteTLHAllocCount = 0;
+}
+
+void
+MM_MemoryPoolSplitAddressOrderedList::mergeHeapStats(MM_HeapStats *heapStats, bool active)
+{
+	MM_MemoryPoolSplitAddressOrderedListBase::mergeHeapStats(heapStats, active);
+	heapStats->_numaLocalTLHAllocCount += _numaLocalTLHAllocCount;
+	heapStats->_numaRemoteTLHAllocCount += _numaRemoteTLHAllocCount;
+}
+
 /****************************************
  * Free list building
  ****************************************
@@ -505,7 +609,10 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 
 	resetReservedFreeEntry();
 
-	if (cause == forSweep) {
+	if (0 != _numaNodeCount) {
+		/* Node boundaries come first, the sweep chunk split candidates do not know about them */
+		splitFreeListByNUMANode(env);
+	} else if (cause == forSweep) {
 
 		_heapFreeLists[0]._freeSize = _sweepPoolState->_sweepFreeBytes;
 		_heapFreeLists[0]._freeCount = _sweepPoolState->_sweepFreeHoles;
@@ -649,6 +756,92 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 	}
 }
 
+void
+MM_MemoryPoolSplitAddressOrderedList::splitFreeListByNUMANode(MM_EnvironmentBase* env)
+{
+	bool const compressed = compressObjectReferences();
+	MM_HeapLinkedFreeHeader* freeEntry = _heapFreeLists[0]._freeList;
+
+	for (uintptr_t nodeIndex = 0; nodeIndex < _numaNodeCount; ++nodeIndex) {
+		_numaNodeFreeBytes[nodeIndex] = 0;
+	}
+	for (MM_HeapLinkedFreeHeader* currentFreeEntry = freeEntry; NULL != currentFreeEntry; currentFreeEntry = currentFreeEntry->getNext(compressed)) {
+		_numaNodeFreeBytes[getNUMANodeForAddress(currentFreeEntry) - 1] += currentFreeEntry->getSize();
+	}
+	for (uintptr_t i = 0; i < _heapFreeListCount; ++i) {
+		_heapFreeLists[i]._freeList = NULL;
+		_heapFreeLists[i]._freeSize = 0;
+		_heapFreeLists[i]._freeCount = 0;
+	}
+
+	/* The list is address ordered, so the entries of a node are consecutive and the nodes come in ascending order */
+	uintptr_t currentNode = 0;
+	uintptr_t currentFreeListIndex = 0;
+	uintptr_t lastFreeListIndexForNode = 0;
+	uintptr_t freeListSplitSize = 0;
+	MM_HeapLinkedFreeHeader* previousFreeEntry = NULL;
+	while (NULL != freeEntry) {
+		uintptr_t numaNode = getNUMANodeForAddress(freeEntry);
+		if (numaNode != currentNode) {
+			if (NULL != previousFreeEntry) {
+				previousFreeEntry->setNext(NULL, compressed);
+				previousFreeEntry = NULL;
+			}
+			currentNode = numaNode;
+			currentFreeListIndex = (numaNode - 1) * _freeListsPerNode;
+			lastFreeListIndexForNode = currentFreeListIndex + _freeListsPerNode - 1;
+			freeListSplitSize = _numaNodeFreeBytes[numaNode - 1] / _freeListsPerNode;
+		} else if ((_heapFreeLists[currentFreeListIndex]._freeSize >= freeListSplitSize) && (currentFreeListIndex < lastFreeListIndexForNode)) {
+			previousFreeEntry->setNext(NULL, compressed);
+			previousFreeEntry = NULL;
+			currentFreeListIndex += 1;
+		}
+
+		if (NULL == previousFreeEntry) {
+			_heapFreeLists[currentFreeListIndex]._freeList = freeEntry;
+		}
+		uintptr_t freeEntrySize = freeEntry->getSize();
+		_heapFreeLists[currentFreeListIndex]._freeSize += freeEntrySize;
+		_heapFreeLists[currentFreeListIndex]._freeCount += 1;
+
+		if (freeEntrySize > _reservedFreeEntrySize) {
+			_reservedFreeEntrySize = freeEntrySize;
+			_reservedFreeListIndex = currentFreeListIndex;
+			_previousReservedFreeEntry = previousFreeEntry;
+			_reservedFreeEntryAvaliable = true;
+		}
+
+		previousFreeEntry = freeEntry;
+		freeEntry = freeEntry->getNext(compressed);
+	}
+}
+
+void
+MM_MemoryPoolSplitAddressOrderedList::setNUMAAffinityForRange(MM_EnvironmentBase* env, void* lowAddress, void* highAddress)
+{
+	MM_NUMAManager* numaManager = &_extensions->_numaManager;
+	if (!numaManager->isPhysicalNUMASupported()) {
+		return;
+	}
+
+	uintptr_t rangeBase = MM_Math::roundToCeiling(_extensions->heap->getPageSize(), (uintptr_t)lowAddress);
+	while (rangeBase < (uintptr_t)highAddress) {
+		uintptr_t numaNode = getNUMANodeForAddress((void*)rangeBase);
+		uintptr_t rangeTop = (uintptr_t)highAddress;
+		if (numaNode < _numaNodeCount) {
+			rangeTop = OMR_MIN(rangeTop, (uintptr_t)_numaNodeRangeBase + (numaNode * _numaNodeRangeSize));
+		}
+#if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
+		uintptr_t j9NodeNumber = numaManager->getJ9NodeNumber(numaNode);
+		if (0 != j9NodeNumber) {
+			/* Failing to bind only costs locality, the memory is still usable */
+			_extensions->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory*)_extensions->heap)->getVmemHandle(), j9NodeNumber, (void*)rangeBase, rangeTop - rangeBase);
+		}
+#endif /* defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER) */
+		rangeBase = rangeTop;
+	}
+}
+
 /**
  * Add the range of memory to the free list of the receiver.
  *
@@ -676,6 +869,10 @@ MM_MemoryPoolSplitAddressOrderedList::expandWithRange(MM_EnvironmentBase* env, u
 		return;
 	}
 
+	if (0 != _numaNodeCount) {
+		setNUMAAffinityForRange(env, lowAddress, highAddress);
+	}
+
 	MM_HeapLinkedFreeHeader** head = NULL;
 	uintptr_t curFreeListIndex = 0;
 	for (curFreeListIndex = 0; curFreeListIndex < _heapFreeListCount; ++curFreeListIndex) {
@@ -1310,3 +1507,19 @@ MM_MemoryPoolSplitAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase*
 
 	return releasedMemory;
 }
+
+uintptr_t
+MM_MemoryPoolSplitAddressOrderedList::releaseIdleFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t granule, uintptr_t* retainBytes)
+{
+	uintptr_t releasedMemory = 0;
+
+	/* The free lists cover ascending address ranges, so retaining in list order retains the lowest free memory */
+	for (uintptr_t i = 0; i < _heapFreeListCountExtended; i++) {
+		_heapFreeLists[i]._lock.acquire();
+		_heapFreeLists[i]._timesLocked += 1;
+		releasedMemory += releaseIdleFreeEntryMemoryPages(env, _heapFreeLists[i]._freeList, granule, retainBytes);
+		_heapFreeLists[i]._lock.release();
+	}
+
+	return releasedMemory;
+}
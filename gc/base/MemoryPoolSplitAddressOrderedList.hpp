@@ -53,6 +53,13 @@ private:
   	MM_HeapLinkedFreeHeader* _previousReservedFreeEntry;	/**< combination _previousReservedFreeEntry and _reservedFreeListIndex are used to identify or update the reservedFreeEntry */
  	uintptr_t _reservedFreeListIndex;		/**< the reservedFreeEntry is initialized only once in first pass iterating after sweep, used/updated only in second pass */
 	bool _reservedFreeEntryAvaliable;	/**< True if the reserved Free Entry can be used */
+	uintptr_t _numaNodeCount; /**< Number of NUMA nodes each owning a contiguous group of free lists (0 unless -Xgc:numaSplitFreeList is in effect) */
+	uintptr_t _freeListsPerNode; /**< Number of consecutive free lists owned by each NUMA node */
+	void *_numaNodeRangeBase; /**< Base of the heap address range split between the NUMA nodes */
+	uintptr_t _numaNodeRangeSize; /**< Size of the address range owned by each NUMA node, node N owns [base + (N - 1) * size, base + N * size) */
+	uintptr_t *_numaNodeFreeBytes; /**< Per node free bytes, scratch space for postProcess() */
+	uintptr_t _numaLocalTLHAllocCount; /**< TLH allocations served from a list of the allocating thread's NUMA node */
+	uintptr_t _numaRemoteTLHAllocCount; /**< TLH allocations by a thread with a known NUMA node served from another node's list */
 protected:
 public:
 	/*
@@ -146,6 +153,35 @@ private:
 	}
 
 	/* helpers for maintaining reserved free entry - end */
+
+	/**
+	 * @return the NUMA node (1-based) owning the heap address range containing addr
+	 */
+	MMINLINE uintptr_t getNUMANodeForAddress(void *addr)
+	{
+		uintptr_t offset = (uintptr_t)addr - (uintptr_t)_numaNodeRangeBase;
+		return OMR_MIN(offset / _numaNodeRangeSize, _numaNodeCount - 1) + 1;
+	}
+
+	/**
+	 * Find the free list a TLH allocation should start searching from.  Under -Xgc:numaSplitFreeList this is one of the
+	 * lists owned by the NUMA node the thread runs on, if that node is known.
+	 *
+	 * @param[out] homeFreeListCount number of lists of the thread's node to search before any other list (0 if the node is not known)
+	 * @return the free list index to start from
+	 */
+	uintptr_t getStartFreeList(MM_EnvironmentBase *env, uintptr_t *homeFreeListCount);
+
+	/**
+	 * Split the free list held in the first list at NUMA node range boundaries, then split each node's share
+	 * across the node's lists by equal free size.
+	 */
+	void splitFreeListByNUMANode(MM_EnvironmentBase *env);
+
+	/**
+	 * Bind the pages of a newly added range to the NUMA nodes owning them.
+	 */
+	void setNUMAAffinityForRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
 	
 protected:
 	virtual void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
@@ -154,6 +190,9 @@ public:
 	static MM_MemoryPoolSplitAddressOrderedList* newInstance(MM_EnvironmentBase* env, uintptr_t minimumFreeEntrySize, uintptr_t maxSplit);
 	static MM_MemoryPoolSplitAddressOrderedList* newInstance(MM_EnvironmentBase* env, uintptr_t minimumFreeEntrySize, uintptr_t maxSplit, const char* name);
 
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
 	virtual void reset(Cause cause = any);
 
 	virtual void addFreeEntries(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader*& freeListHead, MM_HeapLinkedFreeHeader*& freeListTail,
@@ -165,10 +204,14 @@ public:
 
 	virtual void postProcess(MM_EnvironmentBase* env, Cause cause);
 
+	virtual void resetHeapStatistics(bool memoryPoolCollected);
+	virtual void mergeHeapStats(MM_HeapStats *heapStats, bool active);
+
 	virtual void expandWithRange(MM_EnvironmentBase* env, uintptr_t expandSize, void* lowAddress, void* highAddress, bool canCoalesce);
 	virtual void* contractWithRange(MM_EnvironmentBase* env, uintptr_t contractSize, void* lowAddress, void* highAddress);
 
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseIdleFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t granule, uintptr_t* retainBytes);
 
 	/**
 	 * Create a MemoryPoolAddressOrderedList object.
@@ -179,6 +222,13 @@ public:
 		, _previousReservedFreeEntry((MM_HeapLinkedFreeHeader*) UDATA_MAX)
 		, _reservedFreeListIndex(splitAmount)
 		, _reservedFreeEntryAvaliable(false)
+		, _numaNodeCount(0)
+		, _freeListsPerNode(splitAmount)
+		, _numaNodeRangeBase(NULL)
+		, _numaNodeRangeSize(0)
+		, _numaNodeFreeBytes(NULL)
+		, _numaLocalTLHAllocCount(0)
+		, _numaRemoteTLHAllocCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -189,6 +239,13 @@ public:
 		, _previousReservedFreeEntry((MM_HeapLinkedFreeHeader*)UDATA_MAX)
 		, _reservedFreeListIndex(splitAmount)
 		, _reservedFreeEntryAvaliable(false)
+		, _numaNodeCount(0)
+		, _freeListsPerNode(splitAmount)
+		, _numaNodeRangeBase(NULL)
+		, _numaNodeRangeSize(0)
+		, _numaNodeFreeBytes(NULL)
+		, _numaLocalTLHAllocCount(0)
+		, _numaRemoteTLHAllocCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
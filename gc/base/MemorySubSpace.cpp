@@ -948,6 +948,9 @@ MM_MemorySubSpace::systemGarbageCollect(MM_EnvironmentBase* env, uint32_t gcCode
 
 			uintptr_t releasedBytes = _extensions->heap->getDefaultMemorySpace()->releaseFreeMemoryPages(env, releaseMemoryType);
 			uint64_t endTime = omrtime_hires_clock();
+			uint64_t residentBytes = 0;
+			omrvmem_get_process_memory_size(OMRPORT_VMEM_PROCESS_PHYSICAL, &residentBytes);
+			_extensions->heap->getResizeStats()->setReleasedFreePages(releasedBytes, _extensions->heap->getActiveMemorySize(), residentBytes);
 			TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
 				_extensions->privateHookInterface,
 				env->getOmrVMThread(),
@@ -1898,7 +1901,6 @@ MM_MemorySubSpace::runEnqueuedCounterBalancing(MM_EnvironmentBase* env)
 	}
 }
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Replenish a pools free lists to satisfy a given allocate.
  * The given pool was unable to satisfy an allocation request of (at least) the given size.  See if there is work
@@ -1920,7 +1922,6 @@ MM_MemorySubSpace::replenishPoolForAllocate(MM_EnvironmentBase* env, MM_MemoryPo
 	/* We have a parent, forward the request to it */
 	return _parent->replenishPoolForAllocate(env, memoryPool, size);
 }
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 /**
  * Determine whether the given subspace is a descendant of the receiver.
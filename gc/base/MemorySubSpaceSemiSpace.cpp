@@ -889,6 +889,14 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 
 		_lastGCEndTime = scavenger->_cycleTimes.cycleEnd;
 
+		if (doDynamicNewSpaceSizing && (0 != extensions->pauseTimeGoal)) {
+			/* The pause time goal decides once it has enough history, the scavenge time ratio until then */
+			doDynamicNewSpaceSizing = !timeForPauseTimeGoalResize(env, scavengeTime, intervalTime);
+			if (debug && !doDynamicNewSpaceSizing) {
+				omrtty_printf("\tPause time goal decision - expand: %zu contract: %zu\n", _expansionSize, _contractionSize);
+			}
+		}
+
 		if (doDynamicNewSpaceSizing) {
 			double expectedTimeRatio = (extensions->dnssExpectedRatioMaximum._valueSpecified + extensions->dnssExpectedRatioMinimum._valueSpecified) / 2;
 
@@ -1020,6 +1028,61 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 	}
 }
 
+/**
+ * Determine how much to expand or contract the nursery by to meet the pause time and throughput goals
+ * (-Xgc:pauseTimeGoal= and -Xgc:throughputGoal=) and store the result in _expansionSize or _contractionSize.
+ * The bytes flipped stand in for the live set; a single resize is still bounded by the dnss maximum
+ * expansion and contraction.
+ * @param scavengeTime duration of this scavenge in microseconds
+ * @param intervalTime time from the end of the previous scavenge to the end of this one in microseconds
+ * @return false if the model does not have enough history yet
+ */
+bool
+MM_MemorySubSpaceSemiSpace::timeForPauseTimeGoalResize(MM_EnvironmentBase *env, uint64_t scavengeTime, uint64_t intervalTime)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+	uintptr_t currentSize = getCurrentSize();
+	uintptr_t survivorBytes = extensions->scavengerStats._flipBytes;
+	uint64_t timeOutsideGC = (intervalTime > scavengeTime) ? (intervalTime - scavengeTime) : 1;
+
+	_pauseTimeGoalModel.recordSample(extensions->scavengerStats._gcCount, scavengeTime, timeOutsideGC, survivorBytes, currentSize, getApproximateActiveFreeMemorySize());
+
+	uintptr_t maximumSize = getMaximumSize();
+	uintptr_t softMxForNursery = extensions->heap->getActualSoftMxSize(env, MEMORY_TYPE_NEW);
+	if (0 != softMxForNursery) {
+		maximumSize = OMR_MIN(maximumSize, softMxForNursery);
+	}
+	/* The survivors have to fit in survivor space, and as much again has to be left to allocate in */
+	uintptr_t minimumSize = OMR_MAX(getMinimumSize(), 2 * MM_Math::roundToCeiling(2 * regionSize, survivorBytes));
+	uintptr_t targetSize = _pauseTimeGoalModel.calculateTargetSize(survivorBytes, (uint64_t)extensions->pauseTimeGoal * 1000, 100 - extensions->throughputGoal, minimumSize, maximumSize);
+	if (0 == targetSize) {
+		return false;
+	}
+
+	if (targetSize > currentSize) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+			uintptr_t expansionSize = OMR_MIN(targetSize - currentSize, (uintptr_t)(currentSize * extensions->dnssMaximumExpansion));
+			expansionSize = MM_Math::roundToCeiling(extensions->heapAlignment, expansionSize);
+			expansionSize = MM_Math::roundToCeiling(2 * regionSize, expansionSize);
+			_expansionSize = adjustExpansionWithinSoftMax(env, expansionSize, 0, MEMORY_TYPE_NEW);
+			if (0 != _expansionSize) {
+				extensions->heap->getResizeStats()->setLastExpandReason(THROUGHPUT_GOAL_EXPAND);
+			}
+		}
+	} else if (targetSize < currentSize) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canContract(env) && (0 != maxContractionInSpace(env))) {
+			uintptr_t contractionSize = OMR_MIN(currentSize - targetSize, (uintptr_t)(currentSize * extensions->dnssMaximumContraction));
+			_contractionSize = MM_Math::roundToFloor(2 * regionSize, contractionSize);
+			if (0 != _contractionSize) {
+				extensions->heap->getResizeStats()->setLastContractReason(PAUSE_TIME_GOAL_CONTRACT);
+			}
+		}
+	}
+
+	return true;
+}
+
 /**
  * Adjust the sub space memory consumed after a collect.
  * Adjusting semi space memory consumed after a collect includes changing the tilt and/or
@@ -30,6 +30,7 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 #include "MemorySubSpace.hpp"
+#include "PauseTimeGoalModel.hpp"
 
 class MM_AllocateDescription;
 class MM_EnvironmentBase;
@@ -76,6 +77,7 @@ private:
 
 	double _averageScavengeTimeRatio;
 	uint64_t _lastGCEndTime;
+	MM_PauseTimeGoalModel _pauseTimeGoalModel; /**< history of the scavenges, used by -Xgc:pauseTimeGoal= sizing */
 
 	double _desiredSurvivorSpaceRatio;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -102,6 +104,7 @@ private:
 
 	void checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBase *env);
 	void checkSubSpaceMemoryPostCollectResize(MM_EnvironmentBase *env);
+	bool timeForPauseTimeGoalResize(MM_EnvironmentBase *env, uint64_t scavengeTime, uint64_t intervalTime);
 
 protected:
 	virtual void *allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace);
@@ -191,6 +194,7 @@ public:
 		,_tiltedAverageBytesFlippedDelta(0)
 		,_averageScavengeTimeRatio(0.0)
 		,_lastGCEndTime(0)
+		,_pauseTimeGoalModel()
 		,_desiredSurvivorSpaceRatio(0.0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)		
 		,_bytesAllocatedDuringConcurrent(0)
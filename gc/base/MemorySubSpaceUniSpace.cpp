@@ -95,7 +95,8 @@ void
 MM_MemorySubSpaceUniSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool _systemGC)
 {
 	uintptr_t oldVMState = env->pushVMstate(OMRVMSTATE_GC_CHECK_RESIZE);
-	if (!timeForHeapContract(env, allocDescription, _systemGC)) {
+	bool resizedForPauseTimeGoal = (0 != _extensions->pauseTimeGoal) && timeForPauseTimeGoalResize(env, allocDescription, _systemGC);
+	if (!resizedForPauseTimeGoal && !timeForHeapContract(env, allocDescription, _systemGC)) {
 		timeForHeapExpand(env, allocDescription);
 	}
 	env->popVMstate(oldVMState);
@@ -351,6 +352,88 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 }
 
 
+/**
+ * Determine how much to expand or contract by to meet the pause time and throughput goals
+ * (-Xgc:pauseTimeGoal= and -Xgc:throughputGoal=) and store the result in _expansionSize or _contractionSize.
+ * The goals replace -Xminf/-Xmaxf and the GC time ratio thresholds; -Xmine/-Xmaxe, -Xsoftmx and the
+ * maximum contraction per collection still apply.
+ * @return false if the free ratio heuristics have to decide instead, because the model does not have enough
+ * history yet or the pending allocation can not be satisfied without expanding
+ */
+bool
+MM_MemorySubSpaceUniSpace::timeForPauseTimeGoalResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool systemGC)
+{
+#if defined(OMR_GC_MODRON_STANDARD)
+	if (!_extensions->isStandardGC() || (NULL == _physicalSubArena)) {
+		return false;
+	}
+
+	uintptr_t allocSize = 0;
+	if (NULL != allocDescription) {
+		allocSize = allocDescription->getBytesRequested();
+		if (env->getMemorySpace()->findLargestFreeEntry(env, allocDescription) < allocSize) {
+			return false;
+		}
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_HeapResizeStats *resizeStats = _extensions->heap->getResizeStats();
+	uintptr_t currentSize = getActiveMemorySize();
+	uintptr_t currentFree = getApproximateActiveFreeMemorySize();
+	uintptr_t liveBytes = (currentSize > currentFree) ? (currentSize - currentFree) : 0;
+	uint64_t pauseTimeGoal = (uint64_t)_extensions->pauseTimeGoal * 1000;
+
+	/* System collections say little about the application's steady state, so they are sized from the model but not added to it */
+	if (!systemGC) {
+		uint64_t pauseTime = omrtime_hires_delta(_extensions->globalGCStats.markStats._startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t intervalTime = omrtime_hires_delta(0, resizeStats->getLastTimeOutsideGC(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		_pauseTimeGoalModel.recordSample(_extensions->globalGCStats.gcCount, pauseTime, intervalTime, liveBytes, currentSize, currentFree);
+	}
+
+	uintptr_t maximumSize = getMaximumSize();
+	uintptr_t actualSoftMx = _extensions->heap->getActualSoftMxSize(env);
+	if (0 != actualSoftMx) {
+		maximumSize = OMR_MIN(maximumSize, actualSoftMx);
+	}
+	uintptr_t minimumSize = MM_Math::roundToCeiling(_extensions->regionSize, liveBytes + allocSize) + _extensions->regionSize;
+	uintptr_t targetSize = _pauseTimeGoalModel.calculateTargetSize(liveBytes, pauseTimeGoal, 100 - _extensions->throughputGoal, minimumSize, maximumSize);
+	if (0 == targetSize) {
+		return false;
+	}
+
+	_expansionSize = 0;
+	_contractionSize = 0;
+	if (targetSize > currentSize) {
+		if (_physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+			uintptr_t expandSize = MM_Math::roundToCeiling(_extensions->heapAlignment, targetSize - currentSize);
+			expandSize = adjustExpansionWithinFreeLimits(env, expandSize);
+			expandSize = adjustExpansionWithinUserIncrement(env, expandSize);
+			_expansionSize = adjustExpansionWithinSoftMax(env, expandSize, 0, MEMORY_TYPE_OLD);
+			if (0 != _expansionSize) {
+				resizeStats->setLastExpandReason(THROUGHPUT_GOAL_EXPAND);
+			}
+		}
+	} else if (targetSize < currentSize) {
+		/* A missed pause goal contracts right away, contracting for footprint waits for the heap to settle after an expansion */
+		bool pauseTimeGoalMissed = _pauseTimeGoalModel.predictPauseTime(liveBytes, currentSize) > pauseTimeGoal;
+		bool settled = resizeStats->getLastHeapExpansionGCCount() + _extensions->heapContractionStabilizationCount <= _extensions->globalGCStats.gcCount;
+		if ((pauseTimeGoalMissed || settled) && _physicalSubArena->canContract(env) && (0 != maxContraction(env))) {
+			uintptr_t maxContract = OMR_MAX(_extensions->regionSize, (uintptr_t)(currentSize * _extensions->globalMaximumContraction));
+			uintptr_t minContract = (uintptr_t)(currentSize * _extensions->globalMinimumContraction);
+			uintptr_t contractSize = MM_Math::roundToFloor(_extensions->regionSize, OMR_MIN(currentSize - targetSize, maxContract));
+			if ((0 != contractSize) && (contractSize >= minContract)) {
+				_contractionSize = contractSize;
+				resizeStats->setLastContractReason(PAUSE_TIME_GOAL_CONTRACT);
+			}
+		}
+	}
+
+	return true;
+#else /* defined(OMR_GC_MODRON_STANDARD) */
+	return false;
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+}
+
 /**
  * Determine the amount of heap to contract.
  * Calculate the contraction size while factoring in the pending allocate and whether a contract based on
@@ -30,6 +30,7 @@
 #define MEMORYSUBSPACEUNISPACE_HPP_
 
 #include "MemorySubSpace.hpp"
+#include "PauseTimeGoalModel.hpp"
 
 #define HEAP_FREE_RATIO_EXPAND_DIVISOR		100
 #define HEAP_FREE_RATIO_EXPAND_MULTIPLIER	17
@@ -41,6 +42,9 @@
  */
 class MM_MemorySubSpaceUniSpace : public MM_MemorySubSpace
 {
+private:
+	MM_PauseTimeGoalModel _pauseTimeGoalModel; /**< history of the collections of this space, used by -Xgc:pauseTimeGoal= sizing */
+
 protected:
 	uintptr_t adjustExpansionWithinFreeLimits(MM_EnvironmentBase *env, uintptr_t expandSize);
 	uintptr_t checkForRatioExpand(MM_EnvironmentBase *env, uintptr_t bytesRequired);	
@@ -50,6 +54,7 @@ protected:
 	uintptr_t calculateTargetContractSize(MM_EnvironmentBase *env, uintptr_t allocSize, bool ratioContract);
 	bool timeForHeapContract(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool systemGC);
 	bool timeForHeapExpand(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);	
+	bool timeForPauseTimeGoalResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool systemGC);
 	uintptr_t performExpand(MM_EnvironmentBase *env);
 	uintptr_t performContract(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 	uintptr_t getHeapFreeMaximumHeuristicMultiplier(MM_EnvironmentBase *env);
@@ -66,6 +71,7 @@ public:
 		bool usesGlobalCollector, uintptr_t minimumSize, uintptr_t initialSize, uintptr_t maximumSize, uintptr_t memoryFlags, uint32_t objectFlags)
 	:
 		MM_MemorySubSpace(env, NULL, physicalSubArena, usesGlobalCollector, minimumSize, initialSize, maximumSize, memoryFlags, objectFlags)
+		, _pauseTimeGoalModel()
 	{
 		_typeId = __FUNCTION__;
 	};
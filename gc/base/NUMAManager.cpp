@@ -213,6 +213,22 @@ MM_NUMAManager::getMaximumNodeNumber() const
 	return _maximumNodeNumber;
 }
 
+uintptr_t
+MM_NUMAManager::getAffinityLeaderForCurrentThread() const
+{
+	uintptr_t affinityLeader = 0;
+	if (_physicalNumaEnabled) {
+		uintptr_t j9NodeNumber = omrthread_numa_get_current_node();
+		for (uintptr_t i = 0; i < _affinityLeaderCount; i++) {
+			if (_affinityLeaders[i].j9NodeNumber == j9NodeNumber) {
+				affinityLeader = i + 1;
+				break;
+			}
+		}
+	}
+	return affinityLeader;
+}
+
 J9MemoryNodeDetail const*
 MM_NUMAManager::getAffinityLeaders(uintptr_t *arrayLength) const
 {
@@ -111,6 +111,12 @@ public:
 	 */
 	uintptr_t getMaximumNodeNumber() const;
 
+	/**
+	 * Find the affinity leader the calling thread is currently executing on.
+	 * @return the affinity leader index, where 1 is the first node (0 if physical NUMA is not enabled or the thread runs on a node without memory)
+	 */
+	uintptr_t getAffinityLeaderForCurrentThread() const;
+
 	/**
 	 * Returns access to the array of nodes which the receiver has determined are to act as affinity leaders.
 	 * NOTE:  The returned array should NOT be modified!
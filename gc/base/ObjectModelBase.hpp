@@ -813,6 +813,34 @@ public:
 		return _delegate.getHotFieldOffset3(forwardedHeader);
 	}
 
+	/**
+	 * Get the hottest sampled reference slots for objects shaped like the object referred to by the forwarded header,
+	 * hottest first. Valid if scavenger hot field co-location is enabled (-Xgc:hotFieldCoLocation=).
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @param[out] offsets receives slot offsets (in slots, relative to the object address) of the hot fields
+	 * @param maxOffsets maximum number of offsets to return
+	 * @return the number of offsets returned
+	 */
+	MMINLINE uintptr_t
+	getCoLocatedHotFieldOffsets(MM_ForwardedHeader *forwardedHeader, uint8_t *offsets, uintptr_t maxOffsets)
+	{
+		return _delegate.getCoLocatedHotFieldOffsets(forwardedHeader, offsets, maxOffsets);
+	}
+
+	/**
+	 * Record a sampled parent->child reference whose child was copied while the parent was scanned. The
+	 * samples feed the ranking returned by getCoLocatedHotFieldOffsets().
+	 *
+	 * @param objectPtr the parent object (already copied)
+	 * @param slotOffset offset of the referencing slot (in slots, relative to the object address)
+	 */
+	MMINLINE void
+	sampleHotFieldReference(omrobjectptr_t objectPtr, uintptr_t slotOffset)
+	{
+		_delegate.sampleHotFieldReference(objectPtr, slotOffset);
+	}
+
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
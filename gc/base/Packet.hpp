@@ -241,6 +241,7 @@ protected:
 	friend class MM_PacketSlotIterator;
 	friend class MM_WorkPackets;
 	friend class MM_WorkPacketsSATB;
+	friend class MM_WorkPacketsWorkStealing;
 };
 
 #endif /* PACKET_HPP_ */
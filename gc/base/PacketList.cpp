@@ -35,6 +35,11 @@ MM_PacketList::initialize(MM_EnvironmentBase *env)
 	
 	_sublistCount = extensions->packetListSplit;
 	Assert_MM_true(0 < _sublistCount);
+	_sublistsPerNode = _sublistCount;
+	uintptr_t affinityLeaderCount = extensions->_numaManager.getAffinityLeaderCount();
+	if (extensions->numaAwareParallelGC && (1 < affinityLeaderCount) && (0 == (_sublistCount % affinityLeaderCount))) {
+		_sublistsPerNode = _sublistCount / affinityLeaderCount;
+	}
 
 	_sublists = (struct PacketSublist *)extensions->getForge()->allocate(sizeof(struct PacketSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
@@ -72,6 +72,7 @@ private:
 	struct PacketSublist *_sublists;	/**< An array of PacketSublist structures which is _sublistCount elements long */
 	
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _sublistsPerNode; /**< the number of consecutive sublists owned by each NUMA node (equal to _sublistCount unless -Xgc:numaAwareParallelGC is in effect) */
 	volatile uintptr_t _count;  /**< Number of items in the list */
 	
 /* Functionality Section */
@@ -119,7 +120,31 @@ private:
 	MMINLINE uintptr_t
 	getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		uintptr_t numaNode = env->getNumaNode();
+		if ((0 == numaNode) || (_sublistsPerNode == _sublistCount)) {
+			return env->getEnvironmentId() % _sublistCount;
+		}
+		uintptr_t nodeStart = ((numaNode - 1) * _sublistsPerNode) % _sublistCount;
+		return nodeStart + (env->getEnvironmentId() % _sublistsPerNode);
+	}
+
+	/**
+	 * Determine the sublist to search at the given step of a pop starting at homeIndex.
+	 * All sublists of the home node are visited before those of any remote node.
+	 *
+	 * @param homeIndex the index returned by getSublistIndex()
+	 * @param step the number of sublists already searched
+	 *
+	 * @return an index into the _sublists array
+	 */
+	MMINLINE uintptr_t
+	getSearchIndex(uintptr_t homeIndex, uintptr_t step)
+	{
+		uintptr_t nodeStart = homeIndex - (homeIndex % _sublistsPerNode);
+		if (step < _sublistsPerNode) {
+			return nodeStart + ((homeIndex - nodeStart + step) % _sublistsPerNode);
+		}
+		return (nodeStart + step) % _sublistCount;
 	}
 		
 protected:
@@ -186,11 +211,11 @@ public:
 	 */
 	MMINLINE MM_Packet *pop(MM_EnvironmentBase *env)
 	{
-		uintptr_t index = getSublistIndex(env);
+		uintptr_t homeIndex = getSublistIndex(env);
 		MM_Packet *packet = NULL;
 
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
-			PacketSublist *list = &_sublists[index];
+			PacketSublist *list = &_sublists[getSearchIndex(homeIndex, i)];
 
 			if (NULL != list->_head) {
 				list->_lock.acquire();
@@ -207,11 +232,16 @@ public:
 				list->_lock.release();
 
 				if (NULL != packet) {
+					if ((0 != env->getNumaNode()) && (_sublistsPerNode != _sublistCount)) {
+						if (i < _sublistsPerNode) {
+							env->_workPacketStats._nodeLocalPops += 1;
+						} else {
+							env->_workPacketStats._nodeRemotePops += 1;
+						}
+					}
 					break;
 				}
 			}
-			
-			index = (index + 1) %  _sublistCount;
 		}
 
 		return packet;
@@ -253,6 +283,7 @@ public:
 		MM_BaseNonVirtual()
 		,_sublists(NULL)
 		,_sublistCount(0)
+		,_sublistsPerNode(0)
 		,_count(0)
 	{
 		_typeId = __FUNCTION__;
@@ -77,6 +77,7 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 	env->setWorkerID(workerID);
 	/* Enviroment initialization specific for GC threads (after worker ID is set) */
 	env->initializeGCThread();
+	dispatcher->bindWorkerToNUMANode(env);
 
 	/* Signal that the thread was created succesfully */
 	workerInfo->workerFlags = WORKER_INFO_FLAG_OK;
@@ -138,6 +139,27 @@ dispatcher_thread_proc(void *info)
 } /* extern "C" */
 
 
+void
+MM_ParallelDispatcher::bindWorkerToNUMANode(MM_EnvironmentBase *env)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+	uintptr_t affinityLeaderCount = numaManager->getAffinityLeaderCount();
+
+	if (_extensions->numaAwareParallelGC && (1 < affinityLeaderCount) && (0 == env->getNumaNode())) {
+		uintptr_t numaNode = (env->getWorkerID() % affinityLeaderCount) + 1;
+		if (numaManager->isPhysicalNUMASupported()) {
+			/* a mutator acting as the main GC thread keeps running Java code afterwards, so only move it if mutator affinity may be changed */
+			bool bindThread = (MUTATOR_THREAD != env->getThreadType()) || numaManager->shouldSetCPUAffinity();
+			uintptr_t j9NodeNumber = numaManager->getJ9NodeNumber(numaNode);
+			if (!bindThread || !env->setNumaAffinity(&j9NodeNumber, 1)) {
+				/* leave the thread unbound rather than have it pretend to be local to a node it does not run on */
+				numaNode = 0;
+			}
+		}
+		env->setNumaNode(numaNode);
+	}
+}
+
 /**
  * Run the main loop for a fully-constructed worker thread.
  * Subclasses can override this to have their own method of controlling worker
@@ -599,6 +621,8 @@ void
 MM_ParallelDispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount)
 {
 	uintptr_t activeThreads = recomputeActiveThreadCountForTask(env, task, newThreadCount);
+	/* the thread running the task is worker 0 and takes part in node-local work distribution like any other worker */
+	bindWorkerToNUMANode(env);
 	task->mainSetup(env);
 	prepareThreadsForTask(env, task, activeThreads);
 	acceptTask(env);
@@ -116,6 +116,17 @@ protected:
 	virtual uintptr_t recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount); 
 
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
+
+	/**
+	 * Bind a GC thread to a NUMA node (round-robin over the affinity leaders by worker ID) so that
+	 * node-local packet and scan cache lists are used by threads running on that node. Called for each
+	 * worker as it starts and for worker 0 (the thread calling run()) before every task.
+	 * Only performed under -Xgc:numaAwareParallelGC when more than one affinity leader is available,
+	 * and only for threads not already placed on a node.
+	 *
+	 * @param[in] env the GC thread to bind, with its worker ID already set
+	 */
+	virtual void bindWorkerToNUMANode(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
 	
@@ -52,6 +52,7 @@ private:
 	MM_HeapWalkerObjectFunc _function;
 	void *_userData;
 	uintptr_t _walkFlags;
+	bool _markedObjectsOnly; /**< Walk only the objects set in the mark map */
 
 	MM_ParallelHeapWalker *_heapWalker;
 
@@ -69,11 +70,12 @@ public:
 	/*
 	 * Create a ParallelObjectAndVMSlotsDoTask object.
 	 */
-	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel)
+	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool markedObjectsOnly = false)
 		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
 		, _function(function)
 		, _userData(userData)
 		, _walkFlags(walkFlags)
+		, _markedObjectsOnly(markedObjectsOnly)
 		, _heapWalker(heapWalker)
 	{
 		_typeId = __FUNCTION__;
@@ -141,6 +143,65 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Exit(env->getLanguageVMThread(), heapChunkFactor, parallelChunkSize, objectsWalked);
 }
 
+/**
+ * Walk through all marked objects of the heap in parallel and apply the provided function.
+ * Regions are split into chunks covering whole mark map words, handed out as work units. Within a chunk
+ * the mark map is scanned a word (64 heap map bits) at a time, so dead space is skipped without being parsed.
+ */
+void
+MM_ParallelHeapWalker::allMarkedObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags)
+{
+	Trc_MM_ParallelHeapWalker_allMarkedObjectsDoParallel_Entry(env->getLanguageVMThread());
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* determine the size of the chunks to use for parallel walks */
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / (threadCount * 8);
+	parallelChunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, parallelChunkSize);
+	parallelChunkSize = MM_Math::roundToCeiling(J9MODRON_HMI_HEAPMAP_ALIGNMENT, parallelChunkSize);
+
+	uintptr_t objectsWalked = 0;
+	MM_Heap *heap = extensions->heap;
+	MM_HeapRegionManager *regionManager = heap->getHeapRegionManager();
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
+			objectsWalked += markedObjectsDoParallel(env, region, function, userData, parallelChunkSize);
+		}
+	}
+	regionManager->unlock();
+	Trc_MM_ParallelHeapWalker_allMarkedObjectsDoParallel_Exit(env->getLanguageVMThread(), parallelChunkSize, objectsWalked);
+}
+
+uintptr_t
+MM_ParallelHeapWalker::markedObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t chunkSize)
+{
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	MM_HeapMapIterator markedObjectIterator(env->getExtensions());
+	uintptr_t objectsWalked = 0;
+	uintptr_t regionTop = (uintptr_t)region->getHighAddress();
+
+	/* An object belongs to the chunk holding its mark bit, so unlike a parsing walk a chunk needs no object
+	 * aligned starting point and may begin inside an object that started in the previous chunk.
+	 */
+	for (uintptr_t chunkBase = (uintptr_t)region->getLowAddress(); chunkBase < regionTop; chunkBase += chunkSize) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t chunkTop = ((regionTop - chunkBase) > chunkSize) ? (chunkBase + chunkSize) : regionTop;
+			markedObjectIterator.reset(_markMap, (uintptr_t *)chunkBase, (uintptr_t *)chunkTop);
+			omrobjectptr_t object = NULL;
+			while (NULL != (object = markedObjectIterator.nextObject())) {
+				function(omrVMThread, region, object, userData);
+				objectsWalked += 1;
+			}
+		}
+	}
+
+	return objectsWalked;
+}
+
 /**
  * Walk through all live objects of the heap and apply the provided function.
  * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
@@ -162,11 +223,38 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+bool
+MM_ParallelHeapWalker::allMarkedObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags)
+{
+	bool markMapValid = _markMap->isMarkMapValid();
+	bool usingSATBBarrier = env->getExtensions()->usingSATBBarrier();
+	bool markedObjectsOnly = markMapValid && !usingSATBBarrier;
+
+	if (markedObjectsOnly) {
+		GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+
+		MM_ParallelObjectDoTask objectDoTask(env, this, function, userData, walkFlags, true, true);
+		env->getExtensions()->dispatcher->run(env, &objectDoTask);
+	} else {
+		/* Typically a walk of a running heap: there is no mark map to use without running a mark phase, whose
+		 * root scanning and clearable processing (e.g. clearing weak references) must not happen outside a GC.
+		 */
+		Trc_MM_ParallelHeapWalker_allMarkedObjectsDo_fallBack(env->getLanguageVMThread(), (uintptr_t)markMapValid, (uintptr_t)usingSATBBarrier);
+		allObjectsDo(env, function, userData, walkFlags, true, false);
+	}
+
+	return markedObjectsOnly;
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
 void
 MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
-	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
+	if (_markedObjectsOnly) {
+		_heapWalker->allMarkedObjectsDoParallel(env, _function, _userData, _walkFlags);
+	} else {
+		_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
+	}
 }
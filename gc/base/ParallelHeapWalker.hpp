@@ -29,6 +29,7 @@
 #include "HeapWalker.hpp"
 
 class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
 class MM_ParallelGlobalGC;
 class MM_MarkMap;
 
@@ -47,6 +48,11 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Walk the marked objects of a region, handing out mark-map-aligned chunks of the region as work units.
+	 * @return the number of objects walked by the calling thread
+	 */
+	uintptr_t markedObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t chunkSize);
 protected:
 public:	
 	/**
@@ -54,6 +60,27 @@ public:
 	 */
 	void allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
 
+	/**
+	 * Walk through all marked objects of the heap in parallel and apply the provided function.
+	 */
+	void allMarkedObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
+
+	/**
+	 * Walk through the live objects of the heap in parallel and apply the provided function, skipping dead
+	 * space using the mark map rather than parsing it. Intended for heap dump and census style walks made at
+	 * the end of a global cycle, which need not see (and fix up) dead objects.
+	 *
+	 * The mark map describes the live set from the end of the mark phase of a global collection until the end
+	 * of that collection (unless it compacts), so the walk must be made from within that window, e.g. from a
+	 * J9HOOK_MM_OMR_GC_CYCLE_END handler of a global cycle. Walks of a running heap are not served: anywhere
+	 * else (or when SATB marking is in use) the mark map cannot be trusted and this falls back to a parallel
+	 * allObjectsDo(), which also walks dead objects and is traced as such.
+	 *
+	 * @return true if only the marked objects were walked, false if the walk fell back to allObjectsDo() and
+	 * the function was also applied to dead objects
+	 */
+	bool allMarkedObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
+
 	/**
 	 * Walk through all live objects of the heap and apply the provided function.
 	 * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
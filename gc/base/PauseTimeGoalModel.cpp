@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "PauseTimeGoalModel.hpp"
+
+void
+MM_PauseTimeGoalModel::recordSample(uintptr_t gcCount, uint64_t pauseTime, uint64_t intervalTime, uintptr_t liveBytes, uintptr_t spaceSize, uintptr_t freeBytes)
+{
+	if ((0 == _sampleCount) || (getSample(0)->gcCount != gcCount)) {
+		_sampleCount += 1;
+	}
+
+	Sample *sample = getSample(0);
+	sample->gcCount = gcCount;
+	sample->pauseTime = pauseTime;
+	sample->intervalTime = intervalTime;
+	sample->liveBytes = liveBytes;
+	sample->spaceSize = spaceSize;
+	sample->freeBytes = freeBytes;
+
+	fitModel();
+}
+
+void
+MM_PauseTimeGoalModel::fitModel()
+{
+	uintptr_t historyCount = OMR_MIN(_sampleCount, PAUSE_TIME_GOAL_MODEL_HISTORIES);
+	double sumLiveLive = 0.0;
+	double sumSizeSize = 0.0;
+	double sumLiveSize = 0.0;
+	double sumLivePause = 0.0;
+	double sumSizePause = 0.0;
+
+	for (uintptr_t age = 0; age < historyCount; age++) {
+		Sample *sample = getSample(age);
+		double live = (double)sample->liveBytes;
+		double size = (double)sample->spaceSize;
+		double pause = (double)sample->pauseTime;
+		sumLiveLive += live * live;
+		sumSizeSize += size * size;
+		sumLiveSize += live * size;
+		sumLivePause += live * pause;
+		sumSizePause += size * pause;
+	}
+
+	/* Least squares fit of pause = liveCost * live + sizeCost * size.  While live set and size
+	 * have moved together the two can not be told apart, so fall back to a single term.
+	 */
+	_liveCost = 0.0;
+	_sizeCost = 0.0;
+	double determinant = (sumLiveLive * sumSizeSize) - (sumLiveSize * sumLiveSize);
+	if ((2 <= historyCount) && (determinant > (sumLiveLive * sumSizeSize * 1.0e-6))) {
+		_liveCost = ((sumLivePause * sumSizeSize) - (sumSizePause * sumLiveSize)) / determinant;
+		_sizeCost = ((sumSizePause * sumLiveLive) - (sumLivePause * sumLiveSize)) / determinant;
+	}
+	if ((0.0 >= _liveCost) || (0.0 > _sizeCost)) {
+		if ((0.0 < _sizeCost) || (0.0 == sumLiveLive)) {
+			_liveCost = 0.0;
+			_sizeCost = (0.0 < sumSizeSize) ? (sumSizePause / sumSizeSize) : 0.0;
+		} else {
+			_liveCost = sumLivePause / sumLiveLive;
+			_sizeCost = 0.0;
+		}
+	}
+
+	/* The free space left by one collection is what was allocated before the next one */
+	double sumAllocated = 0.0;
+	double sumInterval = 0.0;
+	for (uintptr_t age = 0; (age + 1) < historyCount; age++) {
+		sumAllocated += (double)getSample(age + 1)->freeBytes;
+		sumInterval += (double)getSample(age)->intervalTime;
+	}
+	_allocationRate = (0.0 < sumInterval) ? (sumAllocated / sumInterval) : 0.0;
+}
+
+uintptr_t
+MM_PauseTimeGoalModel::calculateTargetSize(uintptr_t liveBytes, uint64_t pauseTimeGoal, uintptr_t gcPercentageGoal, uintptr_t minimumSize, uintptr_t maximumSize)
+{
+	if ((2 > _sampleCount) || (0.0 == _allocationRate)) {
+		return 0;
+	}
+
+	double live = (double)liveBytes;
+	double targetSize = (double)maximumSize;
+
+	/* Throughput: the time to allocate the free space, (size - live) * freeFraction / allocationRate, has to
+	 * be at least (100 - gcPercentageGoal) / gcPercentageGoal times the pause predicted for that size.
+	 * If no size can satisfy this, the best the throughput goal can get is the maximum size.
+	 */
+	Sample *last = getSample(0);
+	if ((0 < gcPercentageGoal) && (100 > gcPercentageGoal) && (last->spaceSize > last->liveBytes) && (0 != last->freeBytes)) {
+		double freeFraction = (double)last->freeBytes / (double)(last->spaceSize - last->liveBytes);
+		double outsideGCRatio = (double)(100 - gcPercentageGoal) / (double)gcPercentageGoal;
+		double pauseCostPerByte = (_allocationRate / freeFraction) * outsideGCRatio;
+		double denominator = 1.0 - (pauseCostPerByte * _sizeCost);
+		if (0.0 < denominator) {
+			targetSize = (live * (1.0 + (pauseCostPerByte * _liveCost))) / denominator;
+		}
+	}
+
+	/* Pause: a larger space only costs pause time through the size term */
+	if (0.0 < _sizeCost) {
+		double pauseBoundSize = ((double)pauseTimeGoal - (_liveCost * live)) / _sizeCost;
+		targetSize = OMR_MIN(targetSize, pauseBoundSize);
+	}
+
+	if (targetSize < (double)minimumSize) {
+		return minimumSize;
+	}
+	if (targetSize > (double)maximumSize) {
+		return maximumSize;
+	}
+	return (uintptr_t)targetSize;
+}
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(PAUSETIMEGOALMODEL_HPP_)
+#define PAUSETIMEGOALMODEL_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+#define PAUSE_TIME_GOAL_MODEL_HISTORIES		8
+
+/**
+ * History of the collections of one memory sub space and the model built from it that
+ * predicts pause time from live set and space size.  Used to size a space so that the
+ * pause time goal (-Xgc:pauseTimeGoal=) and the throughput goal (-Xgc:throughputGoal=) are met.
+ *
+ * The pause is modelled as a * liveBytes + b * spaceSize (tracing cost plus sweeping or
+ * flipping cost) fitted by least squares over the history, and the time between collections
+ * as the free space left after a collection divided by the observed allocation rate.
+ * @ingroup GC_Base_Core
+ */
+class MM_PauseTimeGoalModel : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct Sample {
+		uintptr_t gcCount; /**< collection the sample was taken for */
+		uint64_t pauseTime; /**< pause time in microseconds */
+		uint64_t intervalTime; /**< time outside GC before the collection, in microseconds */
+		uintptr_t liveBytes; /**< bytes live in the space after the collection */
+		uintptr_t spaceSize; /**< size of the space during the collection */
+		uintptr_t freeBytes; /**< bytes free for allocation after the collection */
+	};
+
+	Sample _samples[PAUSE_TIME_GOAL_MODEL_HISTORIES];
+	uintptr_t _sampleCount; /**< total number of samples recorded, the history holds the latest PAUSE_TIME_GOAL_MODEL_HISTORIES */
+
+	double _liveCost; /**< fitted pause microseconds per live byte */
+	double _sizeCost; /**< fitted pause microseconds per byte of space */
+	double _allocationRate; /**< bytes allocated per microsecond outside GC, 0 if not known yet */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	void fitModel();
+
+	MMINLINE Sample *getSample(uintptr_t age)
+	{
+		return &_samples[(_sampleCount - 1 - age) % PAUSE_TIME_GOAL_MODEL_HISTORIES];
+	}
+
+protected:
+public:
+	/**
+	 * Record a collection of the space.  A second sample for the same collection (resize
+	 * checked again after the free list was rebuilt) replaces the first one.
+	 */
+	void recordSample(uintptr_t gcCount, uint64_t pauseTime, uint64_t intervalTime, uintptr_t liveBytes, uintptr_t spaceSize, uintptr_t freeBytes);
+
+	/**
+	 * Calculate the space size that meets the goals for the given live set.  The pause time goal
+	 * wins over the throughput goal, and the result is kept within [minimumSize, maximumSize].
+	 * @param pauseTimeGoal maximum pause in microseconds
+	 * @param gcPercentageGoal maximum percentage of time spent in GC
+	 * @return the target size, or 0 if there is not enough history to predict from yet
+	 */
+	uintptr_t calculateTargetSize(uintptr_t liveBytes, uint64_t pauseTimeGoal, uintptr_t gcPercentageGoal, uintptr_t minimumSize, uintptr_t maximumSize);
+
+	/**
+	 * @return the pause in microseconds the model predicts for the given live set and space size
+	 */
+	MMINLINE uint64_t predictPauseTime(uintptr_t liveBytes, uintptr_t spaceSize)
+	{
+		return (uint64_t)((_liveCost * (double)liveBytes) + (_sizeCost * (double)spaceSize));
+	}
+
+	MMINLINE void reset() { _sampleCount = 0; _liveCost = 0.0; _sizeCost = 0.0; _allocationRate = 0.0; }
+
+	MM_PauseTimeGoalModel() :
+		MM_Base(),
+		_sampleCount(0),
+		_liveCost(0.0),
+		_sizeCost(0.0),
+		_allocationRate(0.0)
+	{
+	}
+};
+
+#endif /* PAUSETIMEGOALMODEL_HPP_ */
@@ -37,6 +37,12 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCSUMMARY_COMPACTION "-Xgc:summaryCompaction"
+#define OMR_XGCSUMMARY_COMPACTION_LENGTH 22
+#define OMR_XGCINCREMENTAL_COMPACTION_BUDGET "-Xgc:incrementalCompactionBudget="
+#define OMR_XGCINCREMENTAL_COMPACTION_BUDGET_LENGTH 33
+#define OMR_XGCINCREMENTAL_COMPACTION_GARBAGE_THRESHOLD "-Xgc:incrementalCompactionGarbageThreshold="
+#define OMR_XGCINCREMENTAL_COMPACTION_GARBAGE_THRESHOLD_LENGTH 43
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,8 +54,56 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH 28
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCVERBOSE_BINARY_FORMAT "-Xgc:verboseBinaryFormat"
+#define OMR_XGCVERBOSE_BINARY_FORMAT_LENGTH 24
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCWORKSTEALING_MARKING "-Xgc:workStealingMarking"
+#define OMR_XGCWORKSTEALING_MARKING_LENGTH 24
+#define OMR_XGCNUMA_AWARE_PARALLEL "-Xgc:numaAwareParallelGC"
+#define OMR_XGCNUMA_AWARE_PARALLEL_LENGTH 24
+#define OMR_XGCNUMA_SPLIT_FREE_LIST "-Xgc:numaSplitFreeList"
+#define OMR_XGCNUMA_SPLIT_FREE_LIST_LENGTH 22
+#define OMR_XGCMARKING_PREFETCH_DEPTH "-Xgc:markingPrefetchDepth="
+#define OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH 26
+#define OMR_XGCLAZY_SWEEP "-Xgc:lazySweep"
+#define OMR_XGCLAZY_SWEEP_LENGTH 14
+#define OMR_XGCTLH_REFRESH_TARGET "-Xgc:tlhRefreshTarget="
+#define OMR_XGCTLH_REFRESH_TARGET_LENGTH 22
+#define OMR_XGCFREE_ENTRY_SIZE_CLASS_CACHE "-Xgc:freeEntrySizeClassCache"
+#define OMR_XGCFREE_ENTRY_SIZE_CLASS_CACHE_LENGTH 28
+#define OMR_XGCPAUSE_TIME_GOAL "-Xgc:pauseTimeGoal="
+#define OMR_XGCPAUSE_TIME_GOAL_LENGTH 19
+#define OMR_XGCTHROUGHPUT_GOAL "-Xgc:throughputGoal="
+#define OMR_XGCTHROUGHPUT_GOAL_LENGTH 20
+#define OMR_XGCRELEASE_FREE_PAGES_AFTER_GC "-Xgc:releaseFreePagesAfterGC"
+#define OMR_XGCRELEASE_FREE_PAGES_AFTER_GC_LENGTH 28
+#define OMR_XGCRELEASE_FREE_PAGES_GRANULE "-Xgc:releaseFreePagesGranule="
+#define OMR_XGCRELEASE_FREE_PAGES_GRANULE_LENGTH 29
+#define OMR_XGCALLOCATION_SITE_SAMPLING_BYTES "-Xgc:allocationSiteSamplingBytes="
+#define OMR_XGCALLOCATION_SITE_SAMPLING_BYTES_LENGTH 33
+#define OMR_XGCALLOCATION_SITE_SAMPLING_DEPTH "-Xgc:allocationSiteSamplingDepth="
+#define OMR_XGCALLOCATION_SITE_SAMPLING_DEPTH_LENGTH 33
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCSWEEP_INCREMENT_MICRO "-Xgc:sweepIncrementMicro="
+#define OMR_XGCSWEEP_INCREMENT_MICRO_LENGTH 25
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCONCURRENT_BACKGROUND_MAX "-Xgc:concurrentBackgroundMax="
+#define OMR_XGCCONCURRENT_BACKGROUND_MAX_LENGTH 29
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#define OMR_XGCADAPTIVE_SCAN_CACHE_SIZING "-Xgc:adaptiveScanCacheSizing"
+#define OMR_XGCADAPTIVE_SCAN_CACHE_SIZING_LENGTH 28
+#define OMR_XGCHOT_FIELD_CO_LOCATION "-Xgc:hotFieldCoLocation="
+#define OMR_XGCHOT_FIELD_CO_LOCATION_LENGTH 24
+#define OMR_XGCREMEMBERED_SET_OVERFLOW_CARDS "-Xgc:rememberedSetOverflowCards"
+#define OMR_XGCREMEMBERED_SET_OVERFLOW_CARDS_LENGTH 31
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -230,6 +284,13 @@ MM_StartupManager::loadGcOptions(MM_GCExtensionsBase *extensions)
 	/* Now override defaults with specified settings, if any */
 	bool result = parseGcOptions(extensions);
 
+	/* the binary writer formats and writes its records itself, it can not be combined with another file writer */
+	if (result && extensions->verboseBinaryFormat && (extensions->asyncLogging || extensions->bufferedLogging)) {
+		omrtty_printf("Error parsing OMR GC options: %s can not be combined with %s\n",
+				OMR_XGCVERBOSE_BINARY_FORMAT, extensions->asyncLogging ? OMR_XGCASYNC_LOGGING : OMR_XGCBUFFERED_LOGGING);
+		result = false;
+	}
+
 	return result;
 }
 
@@ -264,6 +325,25 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCSUMMARY_COMPACTION, OMR_XGCSUMMARY_COMPACTION_LENGTH)) {
+		extensions->summaryCompaction = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCINCREMENTAL_COMPACTION_BUDGET, OMR_XGCINCREMENTAL_COMPACTION_BUDGET_LENGTH)) {
+		uintptr_t budget = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCINCREMENTAL_COMPACTION_BUDGET_LENGTH, &budget)) {
+			result = false;
+		} else {
+			extensions->incrementalCompactionBudget = budget;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCINCREMENTAL_COMPACTION_GARBAGE_THRESHOLD, OMR_XGCINCREMENTAL_COMPACTION_GARBAGE_THRESHOLD_LENGTH)) {
+		uintptr_t garbageThreshold = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCINCREMENTAL_COMPACTION_GARBAGE_THRESHOLD_LENGTH, &garbageThreshold)) || (100 < garbageThreshold)) {
+			result = false;
+		} else {
+			extensions->incrementalCompactionGarbageThreshold = garbageThreshold;
+		}
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +356,117 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFER_SIZE, OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH, &(extensions->asyncLoggingBufferSize)) || (0 == extensions->asyncLoggingBufferSize)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCVERBOSE_BINARY_FORMAT, OMR_XGCVERBOSE_BINARY_FORMAT_LENGTH)) {
+		extensions->verboseBinaryFormat = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKSTEALING_MARKING, OMR_XGCWORKSTEALING_MARKING_LENGTH)) {
+		extensions->workStealingMarking = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNUMA_AWARE_PARALLEL, OMR_XGCNUMA_AWARE_PARALLEL_LENGTH)) {
+		extensions->numaAwareParallelGC = true;
+		/* node-local work lists need the affinity leaders of the machine, unless NUMA was explicitly configured */
+		if (!extensions->numaForced) {
+			extensions->_numaManager.shouldEnablePhysicalNUMA(true);
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCNUMA_SPLIT_FREE_LIST, OMR_XGCNUMA_SPLIT_FREE_LIST_LENGTH)) {
+		extensions->numaSplitFreeList = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCMARKING_PREFETCH_DEPTH, OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH)) {
+		uintptr_t prefetchDepth = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH, &prefetchDepth)) || (MARKING_PREFETCH_DEPTH_MAXIMUM < prefetchDepth)) {
+			result = false;
+		} else {
+			extensions->markingPrefetchDepth = prefetchDepth;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCLAZY_SWEEP, OMR_XGCLAZY_SWEEP_LENGTH)) {
+		extensions->lazySweep = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLH_REFRESH_TARGET, OMR_XGCTLH_REFRESH_TARGET_LENGTH)) {
+		uintptr_t refreshTarget = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCTLH_REFRESH_TARGET_LENGTH, &refreshTarget)) || (TLH_REFRESH_TARGET_MAXIMUM < refreshTarget)) {
+			result = false;
+		} else {
+			extensions->tlhRefreshTarget = refreshTarget;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCFREE_ENTRY_SIZE_CLASS_CACHE, OMR_XGCFREE_ENTRY_SIZE_CLASS_CACHE_LENGTH)) {
+		extensions->freeEntrySizeClassCache = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCPAUSE_TIME_GOAL, OMR_XGCPAUSE_TIME_GOAL_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCPAUSE_TIME_GOAL_LENGTH, &(extensions->pauseTimeGoal))) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCTHROUGHPUT_GOAL, OMR_XGCTHROUGHPUT_GOAL_LENGTH)) {
+		uintptr_t throughputGoal = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCTHROUGHPUT_GOAL_LENGTH, &throughputGoal)) || (0 == throughputGoal) || (100 <= throughputGoal)) {
+			result = false;
+		} else {
+			extensions->throughputGoal = throughputGoal;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCRELEASE_FREE_PAGES_AFTER_GC, OMR_XGCRELEASE_FREE_PAGES_AFTER_GC_LENGTH)) {
+		extensions->releaseFreePagesAfterGlobalGC = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCRELEASE_FREE_PAGES_GRANULE, OMR_XGCRELEASE_FREE_PAGES_GRANULE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCRELEASE_FREE_PAGES_GRANULE_LENGTH, &(extensions->releaseFreePagesGranule)) || (0 == extensions->releaseFreePagesGranule)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATION_SITE_SAMPLING_BYTES, OMR_XGCALLOCATION_SITE_SAMPLING_BYTES_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATION_SITE_SAMPLING_BYTES_LENGTH, &(extensions->allocationSiteSamplingBytesGranularity)) || (0 == extensions->allocationSiteSamplingBytesGranularity)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATION_SITE_SAMPLING_DEPTH, OMR_XGCALLOCATION_SITE_SAMPLING_DEPTH_LENGTH)) {
+		uintptr_t samplingDepth = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCALLOCATION_SITE_SAMPLING_DEPTH_LENGTH, &samplingDepth)) || (0 == samplingDepth) || (ALLOCATION_SITE_STATS_SIZE < samplingDepth)) {
+			result = false;
+		} else {
+			extensions->allocationSiteSamplingDepth = samplingDepth;
+		}
+	}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCSWEEP_INCREMENT_MICRO, OMR_XGCSWEEP_INCREMENT_MICRO_LENGTH)) {
+		/* 0 sweeps each batch the cost model sizes without a time budget */
+		if (0 >= getUDATAValue(option + OMR_XGCSWEEP_INCREMENT_MICRO_LENGTH, &(extensions->sweepIncrementMicro))) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_BACKGROUND_MAX, OMR_XGCCONCURRENT_BACKGROUND_MAX_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCCONCURRENT_BACKGROUND_MAX_LENGTH, &(extensions->concurrentBackgroundMax))) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_SCAN_CACHE_SIZING, OMR_XGCADAPTIVE_SCAN_CACHE_SIZING_LENGTH)) {
+		extensions->adaptiveScanCacheSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHOT_FIELD_CO_LOCATION, OMR_XGCHOT_FIELD_CO_LOCATION_LENGTH)) {
+		uintptr_t hotFieldCount = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHOT_FIELD_CO_LOCATION_LENGTH, &hotFieldCount)) || (HOT_FIELD_CO_LOCATION_MAXIMUM < hotFieldCount)) {
+			result = false;
+		} else {
+			extensions->scavengerHotFieldCoLocation = hotFieldCount;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCREMEMBERED_SET_OVERFLOW_CARDS, OMR_XGCREMEMBERED_SET_OVERFLOW_CARDS_LENGTH)) {
+		extensions->scavengerRememberedSetOverflowCards = true;
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
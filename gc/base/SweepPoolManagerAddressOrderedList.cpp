@@ -22,6 +22,8 @@
 
 #include "SweepPoolManagerAddressOrderedList.hpp"
 
+#include "MemoryPoolAddressOrderedList.hpp"
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -42,3 +44,11 @@ MM_SweepPoolManagerAddressOrderedList::newInstance(MM_EnvironmentBase *env)
 
 	return sweepPoolManager;
 }
+
+void
+MM_SweepPoolManagerAddressOrderedList::connectFinalChunk(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool)
+{
+	MM_SweepPoolManagerAddressOrderedListBase::connectFinalChunk(env, memoryPool);
+
+	((MM_MemoryPoolAddressOrderedList *)memoryPool)->fillSizeClassCache(env);
+}
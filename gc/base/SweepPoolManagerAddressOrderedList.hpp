@@ -48,6 +48,11 @@ public:
 
 	static MM_SweepPoolManagerAddressOrderedList *newInstance(MM_EnvironmentBase *env);
 
+	/**
+	 * Connect the final chunk, then let the pool move its mid sized free entries into its size class cache (if enabled).
+	 */
+	virtual void connectFinalChunk(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool);
+
 	/**
 	 * Create a SweepPoolManager object.
 	 */
@@ -206,6 +206,17 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 	uintptr_t sizeInBytesAllocated = (_stats.bytesAllocated(false) - _bytesAllocatedBase);
 	env->_oolTraceAllocationBytes += sizeInBytesAllocated;
 	env->_traceAllocationBytes += sizeInBytesAllocated;
+
+	if (UDATA_MAX != extensions->allocationSiteSamplingBytesGranularity) {
+		/* Allocations inside a TLH only reach here when the TLH is refreshed, so sampling happens at TLH boundaries and
+		 * each sample stands for all the bytes allocated since the previous one.
+		 */
+		env->_allocationSiteSampleBytes += sizeInBytesAllocated;
+		if ((NULL != result) && (env->_allocationSiteSampleBytes >= extensions->allocationSiteSamplingBytesGranularity)) {
+			env->_allocationSiteSamples.add(env->getAllocationSite(), env->_allocationSiteSampleBytes);
+			env->_allocationSiteSampleBytes = 0;
+		}
+	}
 	return result;
 }
 
@@ -288,15 +299,17 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	}	
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */		
 	
-	extensions->allocationStats.merge(&_stats);
-	_stats.clear();
-	/* Since AllocationStats have been reset, reset the base as well*/
-	_bytesAllocatedBase = 0;
+	/* Flush the TLHs first so that the bytes they waste are part of the merged stats */
 	_tlhAllocationSupport.flushCache(env);
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	extensions->allocationStats.merge(&_stats);
+	_stats.clear();
+	/* Since AllocationStats have been reset, reset the base as well*/
+	_bytesAllocatedBase = 0;
 }
 
 void
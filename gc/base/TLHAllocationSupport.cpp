@@ -94,6 +94,9 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 
 	/* Clear current information accumulated */
 	setAllZeroes();
+	_bytesAllocatedSinceRestart = 0;
+	_refreshCountSinceRestart = 0;
+	_averageBytesAllocatedBetweenGCs = 0;
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
 }
@@ -110,7 +113,20 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	uintptr_t refreshTarget = extensions->tlhRefreshTarget;
+	if (0 != refreshTarget) {
+		/* The last interval weighs half, so the TLH of a thread that went idle decays within a few
+		 * collections while a thread that turned hungry reaches its new size just as quickly.
+		 */
+		_averageBytesAllocatedBetweenGCs = (_averageBytesAllocatedBetweenGCs / 2) + (_bytesAllocatedSinceRestart / 2);
+		refreshSize = OMR_MIN(_averageBytesAllocatedBetweenGCs / refreshTarget, extensions->tlhMaximumSize);
+		_tlh->refreshSize = OMR_MAX(MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize), extensions->tlhInitialSize);
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+
+	_bytesAllocatedSinceRestart = 0;
+	_refreshCountSinceRestart = 0;
 }
 
 bool
@@ -146,6 +162,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	stats->_tlhDiscardedBytes += getRemainingSize();
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
+	_bytesAllocatedSinceRestart += usedSize;
 
 	/* Try to cache the current TLH */
 	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize)) {
@@ -231,6 +248,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			if (0 < getSize()) {
 				stats->_tlhRefreshCountFresh += 1;
 				stats->_tlhAllocatedFresh += getSize();
+				_refreshCountSinceRestart += 1;
 			}
 		}
 	}
@@ -255,10 +273,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
-			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
-				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
-			}
+			increaseRefreshSize(env);
 			reserveTLHTopForGC(env);
 		}
 	}
@@ -315,6 +330,25 @@ MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescrip
 	return NULL;
 }
 
+void
+MM_TLHAllocationSupport::increaseRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t refreshSize = getRefreshSize();
+	uintptr_t tlhMaximumSize = extensions->tlhMaximumSize;
+
+	/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
+	if (refreshSize < tlhMaximumSize) {
+		uintptr_t refreshTarget = extensions->tlhRefreshTarget;
+		if ((0 != refreshTarget) && (_refreshCountSinceRestart > refreshTarget)) {
+			/* The thread is allocating faster than its history predicted; grow geometrically */
+			setRefreshSize(OMR_MIN(refreshSize * 2, tlhMaximumSize));
+		} else {
+			setRefreshSize(refreshSize + extensions->tlhIncrementSize);
+		}
+	}
+}
+
 void
 MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 {
@@ -324,6 +358,20 @@ MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 		env->getExtensions()->getGlobalCollector()->preAllocCacheFlush(env, getBase(), lastTLHobj);
 	}
 
+	_bytesAllocatedSinceRestart += getUsedSize();
+
+	/* The remainder of the current TLH and every cached abandoned TLH are dropped here and
+	 * are only recovered by the collector.
+	 */
+	bool const compressed = env->compressObjectReferences();
+	uintptr_t wastedBytes = getRemainingSize();
+	MM_HeapLinkedFreeHeaderTLH *abandoned = _abandonedList;
+	while (NULL != abandoned) {
+		wastedBytes += abandoned->getSize();
+		abandoned = (MM_HeapLinkedFreeHeaderTLH *)abandoned->getNext(compressed);
+	}
+	_objectAllocationInterface->getAllocationStats()->_tlhWastedBytes += wastedBytes;
+
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
@@ -84,6 +84,10 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+
+	uintptr_t _bytesAllocatedSinceRestart; /**< Bytes consumed from retired TLHs since the cache was last restarted at the end of a collection. */
+	uintptr_t _refreshCountSinceRestart; /**< Number of fresh TLH refreshes since the cache was last restarted at the end of a collection. */
+	uintptr_t _averageBytesAllocatedBetweenGCs; /**< Weighted history of _bytesAllocatedSinceRestart, used to size the first TLH after a collection (see -Xgc:tlhRefreshTarget=). */
 public:
 protected:
 private:
@@ -177,12 +181,21 @@ private:
 	 * Restart the cache from its current start to an appropriate base state.
 	 * Reset the cache details back to a starting state that is appropriate for where it currently is.
 	 * In this case, the state reset takes into account the ending refresh size and sets an appropriate
-	 * new starting point.
+	 * new starting point.  With adaptive sizing the starting point is instead derived from the thread's
+	 * allocation history, spread over tlhRefreshTarget refreshes.
 	 *
 	 * @note The previous cache contents are expected to have been flushed back to the heap.
 	 */
 	void restart(MM_EnvironmentBase *env);
 
+	/**
+	 * Grow the refresh size after a successful fresh refresh.
+	 * With the fixed increment scheme the refresh size grows by tlhIncrementSize.  When adaptive sizing is enabled
+	 * and the thread has already refreshed more often than tlhRefreshTarget since the last collection, the refresh
+	 * size doubles instead so that a bursty thread stops going back to the memory pool.
+	 */
+	void increaseRefreshSize(MM_EnvironmentBase *env);
+
 	/**
 	 * Reserve part (top) of TLH for GC if collector requires
 	 */
@@ -251,7 +264,10 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_bytesAllocatedSinceRestart(0),
+		_refreshCountSinceRestart(0),
+		_averageBytesAllocatedBetweenGCs(0)
 	{};
 
 	/*
@@ -87,6 +87,8 @@ getCompactionReasonAsString(CompactReason reason)
 			return "page granularity fragmentation";	
 		case COMPACT_MICRO_FRAG:
 			return "micro fragmentation";	
+		case COMPACT_INCREMENTAL:
+			return "continue incremental compaction";
 		default:
 			return "unknown";
 	}
@@ -196,6 +198,8 @@ getContractReasonAsString(ContractReason reason)
 		return "forced nursery contract";
 	case SOFT_MX_CONTRACT:
 		return "satisfy softmx";
+	case PAUSE_TIME_GOAL_CONTRACT:
+		return "pause time goal not satisfied, or excess free space for the throughput goal";
 	default:
 		return "unknown";
 	}
@@ -227,6 +231,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case THROUGHPUT_GOAL_EXPAND:
+		return "throughput goal not satisfied";
 	default:
 		return "unknown";
 	}
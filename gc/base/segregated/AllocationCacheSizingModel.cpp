@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "AllocationCacheSizingModel.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "ModronAssertions.h"
+
+void
+MM_AllocationCacheSizingModel::initialize(uintptr_t initialSize, uintptr_t incrementSize, uintptr_t maximumSize, uintptr_t hotMaximumSize, uintptr_t hotAllocationRate, uintptr_t hotFootprint)
+{
+	_initialSize = initialSize;
+	_incrementSize = incrementSize;
+	_maximumSize = OMR_MAX(initialSize, maximumSize);
+	_hotMaximumSize = OMR_MAX(_maximumSize, hotMaximumSize);
+	_hotAllocationRate = hotAllocationRate;
+	_hotFootprint = hotFootprint;
+}
+
+bool
+MM_AllocationCacheSizingModel::isHot(uint64_t bytesSinceRestart, uint64_t replenishesSinceRestart, uint64_t elapsedMicros)
+{
+	/* a single replenish says nothing about the rate the cache is drained at */
+	return (2 <= replenishesSinceRestart) && ((bytesSinceRestart * 1000) >= ((uint64_t)_hotAllocationRate * elapsedMicros));
+}
+
+uintptr_t
+MM_AllocationCacheSizingModel::grow(uintptr_t replenishSize, uint64_t bytesSinceRestart, uint64_t replenishesSinceRestart, uint64_t elapsedMicros, uintptr_t hotBytes)
+{
+	uintptr_t newSize = replenishSize;
+
+	/* Only grow once the thread has drained at least a full replenish size since the last restart */
+	if (bytesSinceRestart >= replenishSize) {
+		if (isHot(bytesSinceRestart, replenishesSinceRestart, elapsedMicros)) {
+			uintptr_t hotSize = OMR_MIN(replenishSize * 2, _hotMaximumSize);
+			uintptr_t hotGrowth = getHotBytes(hotSize) - getHotBytes(replenishSize);
+			if ((hotBytes + hotGrowth) <= _hotFootprint) {
+				newSize = hotSize;
+			}
+		}
+		if ((newSize == replenishSize) && (replenishSize < _maximumSize)) {
+			newSize = OMR_MIN(replenishSize + _incrementSize, _maximumSize);
+		}
+	}
+
+	Assert_MM_true(newSize <= _hotMaximumSize);
+	return newSize;
+}
+
+uintptr_t
+MM_AllocationCacheSizingModel::backOff(uintptr_t replenishSize, uint64_t bytesSinceRestart, uint64_t replenishesSinceRestart, uint64_t elapsedMicros)
+{
+	uintptr_t newSize = replenishSize;
+
+	/* Backout policy:
+	 * - if no allocations happened since the last restart, reset the replenish size to the initial size
+	 * - if only 1 replenish occurred since the last restart (meaning we didn't use up the entire cache), halve the replenish size
+	 * - if less cells were pre-allocated than the preceding replenish size (will happen if we need multiple refreshes to reach the
+	 *   current replenish size because the AC has fairly full regions), halve the replenish size
+	 * - if a size class grown past the maximum size is no longer hot, halve the replenish size
+	 */
+	if (_initialSize != replenishSize) {
+		if (0 == replenishesSinceRestart) {
+			newSize = _initialSize;
+		} else if (1 == replenishesSinceRestart) {
+			newSize = replenishSize / 2;
+		} else if (bytesSinceRestart < (replenishSize - OMR_MIN(replenishSize, _incrementSize))) {
+			newSize = replenishSize / 2;
+		} else if ((replenishSize > _maximumSize) && !isHot(bytesSinceRestart, replenishesSinceRestart, elapsedMicros)) {
+			newSize = replenishSize / 2;
+		}
+	}
+
+	return newSize;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
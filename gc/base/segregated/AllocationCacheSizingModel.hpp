@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(ALLOCATIONCACHESIZINGMODEL_HPP_)
+#define ALLOCATIONCACHESIZINGMODEL_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "Base.hpp"
+
+/**
+ * Replenish size policy for the per size class allocation caches of a thread (segregated heap).
+ *
+ * A size class grows by allocationCacheIncrementSize up to allocationCacheMaximumSize each time its cache
+ * is drained. A size class the thread allocates from faster than allocationCacheHotAllocationRate is hot:
+ * it doubles its replenish size instead, up to allocationCacheHotMaximumSize (a whole region), as long as
+ * the hot caches of the thread stay within allocationCacheHotFootprint. Caches are backed off at every
+ * restart (once per GC) when the class was used less, or stopped being hot.
+ */
+class MM_AllocationCacheSizingModel : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _initialSize; /**< -Xgc:allocationCacheInitialSize, replenish size of an unused size class */
+	uintptr_t _incrementSize; /**< -Xgc:allocationCacheIncrementSize, growth of a size class which is not hot */
+	uintptr_t _maximumSize; /**< -Xgc:allocationCacheMaximumSize, largest replenish size of a size class which is not hot */
+	uintptr_t _hotMaximumSize; /**< largest replenish size of a hot size class */
+	uintptr_t _hotAllocationRate; /**< bytes per millisecond a size class is pre-allocated at to be hot */
+	uintptr_t _hotFootprint; /**< largest sum of the replenish sizes of the hot size classes of one thread */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	void initialize(uintptr_t initialSize, uintptr_t incrementSize, uintptr_t maximumSize, uintptr_t hotMaximumSize, uintptr_t hotAllocationRate, uintptr_t hotFootprint);
+
+	/**
+	 * @param bytesSinceRestart bytes pre-allocated for the size class since the last restart
+	 * @param replenishesSinceRestart replenishes of the size class since the last restart
+	 * @param elapsedMicros time since the last restart
+	 * @return true if the size class is pre-allocated at least at the hot allocation rate
+	 */
+	bool isHot(uint64_t bytesSinceRestart, uint64_t replenishesSinceRestart, uint64_t elapsedMicros);
+
+	/**
+	 * @return the part of the hot footprint taken by a size class of the given replenish size
+	 */
+	MMINLINE uintptr_t getHotBytes(uintptr_t replenishSize) { return (replenishSize > _maximumSize) ? replenishSize : 0; }
+
+	/**
+	 * Calculate the replenish size after a replenish of the size class.
+	 * @param replenishSize current replenish size of the size class
+	 * @param hotBytes sum of getHotBytes() over all size classes of the thread
+	 * @return the new replenish size
+	 */
+	uintptr_t grow(uintptr_t replenishSize, uint64_t bytesSinceRestart, uint64_t replenishesSinceRestart, uint64_t elapsedMicros, uintptr_t hotBytes);
+
+	/**
+	 * Calculate the replenish size for the next period when the caches are restarted.
+	 * @param replenishSize current replenish size of the size class
+	 * @return the new replenish size
+	 */
+	uintptr_t backOff(uintptr_t replenishSize, uint64_t bytesSinceRestart, uint64_t replenishesSinceRestart, uint64_t elapsedMicros);
+
+	MMINLINE uintptr_t getInitialSize() { return _initialSize; }
+
+	MM_AllocationCacheSizingModel() :
+		MM_Base(),
+		_initialSize(0),
+		_incrementSize(0),
+		_maximumSize(0),
+		_hotMaximumSize(0),
+		_hotAllocationRate(0),
+		_hotFootprint(0)
+	{
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* ALLOCATIONCACHESIZINGMODEL_HPP_ */
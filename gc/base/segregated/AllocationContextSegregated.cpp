@@ -269,6 +269,12 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 	uintptr_t replenishSize = segregatedAllocationInterface->getReplenishSize(env, sizeInBytesRequired);
 	uintptr_t preAllocatedBytes = 0;
 
+	/* A size class hot enough to replenish a whole region at a time takes a fresh region to itself */
+	if (replenishSize >= (sizeClasses->getNumCells(sizeClass) * sizeClasses->getCellSize(sizeClass))) {
+		result = preAllocateSmallFromFreshRegion(env, sizeInBytesRequired, sizeClass);
+		done = (NULL != result);
+	}
+
 	while (!done) {
 
 		/* If we have a region, attempt to replenish the ACL's cache */
@@ -318,6 +324,43 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 
 }
 
+/*
+ * Pre allocate all the cells of a fresh region into the env's allocation cache. The region is never
+ * installed as the context's region for the size class, so its cells are not shared with other threads.
+ * @return the carved off first cell in the list, or NULL if there is no free region
+ */
+uintptr_t *
+MM_AllocationContextSegregated::preAllocateSmallFromFreshRegion(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, uintptr_t sizeClass)
+{
+	MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+	uintptr_t cellSize = sizeClasses->getCellSize(sizeClass);
+	uintptr_t *result = NULL;
+
+	smallAllocationLock();
+	MM_HeapRegionDescriptorSegregated *region = _regionPool->allocateFromRegionPool(env, 1, sizeClass, MAX_UINT);
+	if (NULL != region) {
+		/* cache the small full region in AC, it is full as soon as its cells are handed out */
+		_perContextSmallFullRegions[sizeClass]->enqueue(region);
+		region->formatFresh(env, sizeClass, region->getLowAddress());
+	}
+	smallAllocationUnlock();
+
+	if (NULL != region) {
+		MM_SegregatedAllocationInterface* segregatedAllocationInterface = (MM_SegregatedAllocationInterface*)env->_objectAllocationInterface;
+		uintptr_t preAllocatedBytes = 0;
+		uintptr_t* cellList = region->getMemoryPoolACL()->preAllocateCells(env, cellSize, sizeClasses->getNumCells(sizeClass) * cellSize, &preAllocatedBytes);
+		Assert_MM_true(NULL != cellList);
+		Assert_MM_true(preAllocatedBytes > 0);
+		if (shouldPreMarkSmallCells(env)) {
+			_markingScheme->preMarkSmallCells(env, region, cellList, preAllocatedBytes);
+		}
+		flushHelper(env, region, cellSize);
+		segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, preAllocatedBytes);
+		result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
+	}
+	return result;
+}
+
 uintptr_t *
 MM_AllocationContextSegregated::allocateArraylet(MM_EnvironmentBase *env, omrarrayptr_t parent)
 {
@@ -206,6 +206,8 @@ protected:
 
 	bool tryAllocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t sizeClass);
 
+	uintptr_t *preAllocateSmallFromFreshRegion(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, uintptr_t sizeClass);
+
 private:
 
 };
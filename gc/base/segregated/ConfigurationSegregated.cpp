@@ -93,6 +93,15 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 			success = true;
 		}
 	}
+
+	if (!extensions->heapExpansionGCRatioThreshold._wasSpecified) {
+		extensions->heapExpansionGCRatioThreshold._valueSpecified = 13;
+	}
+
+	if (!extensions->heapContractionGCRatioThreshold._wasSpecified) {
+		extensions->heapContractionGCRatioThreshold._valueSpecified = 5;
+	}
+
 	return success;
 }
 
@@ -188,17 +188,48 @@ private:
 		_totalRegionsCount += region->getRange();
 	}
 
+	/**
+	 * Move up to count regions from the front of the receiver to the back of target as a single chain,
+	 * so the receiver's lock is held for one walk of the chain rather than count unlink/link pairs.
+	 */
 	uintptr_t dequeueInternal(MM_LockingHeapRegionQueue *target, uintptr_t count)
 	{
-		uintptr_t moved = 0;
-		while (count-- > 0) {
-			MM_HeapRegionDescriptorSegregated *p = dequeueInternal();
-			if (p == NULL) {
-				break;
-			}
+		MM_HeapRegionDescriptorSegregated *front = _head;
+		if ((NULL == front) || (0 == count)) {
+			return 0;
+		}
+
+		MM_HeapRegionDescriptorSegregated *back = front;
+		uintptr_t moved = 1;
+		uintptr_t movedRegionsCount = front->getRange();
+		while ((moved < count) && (NULL != back->getNext())) {
+			back = back->getNext();
 			moved++;
-			target->enqueueInternal(p);
+			movedRegionsCount += back->getRange();
 		}
+
+		/* Detach the chain from the receiver */
+		_head = back->getNext();
+		if (NULL == _head) {
+			_tail = NULL;
+		} else {
+			_head->setPrev(NULL);
+			back->setNext(NULL);
+		}
+		_length -= moved;
+		_totalRegionsCount -= movedRegionsCount;
+
+		/* Append the chain to target */
+		front->setPrev(target->_tail); /* OK even if _tail is NULL */
+		if (NULL == target->_tail) {
+			target->_head = front;
+		} else {
+			target->_tail->setNext(front);
+		}
+		target->_tail = back;
+		target->_length += moved;
+		target->_totalRegionsCount += movedRegionsCount;
+
 		return moved;
 	}
 
@@ -210,6 +210,11 @@ public:
 		return _currentCountOfSweepRegions[sizeClass];
 	}
 	
+	MMINLINE void incrementCurrentCountOfSweepRegions(uintptr_t sizeClass, uintptr_t count)
+	{
+		MM_AtomicOperations::add(&_currentCountOfSweepRegions[sizeClass], count);
+	}
+
 	MMINLINE void decrementCurrentCountOfSweepRegions(uintptr_t sizeClass, uintptr_t count)
 	{
 		MM_AtomicOperations::subtract(&_currentCountOfSweepRegions[sizeClass], count);
@@ -220,6 +225,11 @@ public:
 		return _currentTotalCountOfSweepRegions;
 	}
 	
+	MMINLINE void incrementCurrentTotalCountOfSweepRegions (uintptr_t count)
+	{
+		MM_AtomicOperations::add(&_currentTotalCountOfSweepRegions, count);
+	}
+
 	MMINLINE void decrementCurrentTotalCountOfSweepRegions (uintptr_t count)
 	{
 		MM_AtomicOperations::subtract(&_currentTotalCountOfSweepRegions, count);
@@ -95,9 +95,14 @@ MM_SegregatedAllocationInterface::initialize(MM_EnvironmentBase *env)
 
 		memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
 		memset(&_allocationCacheStats, 0, sizeof(_allocationCacheStats));
+		_cacheSizingModel.initialize(extensions->allocationCacheInitialSize, extensions->allocationCacheIncrementSize, extensions->allocationCacheMaximumSize,
+				extensions->allocationCacheHotMaximumSize, extensions->allocationCacheHotAllocationRate, extensions->allocationCacheHotFootprint);
 		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 			_replenishSizes[sizeClass] = extensions->allocationCacheInitialSize;
 		}
+		_hotBytes = 0;
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		_restartTime = omrtime_hires_clock();
 	}
 	
 	return result;
@@ -252,11 +257,13 @@ void
 MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 {
 	bool const compressed = env->compressObjectReferences();
-	/* make the current caches walkable */
+	/* make the current caches walkable, the unused cells are reclaimed by the next sweep */
 	for (uintptr_t sizeClass = 0; sizeClass < OMR_SIZECLASSES_NUM_SMALL+1; sizeClass++) {
 		if (_allocationCache[sizeClass].current < _allocationCache[sizeClass].top) {
 			MM_HeapLinkedFreeHeader *chunk = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(_allocationCache[sizeClass].current);
-			chunk->setSize((uintptr_t)_allocationCache[sizeClass].top - (uintptr_t)_allocationCache[sizeClass].current);
+			uintptr_t unusedBytes = (uintptr_t)_allocationCache[sizeClass].top - (uintptr_t)_allocationCache[sizeClass].current;
+			chunk->setSize(unusedBytes);
+			_stats._discardedBytes += unusedBytes;
 			/* next pointer value is irrelevant, it just needs to be low bit tagged, to make it non-object */
 			chunk->setNext(NULL, compressed);
 		}
@@ -273,25 +280,17 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 void
 MM_SegregatedAllocationInterface::restartCache(MM_EnvironmentBase *env)
 {
-	MM_GCExtensionsBase* extensions = env->getExtensions();
-	/* Backout policy:
-	 * - if no allocations happened since the last restart, reset the replenish size to the minimum size
-	 * - if only 1 replenish occurred since the last restart (meaning we didn't use up the entire cache), halve the replenish size
-	 * - if less cells were pre-allocated than the preceding replenish size (will happen if we need multiple refreshes to reach the
-	 *   current replenish size because the AC has fairly full regions), halve the replenish size
-	 */
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t now = omrtime_hires_clock();
+	uint64_t elapsedMicros = omrtime_hires_delta(_restartTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	_hotBytes = 0;
 	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
-		/* Only enforce a backout policy if the desired sizes index was actually moved forward. */
-		if (extensions->allocationCacheInitialSize != _replenishSizes[sizeClass]) {
-			if (0 == _allocationCacheStats.replenishesSinceRestart[sizeClass]) {
-				_replenishSizes[sizeClass] = extensions->allocationCacheInitialSize;
-			} else if (1 == _allocationCacheStats.replenishesSinceRestart[sizeClass]) {
-				_replenishSizes[sizeClass] /= 2;
-			} else if (_allocationCacheStats.bytesPreAllocatedSinceRestart[sizeClass] < (_replenishSizes[sizeClass] - extensions->allocationCacheIncrementSize)) {
-				_replenishSizes[sizeClass] /= 2;
-			}
-		}
+		_replenishSizes[sizeClass] = _cacheSizingModel.backOff(_replenishSizes[sizeClass], _allocationCacheStats.bytesPreAllocatedSinceRestart[sizeClass],
+				_allocationCacheStats.replenishesSinceRestart[sizeClass], elapsedMicros);
+		_hotBytes += _cacheSizingModel.getHotBytes(_replenishSizes[sizeClass]);
 	}
+	_restartTime = now;
 	
 	memset(&(_allocationCacheStats.bytesPreAllocatedSinceRestart), 0, sizeof(_allocationCacheStats.bytesPreAllocatedSinceRestart));
 	memset(&(_allocationCacheStats.replenishesSinceRestart), 0, sizeof(_allocationCacheStats.replenishesSinceRestart));
@@ -331,12 +330,12 @@ MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintpt
 		_allocationCacheStats.replenishesSinceRestart[sizeClass] += 1;
 		
 		/* Based on the new allocation stats, determine if we should bump up the desired amount of pre-allocated cells. */
-		if ((_allocationCacheStats.bytesPreAllocatedSinceRestart[sizeClass] >= _replenishSizes[sizeClass])
-			&& (_replenishSizes[sizeClass] < extensions->allocationCacheMaximumSize)
-		) {
-			
-			_replenishSizes[sizeClass] += extensions->allocationCacheIncrementSize;
-		}
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uint64_t elapsedMicros = omrtime_hires_delta(_restartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uintptr_t replenishSize = _cacheSizingModel.grow(_replenishSizes[sizeClass], _allocationCacheStats.bytesPreAllocatedSinceRestart[sizeClass],
+				_allocationCacheStats.replenishesSinceRestart[sizeClass], elapsedMicros, _hotBytes);
+		_hotBytes += _cacheSizingModel.getHotBytes(replenishSize) - _cacheSizingModel.getHotBytes(_replenishSizes[sizeClass]);
+		_replenishSizes[sizeClass] = replenishSize;
 	}
 }
 
@@ -26,6 +26,7 @@
 #include "omrcfg.h"
 #include "sizeclasses.h"
 
+#include "AllocationCacheSizingModel.hpp"
 #include "LanguageSegregatedAllocationCache.hpp"
 
 #include "ObjectAllocationInterface.hpp"
@@ -53,6 +54,9 @@ private:
 	LanguageSegregatedAllocationCacheEntryStruct *_allocationCache; /**< The current cache (per size class). */
 	uintptr_t _replenishSizes[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The next replenish size (per size class). */
 	SegregatedAllocationCacheStats _allocationCacheStats; /**< Contains stats about the past pre-allocations. */
+	MM_AllocationCacheSizingModel _cacheSizingModel; /**< Decides the replenish sizes from the pre-allocation stats. */
+	uint64_t _restartTime; /**< Time the cache was last restarted, the start of the period the pre-allocation rates are measured over. */
+	uintptr_t _hotBytes; /**< Sum of the replenish sizes of the hot size classes (see MM_AllocationCacheSizingModel::getHotBytes()). */
 	MM_SizeClasses* _sizeClasses; /**< The size classes used to map byte sizes to size class indexes. */
 	
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
@@ -101,6 +105,9 @@ protected:
 	
 	MM_SegregatedAllocationInterface(MM_EnvironmentBase *env) :
 		MM_ObjectAllocationInterface(env),
+		_cacheSizingModel(),
+		_restartTime(0),
+		_hotBytes(0),
 		_sizeClasses(NULL),
 		_cachedAllocationsEnabled(true)
 	{
@@ -220,6 +220,7 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	 * Sweeping
 	 */
 	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	sweepStats->clear();
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
 	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
@@ -33,16 +33,22 @@ MM_SegregatedSweepTask::run(MM_EnvironmentBase *env)
 	_sweepScheme->sweep(env, _memoryPool, false);
 }
 
+/**
+ * Initialize sweep statistics per work thread at the beginning of the sweep task.
+ */
 void
 MM_SegregatedSweepTask::setup(MM_EnvironmentBase *env)
 {
-
+	env->_sweepStats.clear();
 }
 
+/**
+ * Gather sweep statistics into the global statistics counter at the end of the sweep task.
+ */
 void
-MM_SegregatedSweepTask::cleanup(MM_EnvironmentBase *envBase)
+MM_SegregatedSweepTask::cleanup(MM_EnvironmentBase *env)
 {
-
+	env->getExtensions()->globalGCStats.sweepStats.merge(&env->_sweepStats);
 }
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "SweepIncrementBudgetModel.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "ModronAssertions.h"
+
+/* Weight of the newest sample in the running cost per region */
+#define SWEEP_INCREMENT_COST_WEIGHT ((float)0.5)
+
+void
+MM_SweepIncrementBudgetModel::initialize(uint64_t budgetMicros)
+{
+	_budgetMicros = budgetMicros;
+	_regionsInIncrement = 0;
+	_microsPerRegion = 0.0f;
+	_overBudgetIncrements = 0;
+}
+
+bool
+MM_SweepIncrementBudgetModel::regionSwept(uint64_t elapsedMicros)
+{
+	_regionsInIncrement += 1;
+
+	float sample = (float)elapsedMicros / (float)_regionsInIncrement;
+	if (0.0f < _microsPerRegion) {
+		_microsPerRegion = (SWEEP_INCREMENT_COST_WEIGHT * sample) + ((1.0f - SWEEP_INCREMENT_COST_WEIGHT) * _microsPerRegion);
+	} else {
+		_microsPerRegion = sample;
+	}
+
+	bool exceeded = (0 != _budgetMicros) && (elapsedMicros >= _budgetMicros);
+	if (exceeded) {
+		_overBudgetIncrements += 1;
+	}
+	return exceeded;
+}
+
+uintptr_t
+MM_SweepIncrementBudgetModel::getRegionsPerIncrement(uintptr_t maximumRegions)
+{
+	uintptr_t regions = OMR_MAX(1, maximumRegions);
+
+	if ((0 != _budgetMicros) && (0.0f < _microsPerRegion)) {
+		float fit = (float)_budgetMicros / _microsPerRegion;
+		if (fit < (float)regions) {
+			regions = OMR_MAX(1, (uintptr_t)fit);
+		}
+	}
+
+	Assert_MM_true((1 <= regions) && (regions <= OMR_MAX(1, maximumRegions)));
+	return regions;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SWEEPINCREMENTBUDGETMODEL_HPP_)
+#define SWEEPINCREMENTBUDGETMODEL_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "Base.hpp"
+
+/**
+ * Bounds the time of one increment of the segregated small region sweep (-Xgc:sweepIncrementMicro).
+ *
+ * A GC thread sweeps a batch of regions per increment. Each thread keeps one model across increments and
+ * cycles: it holds a running cost per region measured on the thread, sizes the next batch so it fits the
+ * budget, and reports when the increment in progress has used up its budget so the thread can end it and
+ * return the rest of the batch to the sweep queue.
+ */
+class MM_SweepIncrementBudgetModel : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	uint64_t _budgetMicros; /**< time budget of an increment, 0 for no budget */
+	uintptr_t _regionsInIncrement; /**< regions swept since the increment started */
+	float _microsPerRegion; /**< running cost of sweeping one region, 0.0 until the first region is swept */
+	uintptr_t _overBudgetIncrements; /**< increments that used up their budget before their batch was done */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * @param budgetMicros time budget of an increment, 0 for no budget
+	 */
+	void initialize(uint64_t budgetMicros);
+
+	/**
+	 * Start timing a new increment.
+	 */
+	MMINLINE void startIncrement() { _regionsInIncrement = 0; }
+
+	/**
+	 * Record a region swept by the increment in progress.
+	 * @param elapsedMicros time since the increment started
+	 * @return true if the increment used up its budget, false otherwise
+	 */
+	bool regionSwept(uint64_t elapsedMicros);
+
+	/**
+	 * Size the batch of the next increment.
+	 * @param maximumRegions batch size chosen by the sweep cost model
+	 * @return the number of regions expected to fit the budget, in [1, maximumRegions]
+	 */
+	uintptr_t getRegionsPerIncrement(uintptr_t maximumRegions);
+
+	MMINLINE uintptr_t getOverBudgetIncrements() { return _overBudgetIncrements; }
+
+	MM_SweepIncrementBudgetModel() :
+		MM_Base(),
+		_budgetMicros(0),
+		_regionsInIncrement(0),
+		_microsPerRegion(0.0f),
+		_overBudgetIncrements(0)
+	{
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SWEEPINCREMENTBUDGETMODEL_HPP_ */
@@ -34,6 +34,7 @@
 #include "MemoryPoolAggregatedCellList.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "RegionPoolSegregated.hpp"
+#include "SweepIncrementBudgetModel.hpp"
 #include "Task.hpp"
 
 #include "SweepSchemeSegregated.hpp"
@@ -495,6 +496,21 @@ MM_SweepSchemeSegregated::updateSweepSmallRegionCount()
 	return false;
 }
 
+void
+MM_SweepSchemeSegregated::returnUnsweptRegions(MM_EnvironmentBase *env, uintptr_t sizeClass)
+{
+	MM_HeapRegionQueue *workList = env->getRegionWorkList();
+	uintptr_t unsweptRegions = workList->getTotalRegions();
+	if (0 != unsweptRegions) {
+		MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+		/* Count the regions back before queueing them so that the counts never drop below the regions left to dequeue */
+		regionPool->incrementCurrentCountOfSweepRegions(sizeClass, unsweptRegions);
+		regionPool->incrementCurrentTotalCountOfSweepRegions(unsweptRegions);
+		regionPool->getSmallSweepRegions(sizeClass)->enqueue(workList);
+		env->_sweepStats._sweepRegionsReturned += unsweptRegions;
+	}
+}
+
 void
 MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 {
@@ -502,6 +518,8 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 	bool shouldUpdateOccupancy = ext->nonDeterministicSweep;
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
 	uintptr_t splitIndex = env->getWorkerID() % (regionPool->getSplitAvailableListSplitCount());
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_SweepIncrementBudgetModel *budget = &env->_sweepIncrementBudget;
 
 	/* 
 	 * Iterate through the regions so that each region is processed exactly once.
@@ -513,8 +531,17 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 	 * if a region contains no marked objects, then it can be returned to a free list.
 	 */
 	MM_SizeClasses *sizeClasses = ext->defaultSizeClasses;
+	/*
+	 * Each GC thread starts at a different size class and walks the others in turn, so threads
+	 * contend on different sweep queue locks until they meet and help each other with the
+	 * remaining size classes.
+	 */
+	uintptr_t const sizeClassCount = OMR_SIZECLASSES_MAX_SMALL - OMR_SIZECLASSES_MIN_SMALL + 1;
+	uintptr_t const firstSizeClassOffset = env->getWorkerID() % sizeClassCount;
+	uintptr_t const threadCount = env->_currentTask->getThreadCount();
 	while (regionPool->getCurrentTotalCountOfSweepRegions()) {
-		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		for (uintptr_t sizeClassOffset = 0; sizeClassOffset < sizeClassCount; sizeClassOffset++) {
+			uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL + ((firstSizeClassOffset + sizeClassOffset) % sizeClassCount);
 			while (regionPool->getCurrentCountOfSweepRegions(sizeClass)) {
 				float yetToComplete = (float)regionPool->getCurrentCountOfSweepRegions(sizeClass) / regionPool->getInitialCountOfSweepRegions(sizeClass);
 				float totalYetToComplete = (float)regionPool->getCurrentTotalCountOfSweepRegions() / regionPool->getInitialTotalCountOfSweepRegions();
@@ -526,10 +553,17 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 				MM_HeapRegionQueue *sweepList = regionPool->getSmallSweepRegions(sizeClass);
 				MM_HeapRegionDescriptorSegregated *currentRegion;
 				uintptr_t numCells = sizeClasses->getNumCells(sizeClass);
-				uintptr_t sweepSmallRegionsPerIteration = calcSweepSmallRegionsPerIteration(numCells);
+				/* Size the batch from the cost model, cut to what this thread swept within the increment time budget so far */
+				uintptr_t sweepSmallRegionsPerIteration = budget->getRegionsPerIncrement(calcSweepSmallRegionsPerIteration(numCells));
+				/* Take no more than a fair share of what is left so that the last regions of a size class are spread across all threads */
+				uintptr_t fairShare = (regionPool->getCurrentCountOfSweepRegions(sizeClass) + threadCount - 1) / threadCount;
+				sweepSmallRegionsPerIteration = OMR_MAX(1, OMR_MIN(sweepSmallRegionsPerIteration, fairShare));
 				uintptr_t yieldSlackTime = resetSweepSmallRegionCount(env, sweepSmallRegionsPerIteration);
 				uintptr_t actualSweepRegions;
+				budget->startIncrement();
+				uint64_t incrementStartTime = omrtime_hires_clock();
 				if ((actualSweepRegions = sweepList->dequeue(env->getRegionWorkList(), sweepSmallRegionsPerIteration)) > 0) {
+					env->_sweepStats._sweepIncrements += 1;
 					regionPool->decrementCurrentCountOfSweepRegions(sizeClass, actualSweepRegions);
 					regionPool->decrementCurrentTotalCountOfSweepRegions(actualSweepRegions);
 					uintptr_t freedRegions = 0, processedRegions = 0;
@@ -556,8 +590,17 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 						}
 						processedRegions++;
 						
-						if (updateSweepSmallRegionCount()) {
+						bool overBudget = budget->regionSwept(omrtime_hires_delta(incrementStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+						if (updateSweepSmallRegionCount() || overBudget) {
 							yieldFromSweep(env, yieldSlackTime);
+							if (overBudget) {
+								/* End the increment here: the rest of the batch goes back to the sweep queue, where idle threads can take it */
+								env->_sweepStats._sweepIncrementsOverBudget += 1;
+								returnUnsweptRegions(env, sizeClass);
+								break;
+							}
+							budget->startIncrement();
+							incrementStartTime = omrtime_hires_clock();
 						}
 					}
 					regionPool->addSingleFree(env, env->getRegionLocalFree());				
@@ -146,6 +146,12 @@ private:
 	 */
 	virtual bool updateSweepSmallRegionCount();
 
+	/**
+	 * Called from incrementalSweepSmall() when an increment used up its -Xgc:sweepIncrementMicro= budget, to put the
+	 * regions of the batch not swept yet back on the sweep queue of the size class
+	 */
+	void returnUnsweptRegions(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
 	/**
 	 * Calculate the maximum number of regions of a single small region size class to sweep before proceeding to the next size class
 	 * while sweeping small regions.
@@ -286,6 +286,11 @@ MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _summaryTable) {
+		env->getForge()->free(_summaryTable);
+		_summaryTable = NULL;
+		_summaryTableSize = 0;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -563,6 +568,20 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
+		/* An aggressive compaction must free as much as possible, so it is never incremental */
+		_incrementalCompaction = (0 != _extensions->incrementalCompactionBudget) && !aggressive && !_extensions->usingSATBBarrier();
+		_incrementalCompactionIncomplete = false;
+
+		_useSummaryTable = false;
+#if !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+		/* Objects which grow when moved would make a forwarding address depend on whether each
+		 * preceding object actually moved, which the summary table can not express.
+		 */
+		if (_extensions->summaryCompaction && !_incrementalCompaction && !_extensions->usingSATBBarrier()) {
+			_useSummaryTable = allocateSummaryTable(env);
+		}
+#endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
@@ -571,19 +590,38 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
 	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
 	 *  o no worker GC threads
+	 * A summary compaction slides every region down to its base, so it never leaves holes and
+	 * keeps using all threads.
 	 */
-	if (aggressive || (1 == env->_currentTask->getThreadCount())  || (_extensions->usingSATBBarrier())) {
+	if (!_useSummaryTable && (aggressive || (1 == env->_currentTask->getThreadCount())  || (_extensions->usingSATBBarrier()))) {
 		singleThreaded = true;
 	}
 
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
 	workerSetupForGC(env, singleThreaded);
+	if (_incrementalCompaction) {
+		selectIncrementalSubAreas(env);
+	}
+	if (_useSummaryTable) {
+		summarizeSubAreas(env);
+	}
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
-	/* If a single threaded compaction force compact to run on main thread. Required
-	 * to ensure all events issued on main thread.
-	 */
-	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+	if (_useSummaryTable) {
+		env->_compactStats._moveStartTime = omrtime_hires_clock();
+		slideObjects(env, objectCount, byteCount);
+		env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		MM_AtomicOperations::sync();
+
+		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+		fixupObjectsFromSummary(env, fixupObjectsCount);
+		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+	} else if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		/* If a single threaded compaction force compact to run on main thread. Required
+		 * to ensure all events issued on main thread.
+		 */
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
 		moveObjects(env, objectCount, byteCount, skippedObjectCount);
 		env->_compactStats._moveEndTime = omrtime_hires_clock();
@@ -613,7 +651,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	MM_AtomicOperations::sync();
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		rebuildFreelist(env);
+		if (_useSummaryTable) {
+			rebuildFreelistFromSummary(env);
+		} else {
+			rebuildFreelist(env);
+		}
 
 		MM_MemoryPool *memoryPool;
 		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
@@ -627,7 +669,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	if (rebuildMarkBits) {
-		rebuildMarkbits(env);
+		if (_useSummaryTable) {
+			rebuildMarkbitsFromSummary(env);
+		} else {
+			rebuildMarkbits(env);
+		}
 		MM_AtomicOperations::sync();
 	}
 
@@ -713,6 +759,10 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 
 				currentFreeBase = NULL;
 				currentFreeSize = 0;
+
+				if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+					addFreeEntriesInFixupOnlySubArea(env, memorySubSpace, poolState, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject);
+				}
 			}
         } while (subAreaTable[i++].state != SubAreaEntry::end_segment);
 
@@ -727,6 +777,30 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 	}
 }
 
+/**
+ * Objects of a fixup_only subArea have not moved, so its free memory is whatever lies between its
+ * marked objects. Subareas start at the first marked object of a page, so the last page of the
+ * subArea holds no marked objects of its own.
+ */
+void
+MM_CompactScheme::addFreeEntriesInFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, omrobjectptr_t firstObject, omrobjectptr_t endObject)
+{
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)firstObject, (uintptr_t *)pageStart(pageIndex(endObject)));
+	uintptr_t freeBase = (uintptr_t)firstObject;
+	omrobjectptr_t objectPtr = NULL;
+
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if ((uintptr_t)objectPtr > freeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, (void *)freeBase, (uintptr_t)objectPtr - freeBase);
+		}
+		freeBase = (uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+
+	if ((uintptr_t)endObject > freeBase) {
+		addFreeEntry(env, memorySubSpace, poolState, (void *)freeBase, (uintptr_t)endObject - freeBase);
+	}
+}
+
 /*
  * Call appropriate Memory Pool to add a new free entry to the pool. If the free entry
  * spans more than one subpool then it will be split into 2 free entries.
@@ -1286,6 +1360,10 @@ MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 		return objectPtr;
 	}
 
+	if (_useSummaryTable) {
+		return getForwardingPtrFromSummary(objectPtr);
+	}
+
 	intptr_t index = pageIndex(objectPtr);
 	omrobjectptr_t forwardingPtr = _compactTable[index].getAddr();
 	if (forwardingPtr == 0) {
@@ -1417,7 +1495,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1492,7 +1570,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i + 1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
@@ -1532,4 +1610,409 @@ MM_CompactScheme::changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * en
 	return successful;
 }
 
+void
+MM_CompactScheme::selectIncrementalSubAreas(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	/* Pass 1 (parallel): live bytes per subArea */
+	GC_HeapRegionIteratorStandard measureIterator(regionManager);
+	while (NULL != (region = measureIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::measuring)) {
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, (uintptr_t *)pageStart(pageIndex(subAreaTable[i + 1].firstObject)));
+				uintptr_t liveBytes = 0;
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+				}
+				subAreaTable[i].liveBytes = liveBytes;
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	/* Pass 2 (main thread): select the most fragmented subAreas whose live bytes fit within the budget */
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		uintptr_t minFreeChunk = _extensions->tlhMinimumSize;
+		uintptr_t garbageThreshold = _extensions->incrementalCompactionGarbageThreshold;
+		uintptr_t budget = _extensions->incrementalCompactionBudget;
+		/* live bytes of the fragmented subAreas, by percentage of the subArea which is free */
+		uintptr_t liveBytesByFragmentation[101] = {0};
+
+		for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+			if (SubAreaEntry::init == _subAreaTable[i].state) {
+				uintptr_t size = (uintptr_t)_subAreaTable[i + 1].firstObject - (uintptr_t)_subAreaTable[i].firstObject;
+				uintptr_t freeBytes = size - _subAreaTable[i].liveBytes;
+				uintptr_t fragmentation = (freeBytes * 100) / size;
+				if ((freeBytes >= minFreeChunk) && (fragmentation >= garbageThreshold)) {
+					liveBytesByFragmentation[fragmentation] += _subAreaTable[i].liveBytes;
+				}
+			}
+		}
+
+		/* Lower the fragmentation threshold while every subArea at or above it still fits; the subAreas
+		 * just below the threshold are then taken in address order until the budget is used up.
+		 */
+		uintptr_t threshold = 101;
+		uintptr_t selectedBytes = 0;
+		while ((threshold > 0) && ((selectedBytes + liveBytesByFragmentation[threshold - 1]) <= budget)) {
+			threshold -= 1;
+			selectedBytes += liveBytesByFragmentation[threshold];
+		}
+		uintptr_t remainingBudget = budget - selectedBytes;
+
+		_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
+		_compactTo = (omrobjectptr_t)_heap->getHeapBase();
+		for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+			if (SubAreaEntry::init == _subAreaTable[i].state) {
+				uintptr_t size = (uintptr_t)_subAreaTable[i + 1].firstObject - (uintptr_t)_subAreaTable[i].firstObject;
+				uintptr_t freeBytes = size - _subAreaTable[i].liveBytes;
+				uintptr_t fragmentation = (freeBytes * 100) / size;
+				bool selected = false;
+				if (freeBytes >= minFreeChunk) {
+					if (fragmentation < garbageThreshold) {
+						/* too dense to be worth moving */
+						env->_compactStats._incrementalDenseSubAreas += 1;
+					} else if (fragmentation >= threshold) {
+						selected = true;
+					} else if (((fragmentation + 1) == threshold) && (_subAreaTable[i].liveBytes <= remainingBudget)) {
+						remainingBudget -= _subAreaTable[i].liveBytes;
+						selected = true;
+					} else {
+						_incrementalCompactionIncomplete = true;
+					}
+				}
+
+				env->_compactStats._incrementalSubAreas += 1;
+				if (selected) {
+					env->_compactStats._incrementalCompactedSubAreas += 1;
+					env->_compactStats._incrementalLeastGarbage = OMR_MIN(env->_compactStats._incrementalLeastGarbage, fragmentation);
+					_compactFrom = OMR_MIN(_compactFrom, _subAreaTable[i].firstObject);
+					_compactTo = OMR_MAX(_compactTo, _subAreaTable[i + 1].firstObject);
+				} else {
+					_subAreaTable[i].state = SubAreaEntry::fixup_only;
+				}
+			}
+		}
+
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+bool
+MM_CompactScheme::allocateSummaryTable(MM_EnvironmentBase *env)
+{
+	if (NULL == _summaryTable) {
+		uintptr_t heapRange = (uintptr_t)_heap->getHeapTop() - _heapBase;
+		uintptr_t entryCount = (heapRange + J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT - 1) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT;
+		_summaryTable = (uintptr_t *)env->getForge()->allocate(entryCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL != _summaryTable) {
+			_summaryTableSize = entryCount;
+		}
+	}
+
+	return NULL != _summaryTable;
+}
+
+void
+MM_CompactScheme::summarizeSubAreas(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	/* Pass 1 (parallel): live bytes per subArea and subArea relative offsets per block */
+	GC_HeapRegionIteratorStandard summarizeIterator(regionManager);
+	while (NULL != (region = summarizeIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::summarizing)) {
+				summarizeSubArea(env, subAreaTable, i);
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	/* Pass 2 (main thread): prefix sum of live bytes gives each subArea its destination within the region */
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		GC_HeapRegionIteratorStandard prefixIterator(regionManager);
+		subAreaTable = _subAreaTable;
+		while (NULL != (region = prefixIterator.nextRegion())) {
+			if (!region->isCommitted() || (0 == region->getSize())) {
+				continue;
+			}
+			Assert_MM_true(region->getLowAddress() == subAreaTable[0].firstObject);
+			uintptr_t destination = (uintptr_t)region->getLowAddress();
+			intptr_t i;
+			for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+				subAreaTable[i].destination = (omrobjectptr_t)destination;
+				destination += subAreaTable[i].liveBytes;
+			}
+			/* the end_segment entry records where the live data of the region ends */
+			subAreaTable[i].destination = (omrobjectptr_t)destination;
+			subAreaTable += (i+1);
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* Pass 3 (parallel): turn the relative block offsets into forwarding addresses */
+	GC_HeapRegionIteratorStandard applyIterator(regionManager);
+	subAreaTable = _subAreaTable;
+	while (NULL != (region = applyIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::applying_summary)) {
+				uintptr_t destination = (uintptr_t)subAreaTable[i].destination;
+				uintptr_t endIndex = summaryIndex(pageStart(pageIndex(subAreaTable[i + 1].firstObject)));
+				/* entries of blocks without marked objects are never read, so they may be adjusted too */
+				for (uintptr_t index = summaryIndex(subAreaTable[i].firstObject); index < endIndex; index++) {
+					_summaryTable[index] += destination;
+				}
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	/* A subArea must not be claimed for the move before every thread is done claiming subAreas for this pass */
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+}
+
+/**
+ * Walk the marked objects of a subArea, recording the total number of live bytes and, for each block
+ * which contains at least one marked object, the offset of its first marked object relative to the
+ * destination of the subArea. Subareas start at the first marked object of a page, so a block never
+ * holds marked objects of two subAreas.
+ */
+void
+MM_CompactScheme::summarizeSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i)
+{
+	omrobjectptr_t firstObject = subAreaTable[i].firstObject;
+	omrobjectptr_t endObject = subAreaTable[i + 1].firstObject;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)firstObject, (uintptr_t *)pageStart(pageIndex(endObject)));
+	uintptr_t liveBytes = 0;
+	uintptr_t lastIndex = UDATA_MAX;
+	omrobjectptr_t objectPtr = NULL;
+
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		uintptr_t index = summaryIndex(objectPtr);
+		if (index != lastIndex) {
+			Assert_MM_true(index < _summaryTableSize);
+			_summaryTable[index] = liveBytes;
+			lastIndex = index;
+		}
+		liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+
+	subAreaTable[i].liveBytes = liveBytes;
+}
+
+void
+MM_CompactScheme::slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::evacuating)) {
+				slideSubArea(env, subAreaTable, i, objectCount, byteCount);
+			}
+		}
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::slideSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	Assert_MM_true(SubAreaEntry::init == subAreaTable[i].state);
+
+	omrobjectptr_t endObject = subAreaTable[i + 1].firstObject;
+	uintptr_t destination = (uintptr_t)subAreaTable[i].destination;
+	uintptr_t destinationEnd = (uintptr_t)subAreaTable[i + 1].destination;
+
+	/* Destination ranges never overlap, but our destination may overlap the objects of lower subAreas
+	 * which have not been moved yet. Those subAreas were claimed before this one, so just wait for them.
+	 */
+	for (intptr_t j = i - 1; (j >= 0) && ((uintptr_t)subAreaTable[j + 1].firstObject > destination); j--) {
+		if (destinationEnd > (uintptr_t)subAreaTable[j].firstObject) {
+			while (SubAreaEntry::full != subAreaTable[j].state) {
+				MM_AtomicOperations::yieldCPU();
+			}
+		}
+	}
+	MM_AtomicOperations::loadSync();
+
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, (uintptr_t *)pageStart(pageIndex(endObject)));
+	omrobjectptr_t objectPtr = NULL;
+	omrobjectptr_t nextObject = NULL;
+	for (objectPtr = markedObjectIterator.nextObject(); NULL != objectPtr; objectPtr = nextObject) {
+		/* advance the iterator before the move may overwrite the current object */
+		nextObject = markedObjectIterator.nextObject();
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+
+		if ((uintptr_t)objectPtr != destination) {
+			Assert_MM_true((uintptr_t)objectPtr > destination);
+			preObjectMove(env, objectPtr);
+			memmove((void *)destination, objectPtr, objectSize);
+			postObjectMove(env, (omrobjectptr_t)destination);
+			objectCount += 1;
+			byteCount += objectSize;
+		}
+		destination += objectSize;
+	}
+	Assert_MM_true(destination == destinationEnd);
+
+	MM_AtomicOperations::storeSync();
+	subAreaTable[i].state = SubAreaEntry::full;
+}
+
+void
+MM_CompactScheme::fixupObjectsFromSummary(MM_EnvironmentStandard *env, uintptr_t &objectCount)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
+				/* the moved objects of a subArea are contiguous from its destination */
+				fixupSubArea(env, subAreaTable[i].destination, subAreaTable[i + 1].destination, false, objectCount);
+			}
+		}
+		subAreaTable += (i+1);
+	}
+}
+
+omrobjectptr_t
+MM_CompactScheme::getForwardingPtrFromSummary(omrobjectptr_t objectPtr) const
+{
+	omrobjectptr_t forwardingPtr = (omrobjectptr_t)_summaryTable[summaryIndex(objectPtr)];
+
+	/* Objects of a block have been moved next to each other, so skip those marked before this one */
+	uintptr_t markWord = *_markMap->getSlotPtrForAddress(objectPtr);
+	intptr_t precedingObjects = countBits(markWord & makeMask(_markMap->getBitIndex(objectPtr)));
+	for (intptr_t i = 0; i < precedingObjects; i++) {
+		uintptr_t size = _extensions->objectModel.getConsumedSizeInBytesWithHeader(forwardingPtr);
+		forwardingPtr = (omrobjectptr_t)((uintptr_t)forwardingPtr + size);
+	}
+
+	MM_CompactSchemeFixupObject::verifyForwardingPtr(objectPtr, forwardingPtr);
+	return forwardingPtr;
+}
+
+void
+MM_CompactScheme::rebuildFreelistFromSummary(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
+		Assert_MM_true(region->getLowAddress() == subAreaTable[0].firstObject);
+
+		MM_CompactMemoryPoolState poolStateObj;
+		MM_CompactMemoryPoolState *poolState = &poolStateObj;
+		poolState->_memoryPool = subAreaTable[0].memoryPool;
+
+		intptr_t i = 0;
+		while (subAreaTable[i].state != SubAreaEntry::end_segment) {
+			i += 1;
+		}
+
+		void *currentFreeBase = (void *)subAreaTable[i].destination;
+		uintptr_t currentFreeSize = (uintptr_t)region->getHighAddress() - (uintptr_t)currentFreeBase;
+		if (0 != currentFreeSize) {
+#if defined(DEBUG_PAINT_FREE)
+			memset(currentFreeBase, 0xBB, currentFreeSize);
+#endif /* DEBUG_PAINT_FREE */
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+		}
+
+		if (NULL != poolState->_freeListHead) {
+			/* Terminate the free list with NULL*/
+			poolState->_memoryPool->createFreeEntry(env, poolState->_previousFreeEntry,
+													(uint8_t *)poolState->_previousFreeEntry + poolState->_previousFreeEntrySize);
+		}
+		flushPool(env, poolState);
+
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsFromSummary(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	/* Objects may have moved into the pages of another subArea, so all bits are cleared before any are set */
+	GC_HeapRegionIteratorStandard clearIterator(regionManager);
+	while (NULL != (region = clearIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
+				_markMap->setBitsInRange(env, pageStart(pageIndex(subAreaTable[i].firstObject)), pageStart(pageIndex(subAreaTable[i + 1].firstObject)), true);
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	GC_HeapRegionIteratorStandard markIterator(regionManager);
+	subAreaTable = _subAreaTable;
+	while (NULL != (region = markIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::marking_destinations)) {
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, subAreaTable[i].destination, subAreaTable[i + 1].destination, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					/* neighbouring subAreas may share a mark map word at their destinations */
+					_markMap->atomicSetBit(objectPtr);
+				}
+			}
+		}
+		subAreaTable += (i+1);
+	}
+}
+
 #endif /* OMR_GC_MODRON_COMPACTION */
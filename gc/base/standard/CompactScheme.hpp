@@ -92,6 +92,8 @@ private:
 		omrobjectptr_t freeChunk;
 		volatile uintptr_t state;
 		volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		uintptr_t liveBytes; /**< (summary compaction) bytes of marked objects starting in the subarea */
+		omrobjectptr_t destination; /**< (summary compaction) address the first marked object of the subarea slides to */
         
 		/* legal values for currentAction */
 		enum {
@@ -100,7 +102,11 @@ private:
 			evacuating,
 			fixing_up,
 			rebuilding_mark_bits,
-			fixing_heap_for_walk
+			fixing_heap_for_walk,
+			summarizing,
+			applying_summary,
+			marking_destinations,
+			measuring
 		};
     	
 		/* legal values for state
@@ -138,6 +144,11 @@ protected:
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
 	MM_CompactDelegate     _delegate;
+	uintptr_t              *_summaryTable; /**< Forwarding address of the first marked object in each mark map word's worth of heap (-Xgc:summaryCompaction), allocated on first use */
+	uintptr_t              _summaryTableSize; /**< Number of entries in _summaryTable */
+	bool                   _useSummaryTable; /**< True if the current compaction computes forwarding addresses from _summaryTable */
+	bool                   _incrementalCompaction; /**< True if the current compaction only moves the subAreas selected within -Xgc:incrementalCompactionBudget */
+	bool                   _incrementalCompactionIncomplete; /**< True if the last incremental compaction left fragmented subAreas for a later compaction */
 
 public:
 
@@ -220,6 +231,79 @@ protected:
 
 	void rebuildFreelist(MM_EnvironmentStandard *env);
 
+	/**
+	 * Incremental compaction: measure the live bytes of every subArea, then keep the most fragmented
+	 * subAreas whose live bytes fit within the budget for compaction and turn all others into fixup_only
+	 * subAreas, whose objects stay in place. SubAreas with less free space than
+	 * -Xgc:incrementalCompactionGarbageThreshold= are never moved. The compaction range is narrowed to the selected subAreas,
+	 * so fixing up a reference outside of it needs no forwarding lookup.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void selectIncrementalSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Incremental compaction: add the gaps between the marked objects of a fixup_only subArea to the free list.
+	 */
+	void addFreeEntriesInFixupOnlySubArea(MM_EnvironmentStandard *env,
+					MM_MemorySubSpace *memorySubSpace,
+					MM_CompactMemoryPoolState *poolState,
+					omrobjectptr_t firstObject,
+					omrobjectptr_t endObject);
+
+	/**
+	 * Allocate the summary table covering the maximum heap range, if not already allocated.
+	 * @param env[in] the current thread
+	 * @return true if the table is available
+	 */
+	bool allocateSummaryTable(MM_EnvironmentBase *env);
+
+	/**
+	 * Summary compaction: record the live bytes of each subArea and the offset of the first marked
+	 * object of each block relative to the subArea, prefix sum the subAreas of each region to find their
+	 * destinations and make the block entries absolute forwarding addresses.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void summarizeSubAreas(MM_EnvironmentStandard *env);
+	void summarizeSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i);
+
+	/**
+	 * Summary compaction: slide the marked objects of every subArea to their destination. A subArea may
+	 * only start moving once all lower subAreas of the region whose objects overlap its destination range
+	 * have been moved; subAreas are claimed in address order so this never deadlocks.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount);
+	void slideSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Summary compaction: fix up the objects of every subArea at their new (contiguous) location.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
+	 */
+	void fixupObjectsFromSummary(MM_EnvironmentStandard *env, uintptr_t &objectCount);
+
+	/**
+	 * Summary compaction: each region holds its objects in one run from its base, so the free list
+	 * consists of the tail of each region.
+	 */
+	void rebuildFreelistFromSummary(MM_EnvironmentStandard *env);
+
+	/**
+	 * Summary compaction: clear the mark bits of every subArea, then set them for the moved objects.
+	 */
+	void rebuildMarkbitsFromSummary(MM_EnvironmentStandard *env);
+
+	/**
+	 * Answer the forwarding address of an object after a summary compaction has moved it.
+	 */
+	omrobjectptr_t getForwardingPtrFromSummary(omrobjectptr_t objectPtr) const;
+
 	void addFreeEntry(MM_EnvironmentStandard *env,
 					MM_MemorySubSpace *memorySubSpace,
 					MM_CompactMemoryPoolState *poolState,
@@ -271,6 +355,15 @@ protected:
 		return pageStart(pageIndex(objectPtr)+1);
 	}
 
+	/**
+	 * Return the summary table index for an object. Each entry covers the heap described by one
+	 * uintptr_t of the mark map, so a page is always made up of whole entries.
+	 */
+	MMINLINE uintptr_t summaryIndex(omrobjectptr_t objectPtr) const
+	{
+		return ((uintptr_t)objectPtr - _heapBase) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT;
+	}
+
 	/**
 	 * If to is page-aligned, create one chunk (from:to).  Otherwise, create
 	 * two free chunks: one (from:to_aligned), and the other (to_aligned:to),
@@ -323,6 +416,11 @@ public:
 	
 	MMINLINE void setMarkMap(MM_MarkMap *markMap) {	_markMap = markMap;}
 
+	/**
+	 * @return true if the last compaction was incremental and left fragmented subAreas uncompacted
+	 */
+	MMINLINE bool isIncrementalCompactionIncomplete() { return _incrementalCompactionIncomplete; }
+
 	/**
 	 * Create a CompactScheme object.
 	 */
@@ -336,6 +434,11 @@ public:
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
 		, _delegate()
+		, _summaryTable(NULL)
+		, _summaryTableSize(0)
+		, _useSummaryTable(false)
+		, _incrementalCompaction(false)
+		, _incrementalCompactionIncomplete(false)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -1029,8 +1029,9 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
  * Do final card cleaning.
  *
  * To be called by a STW parallel mark task to clean enough cards such that we
- * push a packet worth of references.  Loops calling getNextDirtyCard() until
- * we have pushed enough references or end of card table reached.
+ * push a packet worth of references.  Loops calling getNextDirtyCardRun() until
+ * we have pushed enough references or end of card table reached. Each run of
+ * contiguous dirty cards is cleaned and then retraced as a single heap range.
  *
  * @param bytesTraced  - reference to counter to pass back count of bytes traced
  * 						 to caller
@@ -1055,34 +1056,41 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	env->_workStack.clearPushCount();
 
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+	uintptr_t runCards = 0;
 	
 	for ( ;
-		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;
+		(nextDirtyCard= getNextDirtyCardRun(env, _finalCardCleanMask, false, FINAL_CARD_CLEAN_MAX_RUN_CARDS, &runCards)) != NULL;
 		) {
 
 		/* Should never get EXCLUSIVE_VMACCESS_REQUESTED in final clean cards phase */
 		assume0(nextDirtyCard != (Card *)EXCLUSIVE_VMACCESS_REQUESTED);
+		uintptr_t phase1CardsInRun = 0;
 
-		/* Reset counters if we are now cleaning phase 2 cards */
-		if(!phase2 && nextDirtyCard >= _firstCardInPhase2) {
-			incFinalCleanedCards(cards, phase2);
+		/* Reset counters if we are now cleaning phase 2 cards. A run may straddle the
+		 * first phase 2 card in which case the cards before it are counted as phase 1.
+		 */
+		if(!phase2 && (nextDirtyCard + runCards) > _firstCardInPhase2) {
+			if (nextDirtyCard < _firstCardInPhase2) {
+				phase1CardsInRun = (uintptr_t)(_firstCardInPhase2 - nextDirtyCard);
+			}
+			incFinalCleanedCards(cards + phase1CardsInRun, phase2);
 			cards = 0;
 			phase2 = true;
 		}
 
-		/* Clean the card before we trace into it */
-		finalCleanCard(nextDirtyCard);
-		cards += 1;
+		/* Clean the cards before we trace into them */
+		finalCleanCardRun(nextDirtyCard, runCards);
+		cards += (runCards - phase1CardsInRun);
 
-		/* Calculate address of first slot heap for the card to be cleaned... */
+		/* Calculate address of first slot heap for the run to be cleaned... */
 		uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,nextDirtyCard);
 		/* ..and address of last slot N.B Range is EXCLUSIVE */
-		uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
+		uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + (CARD_SIZE * runCards));
 
 		/* prevent loading mark bits prematurely */
 		MM_AtomicOperations::readBarrier();
 
-		/* Then iterate over all marked objects in the heap between the two addresses */
+		/* Then iterate over all marked objects in the heap between the two addresses as a single range */
 		MM_HeapMapIterator markedObjectIterator(_extensions, markMap, heapBase, heapTop);
 		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
 			traceCount += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_DIRTY_CARD);
@@ -1603,6 +1611,33 @@ MM_ConcurrentCardTable::resetCleaningRanges(MM_EnvironmentBase *env)
 Card*
 MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean)
 {
+	uintptr_t runCards = 0;
+	return getNextDirtyCardRun(env, cardMask, concurrentCardClean, 1, &runCards);
+}
+
+/**
+ * Get the next run of contiguous dirty cards in card table.
+ *
+ * Find the next dirty card (as defined by cardmask) in the card table and claim
+ * it together with up to maxRunCards - 1 dirty cards immediately following it.
+ * A run never extends beyond the end of the current cleaning range or beyond the
+ * last card to be cleaned in this phase so the heap it covers is always contiguous.
+ *
+ * @param cardMask - mask to apply to cards to identify those cards the caller
+ * 					 is interested in
+ * @param maxRunCards - maximum number of cards to claim
+ * @param runCards - reference to pass back number of cards claimed
+ *
+ * @return Routine either returns address of first card in run, NULL if no
+ * more dirty cards, EXCLUSIVE_VMACCESS_REQUESTED if another thread waiting
+ * for exclusive VM access.
+ */
+Card*
+MM_ConcurrentCardTable::getNextDirtyCardRun(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean, uintptr_t maxRunCards, uintptr_t *runCards)
+{
+	assume0(0 < maxRunCards);
+	*runCards = 0;
+
 	/* Get a local copy of next current range being cleaned */
 	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
 
@@ -1639,9 +1674,7 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 				 * complete slots worth of cards; then go card at a time
 				 **/
 				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
+				nextSlot = skipCleanSlots(nextSlot, lastSlot);
 				/*
 			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
 				 */
@@ -1663,9 +1696,12 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 				/* Yes..so re-sync with race winner and start scan again */
 				break;
 			} else {
-				/* No .. so attempt to grab this card*/
+				/* No .. so attempt to grab this card and any dirty cards which follow it */
 				nextDirtyCard = currentCard;
 				currentCard += 1;
+				while ((currentCard < lastCardToClean) && ((uintptr_t)(currentCard - nextDirtyCard) < maxRunCards) && (0 != (*currentCard & cardMask))) {
+					currentCard += 1;
+				}
 				if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
 					return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
 				}
@@ -1676,9 +1712,12 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 				if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
 											  							  (uintptr_t)firstCard,
 											  							  (uintptr_t)currentCard)) {
+					/* Rewind so we re-sync below rather than treat a run ending at the last card as range complete */
+					currentCard = nextDirtyCard;
 					break;
 				}
 				
+				*runCards = (uintptr_t)(currentCard - nextDirtyCard);
 				return nextDirtyCard;
 			}
 		} /* of currentCard < lastCardToClean */
@@ -66,6 +66,9 @@
 #define FINAL_CARD_CLEAN_MASK (CARD_DIRTY)
 
 #define SLOT_ALL_CLEAN (uintptr_t)CARD_CLEAN
+#define CARD_SCAN_STRIDE_BYTES ((uintptr_t)32)
+#define CARD_SCAN_STRIDE_SLOTS (CARD_SCAN_STRIDE_BYTES / sizeof(uintptr_t))
+#define FINAL_CARD_CLEAN_MAX_RUN_CARDS ((uintptr_t)32)
 #define EXCLUSIVE_VMACCESS_REQUESTED ((uintptr_t)-1)
  
 /**
@@ -231,6 +234,7 @@ protected:
 	
 	bool cleanSingleCard(MM_EnvironmentBase *env, Card *card, uintptr_t bytesToClean, uintptr_t *totalBytesCleaned);
 	Card* getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean);
+	Card* getNextDirtyCardRun(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean, uintptr_t maxRunCards, uintptr_t *runCards);
 	
 	bool cardHasMarkedObjects(MM_EnvironmentBase *env, Card *card);
 	
@@ -240,6 +244,16 @@ protected:
 	
 	MMINLINE virtual void concurrentCleanCard(Card *card) { *card = CARD_CLEAN; };
 	MMINLINE virtual void finalCleanCard(Card *card) { *card = CARD_CLEAN; };
+	/**
+	 * Clean a run of cards claimed for final card cleaning. Cleans each card with finalCleanCard(),
+	 * subclasses may specialize cleaning of the whole run.
+	 */
+	MMINLINE virtual void finalCleanCardRun(Card *firstCard, uintptr_t cards)
+	{
+		for (Card *card = firstCard; card < (firstCard + cards); card++) {
+			finalCleanCard(card);
+		}
+	};
 			
 	MMINLINE bool cardTableNeedsPreparing(CardCleanPhase currentPhase) 
 	{ 	
@@ -286,6 +300,36 @@ protected:
 	}
 
 public:
+	/**
+	 * Skip the slots of the card table which only hold clean cards. Once aligned clean stretches
+	 * are skipped a stride at a time: the slots in a stride are OR'ed together so only a single
+	 * branch is taken per stride of clean cards.
+	 * @param[in] nextSlot The first slot to check
+	 * @param[in] lastSlot The slot after the last slot to check
+	 * @return The first slot holding a card which is not clean, or lastSlot if there is none
+	 */
+	MMINLINE static uintptr_t *
+	skipCleanSlots(uintptr_t *nextSlot, uintptr_t *lastSlot)
+	{
+		while (nextSlot < lastSlot) {
+			if ((0 == ((uintptr_t)nextSlot % CARD_SCAN_STRIDE_BYTES)) && ((lastSlot - nextSlot) >= (intptr_t)CARD_SCAN_STRIDE_SLOTS)) {
+				uintptr_t strideCards = SLOT_ALL_CLEAN;
+				for (uintptr_t slot = 0; slot < CARD_SCAN_STRIDE_SLOTS; slot++) {
+					strideCards |= nextSlot[slot];
+				}
+				if (SLOT_ALL_CLEAN == strideCards) {
+					nextSlot += CARD_SCAN_STRIDE_SLOTS;
+					continue;
+				}
+			}
+			if (SLOT_ALL_CLEAN != *nextSlot) {
+				break;
+			}
+			nextSlot += 1;
+		}
+		return nextSlot;
+	}
+
 	/**
 	 * Creates and returns a new instance of the card table.
 	 * @param[in] env The thread starting up the collector
@@ -384,7 +428,7 @@ public:
 	 * Do final card cleaning.
 	 *
 	 * To be called by a STW parallel mark task to clean enough cards such that we
-	 * push a packet worth of references.  Loops calling getNextDirtyCard() until
+	 * push a packet worth of references.  Loops calling getNextDirtyCardRun() until
 	 * we have pushed enough references or end of card table reached.
 	 *
 	 * @param bytesTraced  - reference to counter to pass back count of bytes traced
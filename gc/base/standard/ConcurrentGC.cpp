@@ -192,7 +192,9 @@ MM_ConcurrentGC::reportConcurrentKickoff(MM_EnvironmentBase *env)
 		_stats.getKickoffThreshold(),
 		_stats.getRemainingFree(),
 		_stats.getKickoffReason(),
-		_languageKickoffReason
+		_languageKickoffReason,
+		_conHelpersActive,
+		_conHelpersStarted
 	);
 }
 
@@ -637,6 +639,13 @@ MM_ConcurrentGC::resetConcurrentParameters(MM_EnvironmentBase *env)
 	_maxAverageAlloc2TraceRate = 0;
 	_lastFreeSize = LAST_FREE_SIZE_NEEDS_INITIALIZING;
 	_lastTotalTraced = 0;
+
+	/* Every cycle starts from the configured helpers, the pool grows again from there as needed */
+	if (_conHelperPacingModel.isElastic()) {
+		omrthread_monitor_enter(_conHelpersActivationMonitor);
+		_conHelpersActive = _conHelperPacingModel.getCycleStartTarget();
+		omrthread_monitor_exit(_conHelpersActivationMonitor);
+	}
 }
 
 /**
@@ -808,7 +817,8 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 	while (CONCURRENT_HELPER_SHUTDOWN != request) {
 
 		omrthread_monitor_enter(_conHelpersActivationMonitor);
-		while (CONCURRENT_HELPER_WAIT == (request = _conHelpersRequest)) {
+		while ((CONCURRENT_HELPER_WAIT == (request = _conHelpersRequest))
+				|| ((CONCURRENT_HELPER_MARK == request) && isConHelperParked(workerID))) {
 			omrthread_monitor_wait(_conHelpersActivationMonitor);
 		}
 		omrthread_monitor_exit(_conHelpersActivationMonitor);
@@ -836,6 +846,7 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 
 		/* perform trace work */
 		while ((CONCURRENT_HELPER_MARK == request)
+				&& !isConHelperParked(workerID)
 				&& _markingScheme->getWorkPackets()->inputPacketAvailable(env)
 				&& spinLimiter.spin()) {
 			sizeTraced = localMark(env, sizeToTrace);
@@ -847,11 +858,18 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 			request = getConHelperRequest(env);
 		}
 
-		/* Collector specific Con Helper Work */
-		conHelperDoWorkInternal(env, &request, &spinLimiter, &totalScanned);
+		if (isConHelperParked(workerID)) {
+			/* Paced out of the pool, so leave the request to the active helpers */
+			if (CONCURRENT_HELPER_MARK == request) {
+				request = CONCURRENT_HELPER_WAIT;
+			}
+		} else {
+			/* Collector specific Con Helper Work */
+			conHelperDoWorkInternal(env, &request, &spinLimiter, &totalScanned);
 
-		if (CONCURRENT_HELPER_MARK == request) {
-			request = switchConHelperRequest(CONCURRENT_HELPER_MARK, CONCURRENT_HELPER_WAIT);
+			if (CONCURRENT_HELPER_MARK == request) {
+				request = switchConHelperRequest(CONCURRENT_HELPER_MARK, CONCURRENT_HELPER_WAIT);
+			}
 		}
 
 		Assert_MM_true(CONCURRENT_HELPER_MARK != request);
@@ -950,6 +968,8 @@ MM_ConcurrentGC::initializeConcurrentHelpers(MM_GCExtensionsBase *extensions)
 	}
 	omrthread_monitor_exit(_conHelpersActivationMonitor);
 	_conHelpersStarted = conHelperThreadCount;
+	_conHelperPacingModel.initialize((uint32_t)_extensions->concurrentBackground, _conHelpersStarted);
+	_conHelpersActive = _conHelperPacingModel.getCycleStartTarget();
 
 	return ((_conHelpersStarted == _conHelperThreads) ? true : false);
 }
@@ -1337,6 +1357,8 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 			_alloc2ConHelperTraceRate = MM_Math::weightedAverage(_alloc2ConHelperTraceRate, newConHelperRate, CONCURRENT_HELPER_HISTORY_WEIGHT);
 
 			totalTraced += conTraced;
+
+			paceConHelperThreads(env, freeSize);
 		}
 
 		_lastAverageAlloc2TraceRate = ((float)(totalTraced - _lastTotalTraced)) / ((float)freeSpaceUsed);
@@ -1353,23 +1375,37 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 	omrthread_monitor_exit(_concurrentTuningMonitor);
 }
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
-/**
- * Replenish a pools free lists to satisfy a given allocate.
- * The given pool was unable to satisfy an allocation request of (at least) the given size.  See if there is work
- * that can be done to increase the free stores of the pool so that the request can be met.
- * @note This call is made under the pools allocation lock (or equivalent)
- * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
- */
-bool
-MM_ConcurrentGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+void
+MM_ConcurrentGC::paceConHelperThreads(MM_EnvironmentBase *env, uintptr_t freeSize)
 {
-	if (_extensions->concurrentSweep) {
-		return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+	if (!_conHelperPacingModel.isElastic()) {
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint32_t active = _conHelpersActive;
+	uintptr_t remainingWork = MM_Math::saturatingSubtract(getTraceTarget(), workCompleted());
+	uintptr_t remainingFree = MM_Math::saturatingSubtract(freeSize, _kickoffThresholdBuffer);
+
+	/* The first samples of CPU load are not available, so do not grow until there is one */
+	uint32_t idleCPUs = 0;
+	double cpuLoad = 0.0;
+	if (0 == omrsysinfo_get_CPU_load(&cpuLoad)) {
+		uintptr_t cpuCount = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET);
+		idleCPUs = (uint32_t)((double)cpuCount * (1.0 - cpuLoad));
+	}
+
+	uint32_t target = _conHelperPacingModel.calculateTarget(active, remainingWork, remainingFree, _alloc2ConHelperTraceRate, idleCPUs);
+	if (target != active) {
+		omrthread_monitor_enter(_conHelpersActivationMonitor);
+		_conHelpersActive = target;
+		if (target > active) {
+			/* Wake the helpers just activated if marking is already requested */
+			omrthread_monitor_notify_all(_conHelpersActivationMonitor);
+		}
+		omrthread_monitor_exit(_conHelpersActivationMonitor);
 	}
-	return false;
 }
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 /**
  * Pay the allocation tax for the mutator.
@@ -35,6 +35,7 @@
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentGCStats.hpp"
+#include "ConcurrentHelperPacingModel.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentStandard.hpp"
 #include "ParallelGlobalGC.hpp"
@@ -140,7 +141,9 @@ private:
 	uint32_t _conHelperThreads;
 	uint32_t _conHelpersStarted;
 	volatile uint32_t _conHelpersShutdownCount;
+	volatile uint32_t _conHelpersActive; /**< number of started helpers taking part in marking, the others are parked (see paceConHelperThreads()) */
 	omrthread_monitor_t _conHelpersActivationMonitor;
+	MM_ConcurrentHelperPacingModel _conHelperPacingModel; /**< sizes _conHelpersActive when concurrentBackgroundMax allows more helpers than concurrentBackground */
 
 	bool _initializeMarkMap;
 	omrthread_monitor_t _initWorkMonitor;
@@ -291,6 +294,22 @@ protected:
 	 * @return the value of _conHelperRequest.
 	 */
 	ConHelperRequest getConHelperRequest(MM_EnvironmentBase *env);
+
+	/**
+	 * Helpers are activated in worker ID order, so a helper is parked when its ID is not below the active count.
+	 * @return true if the helper with the given worker ID must not take part in marking
+	 */
+	MMINLINE bool isConHelperParked(uintptr_t workerID) { return workerID >= _conHelpersActive; }
+
+	/**
+	 * Resize the active part of an elastic helper pool (-Xgc:concurrentBackgroundMax=).
+	 * Enough helpers are activated for their trace rate alone to keep up with the trace rate needed to finish
+	 * marking before free space runs out, so that mutators pay no allocation tax.  Helpers are only added
+	 * while there are idle CPUs (the CPU target count honours cgroup quotas), and removed when the remaining
+	 * ones are enough.
+	 * @param freeSize the current amount of taxable free space
+	 */
+	void paceConHelperThreads(MM_EnvironmentBase *env, uintptr_t freeSize);
 	virtual void conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned) {};
 	void resumeConHelperThreads(MM_EnvironmentBase *env);
 
@@ -414,9 +433,6 @@ public:
 	 */
 	virtual bool forceKickoff(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
-	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
 	bool concurrentFinalCollection(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace);
 	virtual uintptr_t localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace) = 0;
@@ -470,10 +486,12 @@ public:
 		,_meteringType(SOA)
 #endif /* OMR_GC_LARGE_OBJECT_AREA */		
 		,_conHelpersTable(NULL)
-		,_conHelperThreads((uint32_t)_extensions->concurrentBackground)
+		,_conHelperThreads((uint32_t)OMR_MAX(_extensions->concurrentBackground, _extensions->concurrentBackgroundMax))
 		,_conHelpersStarted(0)
 		,_conHelpersShutdownCount(0)
+		,_conHelpersActive((uint32_t)_extensions->concurrentBackground)
 		,_conHelpersActivationMonitor(NULL)
+		,_conHelperPacingModel()
 		,_initializeMarkMap(false)
 		,_initWorkMonitor(NULL)
 		,_initWorkCompleteMonitor(NULL)
@@ -477,10 +477,12 @@ MM_ConcurrentGCSATB::completeConcurrentTracing(MM_EnvironmentBase *env, uintptr_
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
 	/* Flush barrier packets */
+	uintptr_t unpublishedEntries = 0;
 	if (((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->inUsePacketsAvailable(env)) {
-			((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveInUseToNonEmpty(env);
+			unpublishedEntries = ((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveInUseToNonEmpty(env);
 			_extensions->sATBBarrierRememberedSet->flushFragments(env);
 	}
+	_extensions->sATBBarrierRememberedSet->tuneFragmentSlots(env, unpublishedEntries);
 
 	disableSATB(env);
 
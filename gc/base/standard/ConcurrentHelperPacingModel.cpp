@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ConcurrentHelperPacingModel.hpp"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "ModronAssertions.h"
+
+#define CONCURRENT_HELPER_PACING_HEADROOM ((float)1.25)
+
+void
+MM_ConcurrentHelperPacingModel::initialize(uint32_t minimumActive, uint32_t maximumActive)
+{
+	_minimumActive = OMR_MIN(minimumActive, maximumActive);
+	_maximumActive = maximumActive;
+}
+
+uint32_t
+MM_ConcurrentHelperPacingModel::calculateTarget(uint32_t active, uintptr_t remainingWork, uintptr_t remainingFree, float helperTraceRate, uint32_t idleCPUs)
+{
+	uint32_t target = _maximumActive;
+
+	/* Once in the buffer zone, or past the predicted work, mutators trace at the max rate, so use every helper we can */
+	if ((remainingFree > 0) && (remainingWork > 0)) {
+		float requiredRate = ((float)remainingWork) / ((float)remainingFree) * CONCURRENT_HELPER_PACING_HEADROOM;
+		if ((0 < active) && (0.0f < helperTraceRate)) {
+			/* Size for the trace rate a single helper achieved over the recent tuning intervals */
+			float neededHelpers = requiredRate / (helperTraceRate / (float)active);
+			if (neededHelpers < (float)_maximumActive) {
+				target = (uint32_t)neededHelpers;
+				if ((float)target < neededHelpers) {
+					target += 1;
+				}
+			}
+		} else {
+			/* No helper rate to size from yet, so grow one at a time */
+			target = active + 1;
+		}
+	}
+	target = OMR_MIN(OMR_MAX(target, _minimumActive), _maximumActive);
+
+	if (target > active) {
+		/* Only grow onto idle CPUs */
+		target = OMR_MIN(target, active + idleCPUs);
+	}
+
+	Assert_MM_true((_minimumActive <= target) || (target == active));
+	Assert_MM_true(target <= _maximumActive);
+	return target;
+}
+
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
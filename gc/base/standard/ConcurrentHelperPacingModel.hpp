@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(CONCURRENTHELPERPACINGMODEL_HPP_)
+#define CONCURRENTHELPERPACINGMODEL_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "Base.hpp"
+
+/**
+ * Sizes the elastic pool of concurrent mark helper threads (-Xgc:concurrentBackgroundMax).
+ *
+ * Each concurrent cycle starts with the configured number of background helpers. At every tuning interval
+ * the model picks just enough helpers to finish the remaining trace work before the free memory above the
+ * kickoff buffer is used up, sized from the trace rate one helper achieved so far. Helpers are only added
+ * onto idle CPUs, and the active count never leaves [minimum, maximum].
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentHelperPacingModel : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	uint32_t _minimumActive; /**< -Xgc:concurrentBackground helpers, active from the start of every cycle */
+	uint32_t _maximumActive; /**< helpers started, the most that can be active */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Set the bounds of the pool.
+	 * @param minimumActive configured number of background helpers
+	 * @param maximumActive number of helper threads actually started
+	 */
+	void initialize(uint32_t minimumActive, uint32_t maximumActive);
+
+	/**
+	 * Choose the number of active helpers for the rest of the cycle.
+	 * @param active helpers currently active
+	 * @param remainingWork bytes left to trace to reach the trace target
+	 * @param remainingFree free bytes left before the kickoff buffer is entered
+	 * @param helperTraceRate bytes the active helpers traced per byte allocated, or 0.0 if not sampled yet
+	 * @param idleCPUs number of CPUs available to additional helpers
+	 * @return the new number of active helpers
+	 */
+	uint32_t calculateTarget(uint32_t active, uintptr_t remainingWork, uintptr_t remainingFree, float helperTraceRate, uint32_t idleCPUs);
+
+	/**
+	 * @return true if the pool can grow and shrink, false if all started helpers are always active
+	 */
+	MMINLINE bool isElastic() { return _minimumActive < _maximumActive; }
+
+	/**
+	 * @return the number of helpers active at the start of a concurrent cycle
+	 */
+	MMINLINE uint32_t getCycleStartTarget() { return _minimumActive; }
+
+	MM_ConcurrentHelperPacingModel() :
+		MM_Base(),
+		_minimumActive(0),
+		_maximumActive(0)
+	{
+	}
+};
+
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+
+#endif /* CONCURRENTHELPERPACINGMODEL_HPP_ */
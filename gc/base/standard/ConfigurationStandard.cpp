@@ -85,6 +85,15 @@ MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 	if (result) {
 		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled();
 		extensions->setStandardGC(true);
+
+		/* Lazy sweep connects chunks to a single address ordered pool on demand - fall back to the parallel sweep
+		 * for configurations with more than one tenure pool or with other work that runs between global collections.
+		 */
+		if (extensions->lazySweep) {
+			if (extensions->isScavengerEnabled() || extensions->largeObjectArea || extensions->payAllocationTax) {
+				extensions->lazySweep = false;
+			}
+		}
 	}
 
 	if (!extensions->heapExpansionGCRatioThreshold._wasSpecified) {
@@ -162,6 +171,13 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 	}
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+	if (extensions->lazySweep) {
+		doSplit = false;
+		/* Free entry stats are only complete once every chunk has been connected, which may be well after the GC ends */
+		extensions->processLargeAllocateStats = false;
+		extensions->estimateFragmentation = NO_ESTIMATE_FRAGMENTATION;
+	}
+
 	if ((UDATA_MAX == extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold) && extensions->processLargeAllocateStats) {
 		extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold = OMR_MAX(10*1024*1024, extensions->memoryMax/100);
 	}
@@ -43,6 +43,11 @@ MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *ca
 	
 	_sublistCount = extensions->cacheListSplit;
 	Assert_MM_true(0 < _sublistCount);
+	_sublistsPerNode = _sublistCount;
+	uintptr_t affinityLeaderCount = extensions->_numaManager.getAffinityLeaderCount();
+	if (extensions->numaAwareParallelGC && (1 < affinityLeaderCount) && (0 == (_sublistCount % affinityLeaderCount))) {
+		_sublistsPerNode = _sublistCount / affinityLeaderCount;
+	}
 
 	_sublists = (struct CopyScanCacheSublist *)extensions->getForge()->allocate(sizeof(struct CopyScanCacheSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
@@ -320,11 +325,11 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
-	uintptr_t index = getSublistIndex(env);
+	uintptr_t homeIndex = getSublistIndex(env);
 	MM_CopyScanCacheStandard *cache = NULL;
 
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
+		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[getSearchIndex(homeIndex, i)];
 
 		if (NULL != list->_cacheHead) {
 			env->_scavengerStats._acquireListLockCount += 1;
@@ -344,8 +349,6 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 				break;
 			}
 		}
-
-		index = (index + 1) % _sublistCount;
 	}
 
 	return cache;
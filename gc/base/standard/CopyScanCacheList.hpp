@@ -75,6 +75,7 @@ private:
 	
 	struct CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _sublistsPerNode; /**< the number of consecutive sublists owned by each NUMA node (equal to _sublistCount unless -Xgc:numaAwareParallelGC is in effect) */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -101,7 +102,30 @@ private:
 	 */
 	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		uintptr_t numaNode = env->getNumaNode();
+		if ((0 == numaNode) || (_sublistsPerNode == _sublistCount)) {
+			return env->getEnvironmentId() % _sublistCount;
+		}
+		uintptr_t nodeStart = ((numaNode - 1) * _sublistsPerNode) % _sublistCount;
+		return nodeStart + (env->getEnvironmentId() % _sublistsPerNode);
+	}
+
+	/**
+	 * Determine the sublist to search at the given step of a pop starting at homeIndex.
+	 * All sublists of the home node are visited before those of any remote node.
+	 *
+	 * @param homeIndex the index returned by getSublistIndex()
+	 * @param step the number of sublists already searched
+	 *
+	 * @return an index into the _sublists array
+	 */
+	uintptr_t getSearchIndex(uintptr_t homeIndex, uintptr_t step)
+	{
+		uintptr_t nodeStart = homeIndex - (homeIndex % _sublistsPerNode);
+		if (step < _sublistsPerNode) {
+			return nodeStart + ((homeIndex - nodeStart + step) % _sublistsPerNode);
+		}
+		return (nodeStart + step) % _sublistCount;
 	}
 	
 	/**
@@ -202,6 +226,7 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _sublistsPerNode(0)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
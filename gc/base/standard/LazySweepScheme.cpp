@@ -0,0 +1,689 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+#include "omrthread.h"
+#include "ModronAssertions.h"
+
+#include "LazySweepScheme.hpp"
+
+#include "AllocateDescription.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapMemoryPoolIterator.hpp"
+#include "Math.hpp"
+#include "MemoryPoolAddressOrderedList.hpp"
+#include "MemorySubSpace.hpp"
+#include "MemorySubSpacePoolIterator.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "ObjectModel.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelSweepChunk.hpp"
+#include "SweepHeapSectioning.hpp"
+#include "SweepPoolState.hpp"
+#include "SweepStats.hpp"
+
+#define LAZY_SWEEP_FREE_HISTORY_WEIGHT	((float)0.5)
+
+/**
+ * Sweep state of a given memory pool.
+ * @note Defined privately by MM_LazySweepScheme
+ */
+class MM_LazySweepPoolState : public MM_SweepPoolState
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _sweepCount;  /**< Counter of number of sweep cycles */
+
+	MM_ParallelSweepChunk *_connectCurrentChunk;  /**< Next chunk to sweep and connect in the given memory pool (NULL when all have been connected) */
+	MM_HeapLinkedFreeHeader *_connectNextFreeEntry;  /**< Existing free list entry immediately following the connect range */
+	uintptr_t _connectNextFreeEntrySize;  /**< Existing free list entry size immediately following the connect range */
+
+	uintptr_t _freeMemoryConnected;  /**< Running count of the total free memory connected into the memory pool since last GC */
+	float _previousFreeRatio;  /**< Weighted ratio of free memory to memory connected into the pool in previous cycles */
+
+	uintptr_t _heapSizeToConnect;  /**< Total heap size to be connected in this pool */
+	uintptr_t _heapSizeConnected;  /**< Heap size connected into the pool */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Free the receiver and all associated resources.
+	 * @param pool J9Pool used for allocation
+	 * @param mutex mutex to protect J9Pool operations
+	 */
+	void kill(MM_EnvironmentBase *env, J9Pool *pool, omrthread_monitor_t mutex)
+	{
+		tearDown(env);
+
+		omrthread_monitor_enter(mutex);
+		pool_removeElement(pool, this);
+		omrthread_monitor_exit(mutex);
+	}
+
+	/**
+	 * Allocate and initialize a new instance of the receiver.
+	 * @param pool J9Pool should be used for allocation
+	 * @param mutex mutex to protect J9Pool operations
+	 * @param memoryPool memory pool this sweepPoolState should be associated with
+	 * @return a new instance of the receiver, or NULL on failure.
+	 */
+	static MM_LazySweepPoolState *newInstance(MM_EnvironmentBase *env, J9Pool *pool, omrthread_monitor_t mutex, MM_MemoryPool *memoryPool)
+	{
+		MM_LazySweepPoolState *sweepPoolState;
+
+		omrthread_monitor_enter(mutex);
+		sweepPoolState = (MM_LazySweepPoolState *)pool_newElement(pool);
+		omrthread_monitor_exit(mutex);
+
+		if (sweepPoolState) {
+			new(sweepPoolState) MM_LazySweepPoolState(memoryPool);
+			if (!sweepPoolState->initialize(env)) {
+				sweepPoolState->kill(env, pool, mutex);
+				sweepPoolState = NULL;
+			}
+		}
+
+		return sweepPoolState;
+	}
+
+	/**
+	 * @return true if a previous cycle has recorded a free memory ratio for the pool.
+	 */
+	MMINLINE bool hasFreeRatioHistory() { return _sweepCount > 1; }
+
+	virtual void initializeForSweep(MM_EnvironmentBase *env);
+
+	MM_LazySweepPoolState(MM_MemoryPool *memoryPool) :
+		MM_SweepPoolState(memoryPool),
+		_sweepCount(0),
+		_connectCurrentChunk(NULL),
+		_connectNextFreeEntry(NULL),
+		_connectNextFreeEntrySize(0),
+		_freeMemoryConnected(0),
+		_previousFreeRatio(0),
+		_heapSizeToConnect(0),
+		_heapSizeConnected(0)
+	{}
+
+	/*
+	 * Friends
+	 */
+	friend class MM_LazySweepScheme;
+};
+
+/**
+ * @copydoc MM_SweepPoolState::initializeForSweep(MM_EnvironmentBase *)
+ * Fold the free ratio found by the previous cycle into the running estimate before the counters are reset.
+ */
+void
+MM_LazySweepPoolState::initializeForSweep(MM_EnvironmentBase *env)
+{
+	MM_SweepPoolState::initializeForSweep(env);
+
+	if (++_sweepCount > 1) {
+		float newFreeRatio = (0 == _heapSizeConnected) ? 0 : (float)_freeMemoryConnected / (float)_heapSizeConnected;
+		if (2 == _sweepCount) {
+			_previousFreeRatio = newFreeRatio;
+		} else {
+			_previousFreeRatio = MM_Math::weightedAverage(_previousFreeRatio, newFreeRatio, LAZY_SWEEP_FREE_HISTORY_WEIGHT);
+		}
+	}
+
+	_connectCurrentChunk = NULL;
+	_connectNextFreeEntry = NULL;
+	_connectNextFreeEntrySize = 0;
+	_freeMemoryConnected = 0;
+	_heapSizeToConnect = 0;
+	_heapSizeConnected = 0;
+}
+
+/**
+ * Parallel task to sweep every chunk that has not been connected yet.
+ * @note Defined privately by MM_LazySweepScheme
+ */
+class MM_LazySweepCompleteSweepTask : public MM_ParallelSweepTask
+{
+private:
+protected:
+public:
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_LazySweepCompleteSweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_LazySweepScheme *lazySweepScheme) :
+		MM_ParallelSweepTask(env, dispatcher, lazySweepScheme)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+void
+MM_LazySweepCompleteSweepTask::run(MM_EnvironmentBase *env)
+{
+	((MM_LazySweepScheme *)_sweepScheme)->workThreadCompleteSweep(env);
+}
+
+/**
+ * Allocate and initialize a new instance of the receiver.
+ * @return a new instance of the receiver, or NULL on failure.
+ */
+MM_LazySweepScheme *
+MM_LazySweepScheme::newInstance(MM_EnvironmentBase *env)
+{
+	MM_LazySweepScheme *sweepScheme;
+
+	sweepScheme = (MM_LazySweepScheme *)env->getForge()->allocate(sizeof(MM_LazySweepScheme), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (sweepScheme) {
+		new(sweepScheme) MM_LazySweepScheme(env);
+		if (!sweepScheme->initialize(env)) {
+			sweepScheme->kill(env);
+			sweepScheme = NULL;
+		}
+	}
+
+	return sweepScheme;
+}
+
+void *
+MM_LazySweepScheme::createSweepPoolState(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	omrthread_monitor_enter(_mutexSweepPoolState);
+	if (NULL == _poolSweepPoolState) {
+		_poolSweepPoolState = pool_new(sizeof(MM_LazySweepPoolState), 0, 2 * sizeof(uintptr_t), 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(OMRPORTLIB));
+		if (NULL == _poolSweepPoolState) {
+			omrthread_monitor_exit(_mutexSweepPoolState);
+			return NULL;
+		}
+	}
+	omrthread_monitor_exit(_mutexSweepPoolState);
+
+	return MM_LazySweepPoolState::newInstance(env, _poolSweepPoolState, _mutexSweepPoolState, memoryPool);
+}
+
+/**
+ * Assign the heap to chunks and record the first chunk and the total size to be connected for every pool.
+ */
+void
+MM_LazySweepScheme::initializeChunks(MM_EnvironmentBase *env)
+{
+	_totalChunkCount = _sweepHeapSectioning->reassignChunks(env);
+	_connectedChunkCount = 0;
+
+	MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+	for (uintptr_t chunkNum = 0; chunkNum < _totalChunkCount; chunkNum++) {
+		MM_ParallelSweepChunk *chunk = sectioningIterator.nextChunk();
+		MM_LazySweepPoolState *sweepState = (MM_LazySweepPoolState *)getPoolState(chunk->memoryPool);
+
+		if (NULL == sweepState->_connectCurrentChunk) {
+			sweepState->_connectCurrentChunk = chunk;
+		}
+		sweepState->_heapSizeToConnect += chunk->size();
+	}
+
+	_lazySweepActive = (0 != _totalChunkCount);
+}
+
+/**
+ * @return the next chunk (in address order) that belongs to the same pool as the given chunk, or NULL if there is none.
+ */
+MM_ParallelSweepChunk *
+MM_LazySweepScheme::nextChunkInPool(MM_ParallelSweepChunk *chunk)
+{
+	MM_MemoryPool *memoryPool = chunk->memoryPool;
+	MM_ParallelSweepChunk *next = chunk->_next;
+
+	while ((NULL != next) && (memoryPool != next->memoryPool)) {
+		next = next->_next;
+	}
+
+	return next;
+}
+
+/**
+ * @return true if the chunk has already been swept and connected to its pool during the current cycle.
+ */
+bool
+MM_LazySweepScheme::isChunkConnected(MM_ParallelSweepChunk *chunk)
+{
+	MM_LazySweepPoolState *sweepState = (MM_LazySweepPoolState *)getPoolState(chunk->memoryPool);
+	MM_ParallelSweepChunk *connectChunk = sweepState->_connectCurrentChunk;
+
+	return (NULL == connectChunk) || (chunk->chunkBase < connectChunk->chunkBase);
+}
+
+/**
+ * Find the free entries of the pool that surround the next chunk to be connected, and use them as the
+ * previous and next free entries for a round of connections.  Allocation may have consumed or split
+ * entries since the last round, so this must be redone every time the pool lock is taken.
+ * The memory pool hints are also reset so that none point past the connection point.
+ */
+void
+MM_LazySweepScheme::initializeStateForConnections(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedList *memoryPool, MM_LazySweepPoolState *sweepState)
+{
+	bool const compressed = env->compressObjectReferences();
+	MM_HeapLinkedFreeHeader *existingPrevious = NULL;
+	MM_HeapLinkedFreeHeader *existingNext = memoryPool->_heapFreeList;
+	MM_ParallelSweepChunk *chunk = sweepState->_connectCurrentChunk;
+
+	if (NULL != chunk) {
+		while (NULL != existingNext) {
+			if ((void *)existingNext > chunk->chunkBase) {
+				break;
+			}
+			existingPrevious = existingNext;
+			existingNext = existingNext->getNext(compressed);
+		}
+	}
+
+	sweepState->_connectPreviousFreeEntry = existingPrevious;
+	sweepState->_connectPreviousFreeEntrySize = (NULL == existingPrevious) ? 0 : existingPrevious->getSize();
+	sweepState->_connectNextFreeEntry = existingNext;
+	sweepState->_connectNextFreeEntrySize = (NULL == existingNext) ? 0 : existingNext->getSize();
+
+	memoryPool->updateHintsBeyondEntry(existingPrevious);
+}
+
+/**
+ * Reset the per-connection free stats before a chunk is connected.  If nothing on the free list precedes
+ * the chunk, the list is detached so that the first entry connected from the chunk becomes the new head;
+ * postConnectChunk() links the tail back to the entries beyond the chunk.
+ */
+void
+MM_LazySweepScheme::preConnectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk)
+{
+	MM_MemoryPoolAddressOrderedList *memoryPool = (MM_MemoryPoolAddressOrderedList *)chunk->memoryPool;
+	MM_LazySweepPoolState *sweepState = (MM_LazySweepPoolState *)getPoolState(memoryPool);
+
+	Assert_MM_true((void *)sweepState->_connectPreviousFreeEntry < chunk->chunkBase);
+	Assert_MM_true((NULL == sweepState->_connectNextFreeEntry) || ((void *)sweepState->_connectNextFreeEntry >= chunk->chunkTop));
+
+	sweepState->resetFreeStats();
+
+	if (NULL == sweepState->_connectPreviousFreeEntry) {
+		memoryPool->_heapFreeList = NULL;
+	}
+}
+
+/**
+ * Flush the stats of a connection to the memory pool and leave the free list well formed: the last
+ * connected entry gets a valid header and is linked to the entries beyond the connection point.
+ */
+void
+MM_LazySweepScheme::postConnectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk)
+{
+	MM_MemoryPoolAddressOrderedList *memoryPool = (MM_MemoryPoolAddressOrderedList *)chunk->memoryPool;
+	MM_LazySweepPoolState *sweepState = (MM_LazySweepPoolState *)getPoolState(memoryPool);
+
+	sweepState->_heapSizeConnected += chunk->size();
+	sweepState->_freeMemoryConnected += sweepState->_sweepFreeBytes;
+	calculateApproximateFree(env, memoryPool, sweepState);
+
+	memoryPool->setFreeMemorySize(memoryPool->getActualFreeMemorySize() + sweepState->_sweepFreeBytes);
+	memoryPool->setFreeEntryCount(memoryPool->getActualFreeEntryCount() + sweepState->_sweepFreeHoles);
+
+	if (NULL != sweepState->_connectPreviousFreeEntry) {
+		bool const compressed = env->compressObjectReferences();
+		/* An object or dead entry may straddle the top of the chunk while the last free entry ends exactly at
+		 * the top.  Abandon the part in the next chunk so that the heap stays walkable from that chunk's base.
+		 */
+		void *endFreeEntry = (void *)(((uintptr_t)sweepState->_connectPreviousFreeEntry) + sweepState->_connectPreviousFreeEntrySize);
+		if (endFreeEntry == chunk->chunkTop) {
+			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, (omrobjectptr_t)sweepState->_connectPreviousFreeEntry, (omrobjectptr_t)chunk->chunkTop, true);
+			omrobjectptr_t currentObject = NULL;
+
+			while (NULL != (currentObject = objectIterator.nextObjectNoAdvance())) {
+				uintptr_t entrySize = 0;
+				if (objectIterator.isDeadObject()) {
+					entrySize = objectIterator.getDeadObjectSize();
+				} else {
+					entrySize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(currentObject);
+				}
+
+				if (((uintptr_t)currentObject + entrySize) > (uintptr_t)chunk->chunkTop) {
+					entrySize -= (uintptr_t)chunk->chunkTop - (uintptr_t)currentObject;
+					memoryPool->abandonHeapChunk((void *)chunk->chunkTop, (void *)((uintptr_t)chunk->chunkTop + entrySize));
+					break;
+				}
+				objectIterator.advance(entrySize);
+			}
+		}
+
+		memoryPool->createFreeEntry(env,
+			(void *)sweepState->_connectPreviousFreeEntry,
+			(void *)(((uintptr_t)sweepState->_connectPreviousFreeEntry) + sweepState->_connectPreviousFreeEntrySize));
+
+		if (NULL != sweepState->_connectNextFreeEntry) {
+			Assert_MM_true(sweepState->_connectPreviousFreeEntry < sweepState->_connectNextFreeEntry);
+			sweepState->_connectPreviousFreeEntry->setNext(sweepState->_connectNextFreeEntry, compressed);
+		}
+	}
+
+	/* Nothing was connected ahead of the entries beyond the chunk - restore the list head detached by preConnectChunk() */
+	if (NULL == memoryPool->_heapFreeList) {
+		memoryPool->_heapFreeList = sweepState->_connectNextFreeEntry;
+	}
+
+	uintptr_t largestFreeEntry = OMR_MAX(sweepState->_largestFreeEntry, sweepState->_connectPreviousFreeEntrySize);
+	if (largestFreeEntry > memoryPool->getLargestFreeEntry()) {
+		memoryPool->setLargestFreeEntry(largestFreeEntry);
+	}
+
+	assume0(memoryPool->isValidListOrdering());
+}
+
+/**
+ * Estimate the free memory still to be found in the chunks that have not been connected, using the free
+ * ratio seen in earlier cycles, so that heap sizing and allocation failure decisions see a realistic total.
+ */
+void
+MM_LazySweepScheme::calculateApproximateFree(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, MM_LazySweepPoolState *sweepState)
+{
+	Assert_MM_true(sweepState->_heapSizeToConnect >= sweepState->_heapSizeConnected);
+	uintptr_t heapSizeRemainingToBeConnected = sweepState->_heapSizeToConnect - sweepState->_heapSizeConnected;
+	uintptr_t approximateFree = (uintptr_t)(sweepState->_previousFreeRatio * heapSizeRemainingToBeConnected);
+
+	approximateFree = MM_Math::roundToCeiling(sizeof(uintptr_t), approximateFree);
+	if (approximateFree > heapSizeRemainingToBeConnected) {
+		approximateFree = heapSizeRemainingToBeConnected;
+	}
+
+	memoryPool->setApproximateFreeMemorySize(approximateFree);
+}
+
+/**
+ * @copydoc MM_ParallelSweepScheme::connectChunk(MM_EnvironmentBase *, MM_ParallelSweepChunk *)
+ * @note The chunk must be the next chunk to connect for its pool, and must already have been swept.
+ */
+void
+MM_LazySweepScheme::connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk)
+{
+	MM_MemoryPool *memoryPool = chunk->memoryPool;
+	MM_LazySweepPoolState *sweepState = (MM_LazySweepPoolState *)getPoolState(memoryPool);
+
+	Assert_MM_true(chunk == sweepState->_connectCurrentChunk);
+
+	preConnectChunk(env, chunk);
+	MM_ParallelSweepScheme::connectChunk(env, chunk);
+
+	sweepState->_connectCurrentChunk = nextChunkInPool(chunk);
+	if (NULL == sweepState->_connectCurrentChunk) {
+		flushFinalChunk(env, memoryPool);
+	}
+
+	postConnectChunk(env, chunk);
+	_connectedChunkCount += 1;
+
+	if (NULL == sweepState->_connectCurrentChunk) {
+		/* Last chunk for this pool - the cycle is over once every other pool is done as well */
+		bool allPoolsConnected = true;
+		MM_MemoryPool *pool = NULL;
+		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+		while (NULL != (pool = poolIterator.nextPool())) {
+			MM_LazySweepPoolState *poolState = (MM_LazySweepPoolState *)getPoolState(pool);
+			if ((NULL != poolState) && (NULL != poolState->_connectCurrentChunk)) {
+				allPoolsConnected = false;
+				break;
+			}
+		}
+		if (allPoolsConnected) {
+			_lazySweepActive = false;
+		}
+	}
+}
+
+/**
+ * Sweep a single chunk outside of a parallel task, on behalf of an allocating thread.
+ */
+void
+MM_LazySweepScheme::sweepChunkForConnection(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk)
+{
+	MM_MemoryPool *topLevelMemoryPool = chunk->memoryPool->getParent();
+	if (NULL == topLevelMemoryPool) {
+		topLevelMemoryPool = chunk->memoryPool;
+	}
+
+	env->_freeEntrySizeClassStats.resetCounts();
+	env->_freeEntrySizeClassStats.initializeFrequentAllocation(topLevelMemoryPool->getLargeObjectAllocateStats());
+
+	sweepChunk(env, chunk);
+
+	chunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+}
+
+/**
+ * Sweep, in parallel, every chunk that has not been connected, then connect them in address order.
+ * @note Expects to have exclusive access and control over the parallel GC threads.
+ */
+void
+MM_LazySweepScheme::sweepAndConnectRemainingChunks(MM_EnvironmentBase *env)
+{
+	MM_LazySweepCompleteSweepTask completeSweepTask(env, _dispatcher, this);
+	_dispatcher->run(env, &completeSweepTask);
+
+	MM_MemoryPool *memoryPool = NULL;
+	MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+	while (NULL != (memoryPool = poolIterator.nextPool())) {
+		MM_LazySweepPoolState *sweepState = (MM_LazySweepPoolState *)getPoolState(memoryPool);
+		if ((NULL != sweepState) && (NULL != sweepState->_connectCurrentChunk)) {
+			initializeStateForConnections(env, (MM_MemoryPoolAddressOrderedList *)memoryPool, sweepState);
+			while (NULL != sweepState->_connectCurrentChunk) {
+				connectChunk(env, sweepState->_connectCurrentChunk);
+			}
+		}
+	}
+
+	_lazySweepActive = false;
+}
+
+/**
+ * Sweep all chunks that have not been connected.  Task entry point for all GC threads; does not connect chunks.
+ * @note Do not call directly as this is the entry point for the dispatched task
+ */
+void
+MM_LazySweepScheme::workThreadCompleteSweep(MM_EnvironmentBase *env)
+{
+	MM_ParallelSweepChunk *prevChunk = NULL;
+	MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+
+	for (uintptr_t chunkNum = 0; chunkNum < _totalChunkCount; chunkNum++) {
+		MM_ParallelSweepChunk *chunk = sectioningIterator.nextChunk();
+		Assert_MM_true(NULL != chunk);
+
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			if (isChunkConnected(chunk)) {
+				continue;
+			}
+
+			if ((NULL != prevChunk) && (prevChunk->memoryPool != chunk->memoryPool)) {
+				prevChunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+			}
+			if ((NULL == prevChunk) || (prevChunk->memoryPool != chunk->memoryPool)) {
+				MM_MemoryPool *topLevelMemoryPool = chunk->memoryPool->getParent();
+				if (NULL == topLevelMemoryPool) {
+					topLevelMemoryPool = chunk->memoryPool;
+				}
+				env->_freeEntrySizeClassStats.initializeFrequentAllocation(topLevelMemoryPool->getLargeObjectAllocateStats());
+			}
+
+			sweepChunk(env, chunk);
+			prevChunk = chunk;
+		}
+	}
+
+	if (NULL != prevChunk) {
+		prevChunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+}
+
+/**
+ * Record in the global sweep stats how many chunks of the cycle are still left for allocation to sweep.
+ * @note called by the main thread only, at the end of the sweep phase of a collection
+ */
+void
+MM_LazySweepScheme::updateSweepStats(MM_EnvironmentBase *env)
+{
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	sweepStats->_lazySweepChunks = _totalChunkCount;
+	sweepStats->_lazySweepChunksDeferred = _totalChunkCount - _connectedChunkCount;
+}
+
+/**
+ * Initialize sweep states and chunk assignments for a new cycle.
+ * @note called by the main thread only
+ */
+void
+MM_LazySweepScheme::setupForSweep(MM_EnvironmentBase *env)
+{
+	MM_ParallelSweepScheme::setupForSweep(env);
+
+	_extensions->heap->resetLargestFreeEntry();
+
+	initializeSweepStates(env);
+	initializeChunks(env);
+}
+
+/**
+ * Perform a full sweep of the heap.
+ */
+void
+MM_LazySweepScheme::sweep(MM_EnvironmentBase *env)
+{
+	setupForSweep(env);
+	sweepAndConnectRemainingChunks(env);
+	updateSweepStats(env);
+}
+
+/**
+ * Sweep and connect every chunk still outstanding from the last cycle.
+ * @note Expects to have exclusive access and control over the parallel GC threads.
+ */
+void
+MM_LazySweepScheme::completeSweep(MM_EnvironmentBase *env, SweepCompletionReason reason)
+{
+	if (!_lazySweepActive) {
+		return;
+	}
+
+	if (ABOUT_TO_GC == reason) {
+		_extensions->globalGCStats.sweepStats.clear();
+	}
+
+	sweepAndConnectRemainingChunks(env);
+
+	if (ABOUT_TO_GC != reason) {
+		updateSweepStats(env);
+	}
+}
+
+/**
+ * Sweep only as much of the heap as is needed to satisfy the allocation that triggered the collection,
+ * leaving the rest to be swept on demand by replenishPoolForAllocate().  Cycles with no free ratio history
+ * to estimate the unswept memory are swept in full.
+ * @return true if a free entry of at least the requested size was found, false otherwise.
+ */
+bool
+MM_LazySweepScheme::sweepForMinimumSize(MM_EnvironmentBase *env, MM_MemorySubSpace *baseMemorySubSpace, MM_AllocateDescription *allocateDescription)
+{
+	setupForSweep(env);
+
+	bool hasFreeRatioHistory = true;
+	MM_MemoryPool *memoryPool = NULL;
+	MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+	while (NULL != (memoryPool = poolIterator.nextPool())) {
+		MM_LazySweepPoolState *sweepState = (MM_LazySweepPoolState *)getPoolState(memoryPool);
+		if (NULL != sweepState) {
+			if (!sweepState->hasFreeRatioHistory()) {
+				hasFreeRatioHistory = false;
+				break;
+			}
+			calculateApproximateFree(env, memoryPool, sweepState);
+		}
+	}
+
+	if (!hasFreeRatioHistory) {
+		sweepAndConnectRemainingChunks(env);
+	} else if (NULL != allocateDescription) {
+		uintptr_t minimumFreeSize = allocateDescription->getBytesRequested();
+		MM_MemoryPool *subSpacePool = NULL;
+		MM_MemorySubSpacePoolIterator subSpacePoolIterator(baseMemorySubSpace);
+		while (NULL != (subSpacePool = subSpacePoolIterator.nextPool())) {
+			if (replenishPoolForAllocate(env, subSpacePool, minimumFreeSize)) {
+				break;
+			}
+		}
+	}
+
+	updateSweepStats(env);
+
+	if (NULL != allocateDescription) {
+		uintptr_t minimumFreeSize = allocateDescription->getBytesRequested();
+		return minimumFreeSize <= baseMemorySubSpace->findLargestFreeEntry(env, allocateDescription);
+	} else {
+		return true;
+	}
+}
+
+/**
+ * @copydoc MM_ParallelSweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *, MM_MemoryPool *, uintptr_t)
+ *
+ * Sweeps and connects the pool's remaining chunks in address order until one yields a free entry that can
+ * satisfy the request or there are none left.
+ */
+bool
+MM_LazySweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	if (!_lazySweepActive) {
+		return false;
+	}
+
+	MM_LazySweepPoolState *sweepState = (MM_LazySweepPoolState *)getPoolState(memoryPool);
+	if ((NULL == sweepState) || (NULL == sweepState->_connectCurrentChunk)) {
+		return false;
+	}
+
+	initializeStateForConnections(env, (MM_MemoryPoolAddressOrderedList *)memoryPool, sweepState);
+
+	while (NULL != sweepState->_connectCurrentChunk) {
+		MM_ParallelSweepChunk *chunk = sweepState->_connectCurrentChunk;
+		sweepChunkForConnection(env, chunk);
+		connectChunk(env, chunk);
+
+		if ((sweepState->_largestFreeEntry >= size) || (sweepState->_connectPreviousFreeEntrySize >= size)) {
+			return true;
+		}
+	}
+
+	return false;
+}
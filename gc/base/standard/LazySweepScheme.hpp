@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(LAZYSWEEPSCHEME_HPP_)
+#define LAZYSWEEPSCHEME_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "ParallelSweepScheme.hpp"
+
+class MM_AllocateDescription;
+class MM_LazySweepCompleteSweepTask;
+class MM_LazySweepPoolState;
+class MM_MemoryPool;
+class MM_MemoryPoolAddressOrderedList;
+class MM_MemorySubSpace;
+class MM_ParallelSweepChunk;
+
+/**
+ * Sweep scheme that ends the global collection once enough of the heap has been swept to satisfy
+ * the allocation that triggered it.  The remaining chunks are swept and connected in address order
+ * by the allocating thread whenever a pool runs out of free entries, and any chunks still pending
+ * are completed in parallel before the mark map is next reused.
+ *
+ * Free memory that has not been connected yet is estimated from the ratio of free to swept memory
+ * seen in earlier cycles; the first cycle is always swept in full to seed the estimate.
+ *
+ * @note Only supports configurations where each address range of the heap belongs to a single
+ * address ordered list pool (no scavenger, no LOA, no split free lists, no concurrent mark or sweep).
+ * @ingroup GC_Modron_Standard
+ */
+class MM_LazySweepScheme : public MM_ParallelSweepScheme
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _totalChunkCount;  /**< Number of chunks assigned to the heap for the current cycle */
+	uintptr_t _connectedChunkCount;  /**< Number of chunks from the current cycle that have been connected */
+	volatile bool _lazySweepActive;  /**< Set while there are chunks from the current cycle that have not been connected */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	void initializeChunks(MM_EnvironmentBase *env);
+	MM_ParallelSweepChunk *nextChunkInPool(MM_ParallelSweepChunk *chunk);
+	bool isChunkConnected(MM_ParallelSweepChunk *chunk);
+
+	void initializeStateForConnections(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedList *memoryPool, MM_LazySweepPoolState *sweepState);
+	void preConnectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
+	void postConnectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
+	void calculateApproximateFree(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, MM_LazySweepPoolState *sweepState);
+
+	void sweepChunkForConnection(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
+	void sweepAndConnectRemainingChunks(MM_EnvironmentBase *env);
+	void workThreadCompleteSweep(MM_EnvironmentBase *env);
+	void updateSweepStats(MM_EnvironmentBase *env);
+
+protected:
+	virtual void setupForSweep(MM_EnvironmentBase *env);
+	virtual void connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
+
+public:
+	static MM_LazySweepScheme *newInstance(MM_EnvironmentBase *env);
+
+	/**
+ 	* Request to create sweepPoolState class for pool
+ 	* @param  memoryPool memory pool to attach sweep state to
+ 	* @return pointer to created class
+ 	*/
+	virtual void *createSweepPoolState(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool);
+
+	virtual void sweep(MM_EnvironmentBase *env);
+	virtual void completeSweep(MM_EnvironmentBase *env, SweepCompletionReason reason);
+	virtual bool sweepForMinimumSize(MM_EnvironmentBase *env, MM_MemorySubSpace *baseMemorySubSpace, MM_AllocateDescription *allocateDescription);
+
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+
+	/**
+	 * @return true if every chunk from the last sweep has been connected to its pool.
+	 */
+	virtual bool isSweepCompleted(MM_EnvironmentBase *env) { return !_lazySweepActive; }
+
+	/**
+	 * Create a LazySweepScheme object.
+	 */
+	MM_LazySweepScheme(MM_EnvironmentBase *env)
+		: MM_ParallelSweepScheme(env)
+		, _totalChunkCount(0)
+		, _connectedChunkCount(0)
+		, _lazySweepActive(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	/*
+	 * Friends
+	 */
+	friend class MM_LazySweepCompleteSweepTask;
+};
+
+#endif /* LAZYSWEEPSCHEME_HPP_ */
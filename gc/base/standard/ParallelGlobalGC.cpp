@@ -44,6 +44,7 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
 #include "MarkingScheme.hpp"
+#include "Math.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
@@ -401,6 +402,10 @@ MM_ParallelGlobalGC::cleanupAfterGC(MM_EnvironmentBase *env, MM_AllocateDescript
 	/* Heap size now fixed for next cycle so reset heap statistics */
 	_extensions->heap->resetHeapStatistics(true);
 
+	if (_extensions->releaseFreePagesAfterGlobalGC) {
+		releaseIdleFreeMemoryPages(env);
+	}
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	GC_OMRVMThreadListIterator threadIterator(_extensions->getOmrVM());
 	OMR_VMThread *walkThread = NULL;
@@ -418,6 +423,52 @@ MM_ParallelGlobalGC::cleanupAfterGC(MM_EnvironmentBase *env, MM_AllocateDescript
 #endif /* OMR_GC_MODRON_SCAVENGER */
 }
 
+void
+MM_ParallelGlobalGC::releaseIdleFreeMemoryPages(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_MemorySubSpace *tenureMemorySubSpace = _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+	uintptr_t freeBytes = tenureMemorySubSpace->getApproximateActiveFreeMemorySize();
+	uintptr_t pageSize = _extensions->heap->getPageSize();
+	uintptr_t granule = MM_Math::roundToCeiling(pageSize, OMR_MAX(pageSize, _extensions->releaseFreePagesGranule));
+
+	/* The free memory left after the previous global GC (not yet updated for this one) was enough to
+	 * run the application until now, so keep that much committed, or the -Xgc:decommitMinimumFree share if larger.
+	 * There is no such history on the first global GC.
+	 */
+	uintptr_t lastFreeBytes = _extensions->getLastGlobalGCFreeBytes();
+	uintptr_t retainBytes = OMR_MAX(lastFreeBytes, freeBytes / 100 * _extensions->decommitMinimumFree);
+	if ((0 == lastFreeBytes) || (freeBytes <= (retainBytes + granule))) {
+		return;
+	}
+
+	uint64_t startTime = omrtime_hires_clock();
+	uintptr_t releasedBytes = tenureMemorySubSpace->getMemoryPool()->releaseIdleFreeMemoryPages(env, granule, &retainBytes);
+	uint64_t endTime = omrtime_hires_clock();
+
+	uint64_t residentBytes = 0;
+	omrvmem_get_process_memory_size(OMRPORT_VMEM_PROCESS_PHYSICAL, &residentBytes);
+	_extensions->heap->getResizeStats()->setReleasedFreePages(releasedBytes, _extensions->heap->getActiveMemorySize(), residentBytes);
+
+	if (0 != releasedBytes) {
+		TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+			_extensions->privateHookInterface,
+			env->getOmrVMThread(),
+			endTime,
+			J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+			HEAP_RELEASE_FREE_PAGES,
+			tenureMemorySubSpace->getTypeFlags(),
+			/* GC Time Ratio not applicable for "release free heap pages" */
+			0,
+			releasedBytes,
+			tenureMemorySubSpace->getActiveMemorySize(),
+			omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			/* reason not applicable */
+			1
+			);
+	}
+}
+
 void
 MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap, bool rebuildMarkBits)
 {
@@ -721,7 +772,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -758,7 +809,12 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		}
 	}
 
-	
+	/* Carry on where the last incremental compaction ran out of budget */
+	if ((NULL != _compactScheme) && _compactScheme->isIncrementalCompactionIncomplete()) {
+		compactReason = COMPACT_INCREMENTAL;
+		goto compactionReqd;
+	}
+
 nocompact:	
 	/* Compaction not required or prevented from running */
 	_extensions->globalGCStats.compactStats._compactReason = compactReason;
@@ -1044,6 +1100,11 @@ MM_ParallelGlobalGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	env->_cycleState->_activeSubSpace = subSpace;
 	env->_cycleState->_collectionStatistics = &_collectionStatistics;
 
+	/* Finish any sweep work left over from the previous cycle before the mark map is rebuilt */
+	if (!_sweepScheme->isSweepCompleted(env)) {
+		_sweepScheme->completeSweep(env, ABOUT_TO_GC);
+	}
+
 	/* If we are in an excessiveGC level beyond normal then an aggressive GC is
 	 * conducted to free up as much space as possible
 	 */
@@ -1095,6 +1156,9 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 	reportGCEnd(env);
 	reportGCCycleEnd(env);
 
+	/* Walks made up to here (e.g. from the cycle end hook) may rely on the mark map for the live set, see
+	 * MM_ParallelHeapWalker::allMarkedObjectsDo(); once the mutators run they allocate unmarked objects.
+	 */
 	_markingScheme->getMarkMap()->setMarkMapValid(false);
 
 #if defined(OMR_GC_OBJECT_MAP)
@@ -1245,6 +1309,11 @@ MM_ParallelGlobalGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySu
 void
 MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 {
+	/* The walk mark below overwrites the mark map that an unfinished lazy sweep still depends on */
+	if (!_sweepScheme->isSweepCompleted(env)) {
+		_sweepScheme->completeSweep(env, ABOUT_TO_GC);
+	}
+
 	GC_OMRVMInterface::flushCachesForGC(env);
 
 	_markingScheme->mainSetupForWalk(env);
@@ -1389,6 +1458,18 @@ MM_ParallelGlobalGC::getGCTimePercentage(MM_EnvironmentBase *env)
 	return ratio;
 }
 
+/**
+ * Replenish a pools free lists to satisfy a given allocate.
+ * The request is forwarded to the sweep scheme, which may still have chunks left to sweep from the last cycle.
+ * @note This call is made under the pools allocation lock (or equivalent)
+ * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
+ */
+bool
+MM_ParallelGlobalGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+}
+
 static void
 globalGCHookSysStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
 {
@@ -34,6 +34,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "LazySweepScheme.hpp"
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
 #include "ParallelHeapWalker.hpp"
@@ -187,6 +188,12 @@ private:
 	 * redistribute free memory in tenure after global collection (move free memory from LOA to SOA)
 	 */
 	void tenureMemoryPoolPostCollect(MM_EnvironmentBase *env);
+
+	/**
+	 * Decommit the tenure free memory that the application is not expected to allocate before the next
+	 * global collection, as predicted by the free memory it consumed since the previous one (-Xgc:releaseFreePagesAfterGC).
+	 */
+	void releaseIdleFreeMemoryPages(MM_EnvironmentBase *env);
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
@@ -258,7 +265,9 @@ protected:
 			sweepScheme = MM_ConcurrentSweepScheme::newInstance(env, globalCollector);
 		} else
 #endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
-		{
+		if(_extensions->lazySweep) {
+			sweepScheme = MM_LazySweepScheme::newInstance(env);
+		} else {
 			sweepScheme = MM_ParallelSweepScheme::newInstance(env);
 		}
 
@@ -293,6 +302,8 @@ public:
 
 	virtual	uint32_t getGCTimePercentage(MM_EnvironmentBase *env);
 
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+
 	/**
  	* Request to create sweepPoolState class for pool
  	* @param  memoryPool memory pool to attach sweep state to
@@ -41,7 +41,7 @@ MM_ParallelScavengeTask::run(MM_EnvironmentBase *envBase)
 void
 MM_ParallelScavengeTask::mainSetup(MM_EnvironmentBase *env)
 {
-	uintptr_t calculatedAliasThreshold = (uintptr_t)(getThreadCount() * env->getExtensions()->aliasInhibitingThresholdPercentage);
+	uintptr_t calculatedAliasThreshold = (uintptr_t)(getThreadCount() * _collector->getAliasInhibitingThresholdPercentage());
 	_collector->setAliasThreshold(calculatedAliasThreshold);
 }
 
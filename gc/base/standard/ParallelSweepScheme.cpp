@@ -191,6 +191,8 @@ MM_ParallelSweepScheme::initialize(MM_EnvironmentBase *env)
 	}
 	_sweepHeapSectioning = extensions->sweepHeapSectioning;
 
+	_findNonEmptySlot = MM_MarkMapScanner::selectFindNonEmptySlot(env);
+
 	if (0 != omrthread_monitor_init_with_name(&_mutexSweepPoolState, 0, "SweepPoolState Monitor")) {
 		return false;
 	}
@@ -341,14 +343,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = _findNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -857,7 +852,6 @@ MM_ParallelSweepScheme::sweepForMinimumSize(
 	}	
 }
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Replenish a pools free lists to satisfy a given allocate.
  * The given pool was unable to satisfy an allocation request of (at least) the given size.  See if there is work
@@ -871,7 +865,6 @@ MM_ParallelSweepScheme::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_Mem
 {
 	return false;
 }
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 void
 MM_ParallelSweepScheme::setMarkMap(MM_MarkMap *markMap)
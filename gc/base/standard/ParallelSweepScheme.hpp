@@ -37,6 +37,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "MarkMapScanner.hpp"
 #include "MemoryPool.hpp"
 #include "ParallelTask.hpp"
 
@@ -106,6 +107,7 @@ protected:
 	void *_heapBase;
 
 	MM_SweepHeapSectioning *_sweepHeapSectioning;	/**< pointer to Sweep Heap Sectioning */
+	MM_MarkMapScanner::FindNonEmptySlotFunction _findNonEmptySlot;	/**< Scanner used to skip runs of empty mark map slots, selected for the processor at startup */
 
 	J9Pool *_poolSweepPoolState;				/**< Memory pools for SweepPoolState*/ 
 	omrthread_monitor_t _mutexSweepPoolState;	/**< Monitor to protect memory pool operations for sweepPoolState*/
@@ -189,9 +191,7 @@ public:
 	 */
 	void heapReconfigured(MM_EnvironmentBase *env);
 
-#if defined(OMR_GC_CONCURRENT_SWEEP)
 	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
-#endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	/**
 	 * Accurately measure the dark matter within the mark map uintptr_t beginning at heapSlotFreeCurrent.
@@ -223,6 +223,7 @@ public:
 		, _currentSweepBits(NULL)
 		, _heapBase(NULL)
 		, _sweepHeapSectioning(NULL)
+		, _findNonEmptySlot(MM_MarkMapScanner::findNonEmptySlotScalar)
 		, _poolSweepPoolState(NULL)
 		, _mutexSweepPoolState(0)
 	{
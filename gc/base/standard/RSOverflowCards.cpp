@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "RSOverflowCards.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+
+MM_RSOverflowCards *
+MM_RSOverflowCards::newInstance(MM_EnvironmentBase *env)
+{
+	MM_RSOverflowCards *cards = (MM_RSOverflowCards *)env->getForge()->allocate(sizeof(MM_RSOverflowCards), OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL != cards) {
+		new(cards) MM_RSOverflowCards(env);
+		if (!cards->initialize(env)) {
+			cards->kill(env);
+			cards = NULL;
+		}
+	}
+	return cards;
+}
+
+void
+MM_RSOverflowCards::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_RSOverflowCards::initialize(MM_EnvironmentBase *env)
+{
+	MM_Heap *heap = env->getExtensions()->heap;
+	_heapBase = (uintptr_t)heap->getHeapBase();
+	_heapTop = (uintptr_t)heap->getHeapTop();
+	_cardCount = ((_heapTop - _heapBase) + RSOVERFLOW_CARD_SIZE - 1) >> RSOVERFLOW_CARD_SIZE_SHIFT;
+
+	_cards = (uint32_t *)env->getForge()->allocate(_cardCount * sizeof(uint32_t), OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _cards) {
+		return false;
+	}
+	clear();
+
+	return true;
+}
+
+void
+MM_RSOverflowCards::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _cards) {
+		env->getForge()->free(_cards);
+		_cards = NULL;
+	}
+}
+
+void
+MM_RSOverflowCards::clear()
+{
+	memset(_cards, 0, _cardCount * sizeof(uint32_t));
+	_isDirty = false;
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(RSOVERFLOWCARDS_HPP_)
+#define RSOVERFLOWCARDS_HPP_
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+#define RSOVERFLOW_CARD_SIZE_SHIFT 12
+#define RSOVERFLOW_CARD_SIZE ((uintptr_t)1 << RSOVERFLOW_CARD_SIZE_SHIFT)
+#define RSOVERFLOW_CARD_CLEAN ((uint32_t)0)
+
+/**
+ * Coarse card table recording the location of remembered objects once the remembered set has overflowed.
+ * Each card holds the offset (biased by one) of the lowest remembered object starting within it, so an
+ * overflowed remembered set can be recovered by walking only the dirty cards instead of the whole tenure space.
+ */
+class MM_RSOverflowCards : public MM_BaseVirtual
+{
+public:
+protected:
+private:
+	uint32_t *_cards; /**< One entry per card, RSOVERFLOW_CARD_CLEAN or the biased offset of the first remembered object */
+	uintptr_t _cardCount; /**< Number of cards in the table */
+	uintptr_t _heapBase; /**< Lowest address covered by the table */
+	uintptr_t _heapTop; /**< Address just past the highest address covered by the table */
+	volatile bool _isDirty; /**< True if any card has been dirtied since the last call to clearDirty() */
+
+public:
+	static MM_RSOverflowCards *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record a remembered object on the card containing it.
+	 * Thread safe, may be called concurrently by any number of GC threads.
+	 * @param objectPtr address of a remembered tenured object
+	 */
+	MMINLINE void rememberObject(omrobjectptr_t objectPtr)
+	{
+		uintptr_t address = (uintptr_t)objectPtr;
+		Assert_MM_true((address >= _heapBase) && (address < _heapTop));
+		uintptr_t offset = address - _heapBase;
+		volatile uint32_t *card = (volatile uint32_t *)&_cards[offset >> RSOVERFLOW_CARD_SIZE_SHIFT];
+		uint32_t newValue = (uint32_t)(offset & (RSOVERFLOW_CARD_SIZE - 1)) + 1;
+		uint32_t oldValue = *card;
+		while ((RSOVERFLOW_CARD_CLEAN == oldValue) || (newValue < oldValue)) {
+			uint32_t value = MM_AtomicOperations::lockCompareExchangeU32(card, oldValue, newValue);
+			if (value == oldValue) {
+				break;
+			}
+			oldValue = value;
+		}
+		if (!_isDirty) {
+			_isDirty = true;
+		}
+	}
+
+	/**
+	 * @return the number of cards in the table
+	 */
+	MMINLINE uintptr_t getCardCount() { return _cardCount; }
+
+	/**
+	 * @return true if any card has been dirtied since the last call to clearDirty()
+	 */
+	MMINLINE bool isDirty() { return _isDirty; }
+
+	/**
+	 * Forget that cards have been dirtied, the cards themselves are not modified.
+	 */
+	MMINLINE void clearDirty() { _isDirty = false; }
+
+	/**
+	 * @param cardIndex index of the card
+	 * @return the lowest remembered object recorded on the card, or NULL if the card is clean
+	 */
+	MMINLINE omrobjectptr_t getFirstObject(uintptr_t cardIndex)
+	{
+		return toObject(cardIndex, _cards[cardIndex]);
+	}
+
+	/**
+	 * Clean a card. Not thread safe with respect to other operations on the same card.
+	 * @param cardIndex index of the card
+	 * @return the lowest remembered object recorded on the card before it was cleaned, or NULL if it was clean
+	 */
+	MMINLINE omrobjectptr_t cleanCard(uintptr_t cardIndex)
+	{
+		uint32_t value = _cards[cardIndex];
+		_cards[cardIndex] = RSOVERFLOW_CARD_CLEAN;
+		return toObject(cardIndex, value);
+	}
+
+	/**
+	 * @param cardIndex index of the card
+	 * @return the address just past the end of the card
+	 */
+	MMINLINE void *getCardTop(uintptr_t cardIndex)
+	{
+		return (void *)OMR_MIN(_heapBase + ((cardIndex + 1) << RSOVERFLOW_CARD_SIZE_SHIFT), _heapTop);
+	}
+
+	/**
+	 * Clean all cards and the dirty flag.
+	 */
+	void clear();
+
+	/**
+	 * Construct a new MM_RSOverflowCards
+	 */
+	MM_RSOverflowCards(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _cards(NULL)
+		, _cardCount(0)
+		, _heapBase(0)
+		, _heapTop(0)
+		, _isDirty(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	MMINLINE omrobjectptr_t toObject(uintptr_t cardIndex, uint32_t value)
+	{
+		omrobjectptr_t objectPtr = NULL;
+		if (RSOVERFLOW_CARD_CLEAN != value) {
+			objectPtr = (omrobjectptr_t)(_heapBase + (cardIndex << RSOVERFLOW_CARD_SIZE_SHIFT) + (uintptr_t)(value - 1));
+		}
+		return objectPtr;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* RSOVERFLOWCARDS_HPP_ */
@@ -25,7 +25,9 @@
 
 #if defined(OMR_GC_REALTIME)
 
+#include "AtomicOperations.hpp"
 #include "Debug.hpp"
+#include "MarkingScheme.hpp"
 #include "RememberedSetSATB.hpp"
 #include "WorkPackets.hpp"
 
@@ -38,15 +40,16 @@
  * Create a new instance the MM_RememberedSetSATB class
  *
  * @param workPackets The workPackets
+ * @param markingScheme The marking scheme whose mark map filters published fragments
  */
 MM_RememberedSetSATB *
-MM_RememberedSetSATB::newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets)
+MM_RememberedSetSATB::newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets, MM_MarkingScheme *markingScheme)
 {
 	MM_RememberedSetSATB *rememberedSet;
 
-	rememberedSet = (MM_RememberedSetSATB *)env->getForge()->allocate(sizeof(MM_RememberedSetSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	rememberedSet = (MM_RememberedSetSATB *)env->getForge()->allocate(sizeof(MM_RememberedSetSATB), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
 	if (NULL != rememberedSet) {
-		new(rememberedSet) MM_RememberedSetSATB(env, workPackets);
+		new(rememberedSet) MM_RememberedSetSATB(env, workPackets, markingScheme);
 		if (!rememberedSet->initialize(env)) {
 			rememberedSet->kill(env);
 			rememberedSet = NULL;
@@ -280,6 +283,9 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 	MM_Packet *oldPacket = (MM_Packet *)fragment->fragmentStorage;
 
 	if ((NULL != oldPacket) && (getLocalFragmentIndex(env, fragment) == getGlobalFragmentIndex(env)) && (*fragment->fragmentTop == *fragment->fragmentAlloc)) {
+		MM_AtomicOperations::add(&_publishedEntries, _workPackets->getBarrierPacketEntries(env, oldPacket));
+		/* The whole fragment is filtered in one pass as it is published, rather than each entry as it is traced */
+		_workPackets->filterBarrierPacket(env, oldPacket, _markingScheme);
 		_workPackets->removePacketFromInUseList(env, oldPacket);
 		_workPackets->putFullPacket(env, oldPacket);
 	}
@@ -292,6 +298,7 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
     fragment->fragmentParent = &_rememberedSetStruct;
 
 	if (NULL != packet) {
+		_workPackets->limitBarrierPacket(env, packet, _fragmentSlots);
 		fragment->fragmentAlloc = packet->getCurrentAddr(env);
 		fragment->fragmentTop = packet->getTopAddr(env);
 		fragment->fragmentStorage = (void *)packet;
@@ -308,4 +315,30 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 	return result;
 }
 
+/**
+ * Tune the fragment size from where the barrier entries of the concurrent phase ended up.
+ * Entries still held in fragments at the end of concurrent tracing were never visible to the
+ * concurrent markers, and are traced in the final collection instead.  When they are a large
+ * share of all the entries, the threads hitting the barrier fill their fragments slowly, so
+ * fragments are shrunk to publish entries sooner.  When almost all entries were published,
+ * fragments are grown back towards a full packet to refresh less often.  Must be called at the end of
+ * every concurrent tracing, even with no entries left in fragments, so that each decision only counts the
+ * entries published since the previous one.
+ * @param unpublishedEntries The entries moved out of the in use packets at the end of concurrent tracing.
+ */
+void
+MM_RememberedSetSATB::tuneFragmentSlots(MM_EnvironmentBase *env, UDATA unpublishedEntries)
+{
+	UDATA totalEntries = _publishedEntries + unpublishedEntries;
+	_publishedEntries = 0;
+
+	if (0 < totalEntries) {
+		if (unpublishedEntries > (totalEntries / 4)) {
+			_fragmentSlots = OMR_MAX(_fragmentSlots / 2, (UDATA)SATB_FRAGMENT_MINIMUM_SLOTS);
+		} else if (unpublishedEntries < (totalEntries / 16)) {
+			_fragmentSlots = OMR_MIN(_fragmentSlots * 2, MM_WorkPackets::getSlotsInPacket());
+		}
+	}
+}
+
 #endif /* defined(OMR_GC_REALTIME) */
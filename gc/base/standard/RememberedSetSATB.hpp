@@ -29,7 +29,11 @@
 #include "WorkPacketsSATB.hpp"
 #include "BaseNonVirtual.hpp"
 
+/* Smallest fragment handed to a thread when fragments are shrunk to publish barrier entries sooner */
+#define SATB_FRAGMENT_MINIMUM_SLOTS 32
+
 class EnvironmentModron;
+class MM_MarkingScheme;
 
 class MM_RememberedSetSATB : public MM_BaseNonVirtual
 {
@@ -39,16 +43,22 @@ public:
 protected:
 private:
 	MM_WorkPacketsSATB *_workPackets; /**< The workPackets struct used as backing store for the rememberedSet */
+	MM_MarkingScheme *_markingScheme; /**< Marking scheme whose mark map filters the entries of published fragments */
+	volatile uintptr_t _fragmentSlots; /**< Number of packet slots handed to a fragment on refresh, tuned by tuneFragmentSlots() */
+	volatile uintptr_t _publishedEntries; /**< Entries in fragments that filled up and were handed to marking since the last tuning */
 
 /* Methods */
 public:
 	/* Constructors & destructors */
-	static MM_RememberedSetSATB *newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets);
+	static MM_RememberedSetSATB *newInstance(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets, MM_MarkingScheme *markingScheme);
 	void kill(MM_EnvironmentBase *env);
 
-	MM_RememberedSetSATB(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets) :
+	MM_RememberedSetSATB(MM_EnvironmentBase *env, MM_WorkPacketsSATB *workPackets, MM_MarkingScheme *markingScheme) :
 		MM_BaseNonVirtual(),
-		_workPackets(workPackets)
+		_workPackets(workPackets),
+		_markingScheme(markingScheme),
+		_fragmentSlots(MM_WorkPackets::getSlotsInPacket()),
+		_publishedEntries(0)
 	{
 		_typeId = __FUNCTION__;
 		/* Initializing the global fragment index to the reserved index means the GC starts
@@ -77,6 +87,8 @@ public:
 	}
 	void flushFragments(MM_EnvironmentBase* env); /* Ensures all fragments will be seen as invalid next time they are accessed. */
 	bool refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSetFragment* fragment);
+	void tuneFragmentSlots(MM_EnvironmentBase *env, UDATA unpublishedEntries); /* Called at the end of every concurrent tracing with the entries still held in fragments. */
+	MMINLINE UDATA getFragmentSlots() { return _fragmentSlots; }
 
 protected:
 	bool initialize(MM_EnvironmentBase *env);
@@ -77,6 +77,7 @@
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
 #include "RSOverflow.hpp"
+#include "RSOverflowCards.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
 #include "ScavengerRootScanner.hpp"
@@ -108,6 +109,9 @@
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
+/* If hot field co-location is enabled, sample the child copies of every HOT_FIELD_SAMPLE_INTERVAL'th object scanned by each thread */
+#define HOT_FIELD_SAMPLE_INTERVAL 16
+
 /* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
  * a quick implementation
  */
@@ -224,6 +228,9 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	/* initialize the global scavenger gcCount */
 	_extensions->scavengerStats._gcCount = 0;
 
+	_cacheSizingModel.initialize(_extensions->scavengerScanCacheMinimumSize, _extensions->scavengerScanCacheMaximumSize,
+			_extensions->aliasInhibitingThresholdPercentage, _extensions->getObjectAlignmentInBytes());
+
 	if (!_scavengeCacheFreeList.initialize(env, NULL)) {
 		return false;
 	}
@@ -296,6 +303,13 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->scavengerRememberedSetOverflowCards && !_extensions->isConcurrentScavengerEnabled()) {
+		_rememberedSetOverflowCards = MM_RSOverflowCards::newInstance(env);
+		if (NULL == _rememberedSetOverflowCards) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -304,6 +318,11 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
 	_delegate.tearDown(env);
 
+	if (NULL != _rememberedSetOverflowCards) {
+		_rememberedSetOverflowCards->kill(env);
+		_rememberedSetOverflowCards = NULL;
+	}
+
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
@@ -575,6 +594,39 @@ MM_Scavenger::calculateRecommendedWorkingThreads(MM_EnvironmentStandard *env)
 	Trc_MM_Scavenger_calculateRecommendedWorkingThreads_setRecommendedThreads(env->getLanguageVMThread(), scavengeTotalTime, totalStallTime, (percentStall*100), totalThreads, idealThreads, adjustedAverage, (adjustedAverage +  _extensions->adaptiveThreadBooster), _recommendedThreads);
 }
 
+void
+MM_Scavenger::adjustCopyScanCacheSizing(MM_EnvironmentStandard *env)
+{
+	if (!_extensions->adaptiveScanCacheSizing || IS_CONCURRENT_ENABLED) {
+		return;
+	}
+
+	if (_isRememberedSetInOverflowAtTheBeginning || _extensions->scavengerStats._causedRememberedSetOverflow) {
+		/* Overflow handling stalls threads for reasons unrelated to cache sizing */
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+
+	uint64_t scavengeTotalTime = omrtime_hires_delta(_cycleTimes.cycleStart, _cycleTimes.cycleEnd, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	if (0 == scavengeTotalTime) {
+		return;
+	}
+
+	/* Fraction of the cycle the average thread spent with nothing to scan */
+	uintptr_t totalThreads = _dispatcher->activeThreadCount();
+	uint64_t avgScanStallTime = omrtime_hires_delta(0, (scavengerStats->_workStallTime + scavengerStats->_completeStallTime), OMRPORT_TIME_DELTA_IN_MICROSECONDS) / totalThreads;
+	float scanStallRatio = OMR_MIN(1.0f, (float)avgScanStallTime / (float)scavengeTotalTime);
+
+	/* Bytes copied per copy cache refresh - well below the current maximum means caches are cut short and flushed often */
+	uintptr_t copiedBytes = scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes;
+	uintptr_t cacheRefreshCount = scavengerStats->_semiSpaceAllocationCountSmall + scavengerStats->_tenureSpaceAllocationCountSmall;
+	uintptr_t bytesPerCacheRefresh = (0 == cacheRefreshCount) ? 0 : (copiedBytes / cacheRefreshCount);
+
+	_cacheSizingModel.update(scanStallRatio, bytesPerCacheRefresh, totalThreads);
+}
+
 /**
  * Run a scavenge.
  */
@@ -772,6 +824,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 {
 	finalGCStats->_rememberedSetOverflow |= scavStats->_rememberedSetOverflow;
 	finalGCStats->_causedRememberedSetOverflow |= scavStats->_causedRememberedSetOverflow;
+	finalGCStats->_rememberedSetOverflowCardsWalked += scavStats->_rememberedSetOverflowCardsWalked;
+	finalGCStats->_rememberedSetOverflowHeapWalks += scavStats->_rememberedSetOverflowHeapWalks;
 	finalGCStats->_scanCacheOverflow |= scavStats->_scanCacheOverflow;
 	finalGCStats->_scanCacheAllocationFromHeap |= scavStats->_scanCacheAllocationFromHeap;
 	finalGCStats->_scanCacheAllocationDurationDuringSavenger = OMR_MAX(finalGCStats->_scanCacheAllocationDurationDuringSavenger, scavStats->_scanCacheAllocationDurationDuringSavenger);
@@ -813,6 +867,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_survivorTLHRemainderCount += scavStats->_survivorTLHRemainderCount;
 	finalGCStats->_tenureTLHRemainderCount += scavStats->_tenureTLHRemainderCount;
 
+	finalGCStats->_hotFieldSampledObjects += scavStats->_hotFieldSampledObjects;
+	finalGCStats->_hotFieldCoLocatedCount += scavStats->_hotFieldCoLocatedCount;
+
 	finalGCStats->_semiSpaceAllocationCountLarge += scavStats->_semiSpaceAllocationCountLarge;
 	finalGCStats->_semiSpaceAllocationCountSmall += scavStats->_semiSpaceAllocationCountSmall;
 
@@ -1013,7 +1070,7 @@ MM_Scavenger::calcGCStats(MM_EnvironmentStandard *env)
 uintptr_t
 MM_Scavenger::calculateCopyScanCacheSizeForWaitingThreads(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t waitingThreads)
 {
-	uintptr_t minCacheSize = _extensions->scavengerScanCacheMinimumSize;
+	uintptr_t minCacheSize = _cacheSizingModel.getMinimumSize();
 	uintptr_t range = maxCacheSize - minCacheSize;
 	uintptr_t minTLHSize = _extensions->tlhMinimumSize;
 	uintptr_t step = range / minTLHSize;
@@ -1026,7 +1083,7 @@ MM_Scavenger::calculateCopyScanCacheSizeForWaitingThreads(uintptr_t maxCacheSize
 uintptr_t
 MM_Scavenger::calculateCopyScanCacheSizeForQueueLength(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t scanCacheCount)
 {
-	uintptr_t minCacheSize = _extensions->scavengerScanCacheMinimumSize;
+	uintptr_t minCacheSize = _cacheSizingModel.getMinimumSize();
 	uintptr_t range = maxCacheSize - minCacheSize;
 	uintptr_t cacheSize =  minCacheSize + ((range / threadCount) * (scanCacheCount + 1));
 
@@ -1043,7 +1100,7 @@ MMINLINE uintptr_t
 MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 {
 	uintptr_t threadCount = _dispatcher->threadCount();
-	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	uintptr_t maxCacheSize = _cacheSizingModel.getMaximumSize();
 	uintptr_t cacheSize = maxCacheSize;
 	uintptr_t waitingThreads = _waitingCount;
 	if (waitingThreads > 0) {
@@ -1057,7 +1114,7 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
 	}
 
-	env->_scavengerStats.countCopyCacheSize(cacheSize, maxCacheSize);
+	env->_scavengerStats.countCopyCacheSize(cacheSize, _extensions->scavengerScanCacheMaximumSize);
 
 #if defined(J9MODRON_SCAVENGER_TRACE)
     PORT_ACCESS_FROM_ENVIRONMENT(env);
@@ -1842,6 +1899,18 @@ MMINLINE void
 MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader, omrobjectptr_t destinationObjectPtr) {
 	/* depth copy the hot fields of an object up to a depth specified by depthCopyMax */
 	if (env->_hotFieldCopyDepthCount < _extensions->depthCopyMax) {
+		if (0 != _extensions->scavengerHotFieldCoLocation) {
+			/* copy the sampled hot children immediately after their parent so that they share its copy cache */
+			uint8_t hotFieldOffsets[HOT_FIELD_CO_LOCATION_MAXIMUM];
+			uintptr_t hotFieldCount = _extensions->objectModel.getCoLocatedHotFieldOffsets(forwardedHeader, hotFieldOffsets, _extensions->scavengerHotFieldCoLocation);
+			for (uintptr_t i = 0; i < hotFieldCount; i++) {
+				if (copyHotField(env, destinationObjectPtr, hotFieldOffsets[i])) {
+					env->_scavengerStats._hotFieldCoLocatedCount += 1;
+				}
+			}
+			return;
+		}
+
 		uint8_t hotFieldOffset = _extensions->objectModel.getHotFieldOffset(forwardedHeader);
 		if (U_8_MAX != hotFieldOffset) {
 			copyHotField(env, destinationObjectPtr, hotFieldOffset);
@@ -1859,7 +1928,7 @@ MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader
 	}
 }
 
-MMINLINE void
+MMINLINE bool
 MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset) {
 	bool const compressed = _extensions->compressObjectReferences();
 	GC_SlotObject hotFieldObject(_omrVM, GC_SlotObject::addToSlotAddress((fomrobject_t*)((uintptr_t)destinationObjectPtr), offset, compressed));
@@ -1869,10 +1938,37 @@ MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinati
 		MM_ForwardedHeader forwardHeaderHotField(objectPtr, compressed);
 		if (!forwardHeaderHotField.isForwardedPointer()) {
 			env->_hotFieldCopyDepthCount += 1;
-			copyObject(env, &forwardHeaderHotField);
+			omrobjectptr_t copiedObjectPtr = copyObject(env, &forwardHeaderHotField);
 			env->_hotFieldCopyDepthCount -= 1;
+			return NULL != copiedObjectPtr;
+		}
+	}
+	return false;
+}
+
+MMINLINE bool
+MM_Scavenger::shouldSampleHotFields(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner)
+{
+	bool sampleHotFields = false;
+	if ((0 != _extensions->scavengerHotFieldCoLocation) && !objectScanner->isIndexableObject()) {
+		env->_hotFieldSampleCount += 1;
+		if (HOT_FIELD_SAMPLE_INTERVAL <= env->_hotFieldSampleCount) {
+			env->_hotFieldSampleCount = 0;
+			env->_scavengerStats._hotFieldSampledObjects += 1;
+			sampleHotFields = true;
 		}
 	}
+	return sampleHotFields;
+}
+
+MMINLINE void
+MM_Scavenger::sampleHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, GC_SlotObject *slotObject)
+{
+	/* a slot still pointing into evacuate space holds a child copied on behalf of this parent (or about to be) */
+	if (isObjectInEvacuateMemory(slotObject->readReferenceFromSlot())) {
+		intptr_t slotOffset = GC_SlotObject::subtractSlotAddresses(slotObject->readAddressFromSlot(), (fomrobject_t *)objectPtr, _extensions->compressObjectReferences());
+		_extensions->objectModel.sampleHotFieldReference(objectPtr, (uintptr_t)slotOffset);
+	}
 }
 
 /****************************************
@@ -2023,8 +2119,13 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	uint64_t slotsScanned = 0;
 	GC_SlotObject *slotObject = NULL;
 
+	bool sampleHotFields = shouldSampleHotFields(env, objectScanner);
+
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
 	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+		if (sampleHotFields) {
+			sampleHotField(env, objectPtr, slotObject);
+		}
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		shouldRemember |= isSlotObjectInNewSpace;
 		if (NULL != *copyCache) {
@@ -2158,7 +2259,13 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 	uint64_t slotsCopied = 0;
 	uint64_t slotsScanned = 0;
 
+	/* an object resumed after aliasing was already considered for sampling when its scan started */
+	bool sampleHotFields = !scanCache->_hasPartiallyScannedObject && shouldSampleHotFields(env, objectScanner);
+
 	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+		if (sampleHotFields) {
+			sampleHotField(env, objectPtr, slotObject);
+		}
 		/* If the object should be remembered and it is in old space, remember it */
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		scanCache->_shouldBeRemembered |= isSlotObjectInNewSpace;
@@ -2662,6 +2769,49 @@ MM_Scavenger::addAllRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_
 	}
 }
 
+void
+MM_Scavenger::addCardRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_RSOverflow *overflow)
+{
+	MM_HeapRegionManager *regionManager = _extensions->heap->getHeapRegionManager();
+	uintptr_t cardCount = _rememberedSetOverflowCards->getCardCount();
+	for (uintptr_t cardIndex = 0; cardIndex < cardCount; cardIndex++) {
+		omrobjectptr_t firstObjectPtr = _rememberedSetOverflowCards->getFirstObject(cardIndex);
+		if (NULL != firstObjectPtr) {
+			env->_scavengerStats._rememberedSetOverflowCardsWalked += 1;
+			/* Walk from the lowest object recorded on the card to the end of the card, marking remembered objects */
+			MM_HeapRegionDescriptor *region = regionManager->regionDescriptorForAddress(firstObjectPtr);
+			omrobjectptr_t walkTop = (omrobjectptr_t)OMR_MIN((uintptr_t)_rememberedSetOverflowCards->getCardTop(cardIndex), (uintptr_t)region->getHighAddress());
+			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, firstObjectPtr, walkTop, false);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = objectIterator.nextObject())) {
+				if (_extensions->objectModel.isRemembered(objectPtr)) {
+					overflow->addObject(objectPtr);
+				}
+			}
+		}
+	}
+}
+
+void
+MM_Scavenger::addRememberedSetListsToOverflowCards(MM_EnvironmentStandard *env)
+{
+	/* Puddles still waiting to be processed by scavengeRememberedSetList() must be visible to the iterator */
+	_extensions->rememberedSet.stopProcessingSublist();
+
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator remSetIterator(&(_extensions->rememberedSet));
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		GC_SublistSlotIterator remSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+			omrobjectptr_t objectPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+			if (NULL != objectPtr) {
+				_rememberedSetOverflowCards->rememberObject(objectPtr);
+			}
+		}
+	}
+}
+
 void
 MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
 {
@@ -2676,6 +2826,10 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 			if (!_isRememberedSetInOverflowAtTheBeginning) {
 				env->_scavengerStats._causedRememberedSetOverflow = 1;
 			}
+			if (NULL != _rememberedSetOverflowCards) {
+				/* Keep track of where the object is so overflow handling need not walk all of tenure space to find it */
+				_rememberedSetOverflowCards->rememberObject(objectPtr);
+			}
 			setRememberedSetOverflowState();
 			return ;
 		}
@@ -2857,12 +3011,23 @@ MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard *env)
 		omrtty_printf("{SCAV: Scavenge remembered set overflow}\n");
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 
+		bool useOverflowCards = (NULL != _rememberedSetOverflowCards) && _rememberedSetOverflowCardsValid;
+		if (useOverflowCards) {
+			/* Objects still in the lists are merged into the cards so the cards alone locate every remembered object */
+			addRememberedSetListsToOverflowCards(env);
+		}
+
 		clearRememberedSetLists(env);
 
 		/* Creation of this class will Abort Global Collector */
 		MM_RSOverflow rememberedSetOverflow(env);
 
-		addAllRememberedObjectsToOverflow(env, &rememberedSetOverflow);
+		if (useOverflowCards) {
+			addCardRememberedObjectsToOverflow(env, &rememberedSetOverflow);
+		} else {
+			env->_scavengerStats._rememberedSetOverflowHeapWalks += 1;
+			addAllRememberedObjectsToOverflow(env, &rememberedSetOverflow);
+		}
 
 		/*
 		 * Scan any remembered objects, but don't adjust their remembered bit.
@@ -2913,43 +3078,53 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 
 		/* Clear the overflow state. Probability is high that we'll wind up re-overflowing. */
 		clearRememberedSetOverflowState();
-		clearRememberedSetLists(env);
 
-		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
-		MM_HeapRegionDescriptorStandard *region = NULL;
-		GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
-		while((region = regionIterator.nextRegion()) != NULL) {
-			/* Verify or clear remembered bits for each tenured object currently flagged as remembered */
-			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
-			omrobjectptr_t objectPtr;
-			while((objectPtr = objectIterator.nextObject()) != NULL) {
-				if(_extensions->objectModel.isRemembered(objectPtr)) {
-					/* Check if object still has nursery references, direct or indirect */
-					bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
-
-					/* Unconditionally remember object if it was recently referenced */
-					if (!IS_CONCURRENT_ENABLED && !shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
-						Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
-						shouldBeRemembered = true;
+		if ((NULL != _rememberedSetOverflowCards) && _rememberedSetOverflowCardsValid) {
+			/* Objects still in the lists are merged into the cards, only the dirty cards need to be walked */
+			addRememberedSetListsToOverflowCards(env);
+			clearRememberedSetLists(env);
+
+			if (_rememberedSetOverflowCards->isDirty()) {
+				_rememberedSetOverflowCards->clearDirty();
+				MM_HeapRegionManager *regionManager = _extensions->heap->getHeapRegionManager();
+				uintptr_t cardCount = _rememberedSetOverflowCards->getCardCount();
+				for (uintptr_t cardIndex = 0; cardIndex < cardCount; cardIndex++) {
+					/* Objects that overflow again while pruning re-dirty their card */
+					omrobjectptr_t firstObjectPtr = _rememberedSetOverflowCards->cleanCard(cardIndex);
+					if (NULL != firstObjectPtr) {
+						env->_scavengerStats._rememberedSetOverflowCardsWalked += 1;
+						MM_HeapRegionDescriptor *region = regionManager->regionDescriptorForAddress(firstObjectPtr);
+						omrobjectptr_t walkTop = (omrobjectptr_t)OMR_MIN((uintptr_t)_rememberedSetOverflowCards->getCardTop(cardIndex), (uintptr_t)region->getHighAddress());
+						GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, firstObjectPtr, walkTop, false);
+						omrobjectptr_t objectPtr = NULL;
+						while (NULL != (objectPtr = objectIterator.nextObject())) {
+							if (_extensions->objectModel.isRemembered(objectPtr)) {
+								pruneRememberedObject(env, objectPtr);
+							}
+						}
 					}
+				}
+			}
+		} else {
+			clearRememberedSetLists(env);
 
-					if(shouldBeRemembered) {
-						/* Tenured object remains flagged as remembered */
-						/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force setRememberedSetOverflowState(). */
-						addToRememberedSetFragment(env, objectPtr);
-					} else {
-						/* Tenured object remembered flags can be cleared */
-						_extensions->objectModel.clearRemembered(objectPtr);
-#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
-						if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
-							/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
-							 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
-							 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
-							 * in a more generic spot when object is scavenged and is unnecessary to do it here.
-							 */
-							oldToOldReferenceCreated(env, objectPtr);
-						}
-#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+			if (NULL != _rememberedSetOverflowCards) {
+				/* Rebuild the cards from scratch, objects that overflow while pruning are recorded on them */
+				_rememberedSetOverflowCards->clear();
+				_rememberedSetOverflowCardsValid = true;
+			}
+
+			/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
+			env->_scavengerStats._rememberedSetOverflowHeapWalks += 1;
+			MM_HeapRegionDescriptorStandard *region = NULL;
+			GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
+			while((region = regionIterator.nextRegion()) != NULL) {
+				/* Verify or clear remembered bits for each tenured object currently flagged as remembered */
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
+				omrobjectptr_t objectPtr;
+				while((objectPtr = objectIterator.nextObject()) != NULL) {
+					if(_extensions->objectModel.isRemembered(objectPtr)) {
+						pruneRememberedObject(env, objectPtr);
 					}
 				}
 			}
@@ -2970,6 +3145,38 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_Scavenger::pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* Check if object still has nursery references, direct or indirect */
+	bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
+
+	/* Unconditionally remember object if it was recently referenced */
+	if (!IS_CONCURRENT_ENABLED && !shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
+		Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+		shouldBeRemembered = true;
+	}
+
+	if(shouldBeRemembered) {
+		/* Tenured object remains flagged as remembered */
+		/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force setRememberedSetOverflowState(). */
+		addToRememberedSetFragment(env, objectPtr);
+	} else {
+		/* Tenured object remembered flags can be cleared */
+		_extensions->objectModel.clearRemembered(objectPtr);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference() && !IS_CONCURRENT_ENABLED) {
+			/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
+			 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
+			 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
+			 * in a more generic spot when object is scavenged and is unnecessary to do it here.
+			 */
+			oldToOldReferenceCreated(env, objectPtr);
+		}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+	}
+}
+
 void
 MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 {
@@ -3051,7 +3258,7 @@ MM_Scavenger::scavengeRememberedSetListDirect(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
 
 	MM_SublistPuddle *puddle = NULL;
-	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle, env->getWorkerID()))) {
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
 		uintptr_t numElements = 0;
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
@@ -3086,7 +3293,7 @@ MM_Scavenger::scavengeRememberedSetListIndirect(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
 
 	MM_SublistPuddle *puddle = NULL;
-	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle, env->getWorkerID()))) {
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
 		uintptr_t numElements = 0;
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
@@ -3128,7 +3335,7 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 
 	/* Remembered set walk */
 	MM_SublistPuddle *puddle = NULL;
-	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle, env->getWorkerID()))) {
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
 		uintptr_t numElements = 0;
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
@@ -4110,6 +4317,10 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 		 *    ii) Walk old space and build up the overflow list
 		 */
 		_extensions->scavengerRsoScanUnsafe = true;
+		if (NULL != _rememberedSetOverflowCards) {
+			/* Objects recorded on the cards may have been backed out of tenure space */
+			_rememberedSetOverflowCardsValid = false;
+		}
 
 		if(isRememberedSetInOverflowState()) {
 			GC_MemorySubSpaceRegionIterator evacuateRegionIterator(_activeSubSpace);
@@ -4274,6 +4485,7 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 		if(scavengeCompletedSuccessfully(env)) {
 
 			calculateRecommendedWorkingThreads(env);
+			adjustCopyScanCacheSizing(env);
 
 			/* Merge sublists in the remembered set (if necessary) */
 			_extensions->rememberedSet.compact(env);
@@ -4853,6 +5065,12 @@ MM_Scavenger::globalCollectionStart(MM_EnvironmentBase *env)
 
 	scavengerStats->_semiSpaceAllocBytesAcumulation += heapStatsSemiSpace._allocBytes;
 	scavengerStats->_tenureSpaceAllocBytesAcumulation += heapStatsTenureSpace._allocBytes;
+
+	if (NULL != _rememberedSetOverflowCards) {
+		/* Remembered objects recorded on the cards may die or move, so the cards are only trusted again once rebuilt */
+		_rememberedSetOverflowCards->clear();
+		_rememberedSetOverflowCardsValid = !isRememberedSetInOverflowState();
+	}
 }
 
 void
@@ -41,6 +41,7 @@
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#include "ScavengerCacheSizingModel.hpp"
 #include "ScavengerDelegate.hpp"
 
 struct J9HookInterface;
@@ -55,6 +56,7 @@ class MM_MemorySubSpaceSemiSpace;
 class MM_ParallelDispatcher;
 class MM_PhysicalSubArena;
 class MM_RSOverflow;
+class MM_RSOverflowCards;
 class MM_SublistPool;
 
 struct OMR_VM;
@@ -110,6 +112,9 @@ private:
 	uintptr_t _minTenureFailureSize;
 	uintptr_t _minSemiSpaceFailureSize;
 	uintptr_t _recommendedThreads; /** Number of threads recommended to the dispatcher for the Scavenge task */
+	MM_ScavengerCacheSizingModel _cacheSizingModel; /**< Copy-scan cache size bounds and aliasing threshold for the current cycle (retuned between cycles by adaptive scan cache sizing) */
+	MM_RSOverflowCards *_rememberedSetOverflowCards; /**< Card table locating remembered objects while the remembered set is overflowed (NULL unless enabled by -Xgc:rememberedSetOverflowCards) */
+	bool _rememberedSetOverflowCardsValid; /**< False if remembered objects may be missing from the overflow cards and tenure space must be walked to rebuild them */
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics;  /** Common collect stats (memory, time etc.) */
@@ -303,8 +308,23 @@ public:
 	 * Valid if scavenger dynamicBreadthScanOrdering is enabled.
 	 * @param destinationObjectPtr The object who's hot field will be copied
 	 * @param offset The object field offset of the hot field to be copied
+	 * @return true if the hot field was found unforwarded and copied (or forwarded by a racing thread)
 	 */ 
-	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
+	MMINLINE bool copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
+
+	/* Decide whether the slots of the object about to be scanned should be sampled for hot field co-location.
+	 * Each thread samples every HOT_FIELD_SAMPLE_INTERVAL'th non-indexable object it scans.
+	 * @param objectScanner The scanner of the object about to be scanned
+	 * @return true if the slots of the object should be sampled
+	 */
+	MMINLINE bool shouldSampleHotFields(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner);
+
+	/* Sample a reference slot of a scanned object for the object model's hot field ranking.
+	 * Valid if scavenger hot field co-location is enabled.
+	 * @param objectPtr The scanned (parent) object
+	 * @param slotObject The slot about to be copied and forwarded
+	 */
+	MMINLINE void sampleHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, GC_SlotObject *slotObject);
 
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
@@ -363,6 +383,20 @@ public:
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
 
+	/**
+	 * Keep or drop a remembered tenured object found while pruning an overflowed remembered set.
+	 * Objects that still reference nursery objects are re-added to the remembered set, others have their remembered bits cleared.
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] a tenured object flagged as remembered
+	 */
+	void pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Record every object in the remembered set lists on the overflow cards.
+	 * @param env[in] the current thread
+	 */
+	void addRememberedSetListsToOverflowCards(MM_EnvironmentStandard *env);
+
 	/**
 	 * Checks if the  Object should be remembered or not
 	 * @param env Standard Environment
@@ -533,6 +567,13 @@ public:
 	 */
 	void addAllRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_RSOverflow *overflow);
 
+	/*
+	 * Walk the dirty overflow cards and add all found Remembered objects to Overflow
+	 * @param env - Environment
+	 * @param overflow - pointer to RS Overflow
+	 */
+	void addCardRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_RSOverflow *overflow);
+
 	void clearRememberedSetLists(MM_EnvironmentStandard *env);
 
 	MMINLINE bool isRememberedSetInOverflowState() { return _extensions->isScavengerRememberedSetInOverflowState(); }
@@ -600,6 +641,12 @@ public:
 	 */
 	void calculateRecommendedWorkingThreads(MM_EnvironmentStandard *env);
 
+	/**
+	 * Feed the scan stall ratio and cache refresh rate of a successful scavenge to the copy-scan cache
+	 * sizing controller (see MM_ScavengerCacheSizingModel), called at the end of each successful scavenge.
+	 */
+	void adjustCopyScanCacheSizing(MM_EnvironmentStandard *env);
+
 	/**
 	 * Sets the collector recommended thread count to UDATA_MAX (default value).
 	 *
@@ -669,6 +716,7 @@ public:
 
 	/* API used by ParallelScavengeTask to set _waitingCountAliasThreshold. */
 	void setAliasThreshold(uintptr_t waitingCountAliasThreshold) { _waitingCountAliasThreshold = waitingCountAliasThreshold; }
+	double getAliasInhibitingThresholdPercentage() { return _cacheSizingModel.getAliasInhibitingThresholdPercentage(); }
 	
 	/**
 	 * Notify Collector that a thread is about to acquire Exclusive VM access.
@@ -950,6 +998,9 @@ public:
 		, _minTenureFailureSize(UDATA_MAX)
 		, _minSemiSpaceFailureSize(UDATA_MAX)
 		, _recommendedThreads(UDATA_MAX)
+		, _cacheSizingModel()
+		, _rememberedSetOverflowCards(NULL)
+		, _rememberedSetOverflowCardsValid(true)
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
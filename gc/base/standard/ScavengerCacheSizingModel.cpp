@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ScavengerCacheSizingModel.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "ModronAssertions.h"
+
+#include "Math.hpp"
+
+#define SCAN_STALL_HISTORY_WEIGHT ((float)0.5)
+#define SCAN_STALL_RATIO_STARVED ((float)0.10)
+#define SCAN_STALL_RATIO_BUSY ((float)0.02)
+
+void
+MM_ScavengerCacheSizingModel::initialize(uintptr_t minimumSize, uintptr_t maximumSize, double aliasInhibitingThresholdPercentage, uintptr_t objectAlignment)
+{
+	_configuredMinimumSize = minimumSize;
+	_configuredMaximumSize = maximumSize;
+	_configuredAliasInhibitingThresholdPercentage = aliasInhibitingThresholdPercentage;
+	_objectAlignment = objectAlignment;
+
+	_minimumSize = minimumSize;
+	_maximumSize = maximumSize;
+	_aliasInhibitingThresholdPercentage = aliasInhibitingThresholdPercentage;
+	_averageScanStallRatio = 0.0f;
+}
+
+void
+MM_ScavengerCacheSizingModel::update(float scanStallRatio, uintptr_t bytesPerCacheRefresh, uintptr_t threadCount)
+{
+	_averageScanStallRatio = MM_Math::weightedAverage(_averageScanStallRatio, scanStallRatio, SCAN_STALL_HISTORY_WEIGHT);
+
+	/* inhibiting aliasing before a single thread waits would inhibit it for the whole cycle */
+	double minimumAliasInhibitingThresholdPercentage = OMR_MIN(_configuredAliasInhibitingThresholdPercentage, 1.0 / (double)OMR_MAX(threadCount, 1));
+
+	if (_averageScanStallRatio > SCAN_STALL_RATIO_STARVED) {
+		/* Starving: smaller caches reach the scan list sooner, and inhibiting aliasing earlier keeps them there */
+		if (_minimumSize > _configuredMinimumSize) {
+			_minimumSize = OMR_MAX(_configuredMinimumSize, MM_Math::roundToCeiling(_objectAlignment, _minimumSize / 2));
+		} else {
+			_maximumSize = OMR_MAX(_configuredMinimumSize, MM_Math::roundToCeiling(_objectAlignment, _maximumSize / 2));
+		}
+		_aliasInhibitingThresholdPercentage = OMR_MAX(minimumAliasInhibitingThresholdPercentage, _aliasInhibitingThresholdPercentage / 2);
+	} else if (_averageScanStallRatio < SCAN_STALL_RATIO_BUSY) {
+		/* No longer starving: restore aliasing for depth-first locality */
+		_aliasInhibitingThresholdPercentage = OMR_MIN(_configuredAliasInhibitingThresholdPercentage, OMR_MAX(minimumAliasInhibitingThresholdPercentage, _aliasInhibitingThresholdPercentage * 2));
+
+		if (bytesPerCacheRefresh < (_maximumSize / 2)) {
+			/* Over-chunking: threads are kept busy anyway, so copy into larger caches */
+			if (_maximumSize < _configuredMaximumSize) {
+				_maximumSize = OMR_MIN(_configuredMaximumSize, _maximumSize * 2);
+			} else {
+				_minimumSize = OMR_MAX(_configuredMinimumSize, MM_Math::roundToCeiling(_objectAlignment, OMR_MIN(_maximumSize / 2, _minimumSize * 2)));
+			}
+		}
+	}
+
+	Assert_MM_true(_minimumSize <= _maximumSize);
+	Assert_MM_true((_configuredMinimumSize <= _minimumSize) && (_maximumSize <= _configuredMaximumSize));
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SCAVENGERCACHESIZINGMODEL_HPP_)
+#define SCAVENGERCACHESIZINGMODEL_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "Base.hpp"
+
+/**
+ * Feedback controller for the copy-scan cache size bounds and the copy cache aliasing threshold of the
+ * scavenger (-Xgc:adaptiveScanCacheSizing), updated at the end of each successful scavenge.
+ *
+ * Cycles where threads starve for scan work narrow the cache size bounds and inhibit aliasing sooner, so
+ * that copied objects reach the scan list earlier. Once the starvation is gone the aliasing threshold is
+ * restored, and cycles whose caches are refreshed long before they fill widen the bounds again. The bounds
+ * never leave the configured range, and the aliasing threshold stays between one waiting thread and the
+ * configured threshold.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerCacheSizingModel : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _configuredMinimumSize; /**< -Xgc:scanCacheMinimumSize, lower limit of the bounds */
+	uintptr_t _configuredMaximumSize; /**< -Xgc:scanCacheMaximumSize, upper limit of the bounds */
+	double _configuredAliasInhibitingThresholdPercentage; /**< -Xgc:aliasInhibitingThresholdPercentage, upper limit of the threshold */
+	uintptr_t _objectAlignment; /**< cache sizes are kept multiples of the object alignment */
+
+	uintptr_t _minimumSize; /**< lower bound on the copy-scan cache size for the next cycle */
+	uintptr_t _maximumSize; /**< upper bound on the copy-scan cache size for the next cycle */
+	double _aliasInhibitingThresholdPercentage; /**< percentage of threads that can be blocked before copy cache aliasing is inhibited in the next cycle */
+	float _averageScanStallRatio; /**< weighted average fraction of scavenge time GC threads spent stalled waiting for scan work */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Start from the configured bounds and threshold, forgetting any history.
+	 */
+	void initialize(uintptr_t minimumSize, uintptr_t maximumSize, double aliasInhibitingThresholdPercentage, uintptr_t objectAlignment);
+
+	/**
+	 * Retune the bounds and the threshold after a scavenge.
+	 * @param scanStallRatio fraction of the scavenge the average thread spent with nothing to scan
+	 * @param bytesPerCacheRefresh bytes copied per copy cache refresh
+	 * @param threadCount number of threads which took part in the scavenge
+	 */
+	void update(float scanStallRatio, uintptr_t bytesPerCacheRefresh, uintptr_t threadCount);
+
+	MMINLINE uintptr_t getMinimumSize() { return _minimumSize; }
+	MMINLINE uintptr_t getMaximumSize() { return _maximumSize; }
+	MMINLINE double getAliasInhibitingThresholdPercentage() { return _aliasInhibitingThresholdPercentage; }
+	MMINLINE float getAverageScanStallRatio() { return _averageScanStallRatio; }
+
+	MM_ScavengerCacheSizingModel() :
+		MM_Base(),
+		_configuredMinimumSize(0),
+		_configuredMaximumSize(0),
+		_configuredAliasInhibitingThresholdPercentage(0.0),
+		_objectAlignment(1),
+		_minimumSize(0),
+		_maximumSize(0),
+		_aliasInhibitingThresholdPercentage(0.0),
+		_averageScanStallRatio(0.0f)
+	{
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* SCAVENGERCACHESIZINGMODEL_HPP_ */
@@ -20,6 +20,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
+
 #include "omrthread.h"
 
 #if defined(OMR_GC_REALTIME)
@@ -28,6 +30,7 @@
 
 #include "Debug.hpp"
 #include "GCExtensionsBase.hpp"
+#include "MarkingScheme.hpp"
 #include "OverflowStandard.hpp"
 
 /**
@@ -40,7 +43,7 @@ MM_WorkPacketsSATB::newInstance(MM_EnvironmentBase *env)
 {
 	MM_WorkPacketsSATB *workPackets;
 
-	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
 	if (workPackets) {
 		new(workPackets) MM_WorkPacketsSATB(env);
 		if (!workPackets->initialize(env)) {
@@ -166,26 +169,71 @@ MM_WorkPacketsSATB::removePacketFromInUseList(MM_EnvironmentBase *env, MM_Packet
 void
 MM_WorkPacketsSATB::putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 {
-	_fullPacketList.push(env, packet);
+	restoreBarrierPacket(env, packet);
+	if (packet->isEmpty()) {
+		/* every entry was filtered out, so there is nothing left to trace */
+		putPacket(env, packet);
+	} else {
+		_fullPacketList.push(env, packet);
+	}
+}
+
+/**
+ * Entries whose object is already marked are dropped: whoever set the mark bit also queued the
+ * object for tracing.  Repeats of an object kept earlier in the packet are dropped as well, found
+ * through a small direct mapped table, since a barrier hit in a store loop tends to remember the same
+ * overwritten reference many times.  The kept entries are compacted in order to the start of the packet.
+ */
+uintptr_t
+MM_WorkPacketsSATB::filterBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet, MM_MarkingScheme *markingScheme)
+{
+	omrobjectptr_t recentEntries[SATB_FILTER_RECENT_ENTRIES];
+	memset(recentEntries, 0, sizeof(recentEntries));
+
+	uintptr_t *kept = packet->_basePtr;
+	for (uintptr_t *entry = packet->_basePtr; entry < packet->_currentPtr; entry++) {
+		omrobjectptr_t object = (omrobjectptr_t)*entry;
+		if ((NULL != object) && !markingScheme->isMarked(object)) {
+			uintptr_t index = ((uintptr_t)object / sizeof(uintptr_t)) & (SATB_FILTER_RECENT_ENTRIES - 1);
+			if (object != recentEntries[index]) {
+				recentEntries[index] = object;
+				*kept = (uintptr_t)object;
+				kept += 1;
+			}
+		}
+	}
+
+	uintptr_t dropped = (uintptr_t)(packet->_currentPtr - kept);
+	packet->_currentPtr = kept;
+	return dropped;
 }
 
 /**
  * Move all of the packets from the inUse list to the processing list
  * so they are available for processing.
  */
-void
+uintptr_t
 MM_WorkPacketsSATB::moveInUseToNonEmpty(MM_EnvironmentBase *env)
 {
 	MM_Packet *head, *tail;
 	UDATA count;
 	bool didPop;
+	uintptr_t entries = 0;
 
 	/* pop the inUseList */
 	didPop = _inUseBarrierPacketList.popList(&head, &tail, &count);
 	/* push the values from the inUseList onto the processingList */
 	if (didPop) {
+		MM_Packet *packet = head;
+		while (NULL != packet) {
+			entries += (uintptr_t)(packet->_currentPtr - packet->_basePtr);
+			restoreBarrierPacket(env, packet);
+			packet = (tail == packet) ? NULL : packet->_next;
+		}
 		_nonEmptyPacketList.pushList(head, tail, count);
 	}
+
+	return entries;
 }
 
 /**
@@ -238,6 +286,7 @@ MM_WorkPacketsSATB::resetAllPackets(MM_EnvironmentBase *env)
 	MM_Packet *packet;
 
 	while (NULL != (packet = getPacket(env, &_inUseBarrierPacketList))) {
+		restoreBarrierPacket(env, packet);
 		packet->resetData(env);
 		putPacket(env, packet);
 	}
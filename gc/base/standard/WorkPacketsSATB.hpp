@@ -29,7 +29,11 @@
 #include "EnvironmentBase.hpp"
 #include "WorkPackets.hpp"
 
+/* Number of recently kept entries remembered when filtering repeats out of a published barrier packet (power of 2) */
+#define SATB_FILTER_RECENT_ENTRIES 16
+
 class MM_IncrementalOverflow;
+class MM_MarkingScheme;
 
 class MM_WorkPacketsSATB : public MM_WorkPackets
 {
@@ -55,9 +59,40 @@ public:
 	virtual void removePacketFromInUseList(MM_EnvironmentBase *env, MM_Packet *packet);
 	virtual void putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 
-	void moveInUseToNonEmpty(MM_EnvironmentBase *env);
+	/**
+	 * Move all of the packets from the inUse list to the processing list.
+	 * @return the number of entries in the moved packets
+	 */
+	uintptr_t moveInUseToNonEmpty(MM_EnvironmentBase *env);
+
+	/**
+	 * Limit a barrier packet to its first slots, so that a fragment using it fills up (and is published) sooner.
+	 * The full capacity is restored when the packet leaves barrier use.
+	 */
+	MMINLINE void limitBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet, uintptr_t slots)
+	{
+		packet->_topPtr = packet->_baseAddress + OMR_MIN(slots, (uintptr_t)_slotsInPacket);
+	}
+
+	MMINLINE void restoreBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+	{
+		packet->_topPtr = packet->_baseAddress + _slotsInPacket;
+	}
+
+	MMINLINE uintptr_t getBarrierPacketEntries(MM_EnvironmentBase *env, MM_Packet *packet)
+	{
+		return (uintptr_t)(packet->_currentPtr - packet->_basePtr);
+	}
+
+	/**
+	 * Drop the entries of a full barrier packet that tracing would discard, before the packet is handed to marking.
+	 * @param packet the barrier packet being published
+	 * @param markingScheme the marking scheme whose mark map tells which entries are already marked
+	 * @return the number of entries dropped
+	 */
+	uintptr_t filterBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet, MM_MarkingScheme *markingScheme);
 
-	void resetAllPackets(MM_EnvironmentBase *env);
+	virtual void resetAllPackets(MM_EnvironmentBase *env);
 
 	/**
 	 * Create a MM_WorkPacketsRealtime object.
@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Packet.hpp"
+#include "WorkPacketsWorkStealing.hpp"
+
+#include "ModronAssertions.h"
+
+/**
+ * Instantiate a MM_WorkPacketsWorkStealing
+ * @return pointer to the new object
+ */
+MM_WorkPacketsWorkStealing *
+MM_WorkPacketsWorkStealing::newInstance(MM_EnvironmentBase *env)
+{
+	MM_WorkPacketsWorkStealing *workPackets;
+
+	workPackets = (MM_WorkPacketsWorkStealing *)env->getForge()->allocate(sizeof(MM_WorkPacketsWorkStealing), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL != workPackets) {
+		new(workPackets) MM_WorkPacketsWorkStealing(env);
+		if (!workPackets->initialize(env)) {
+			workPackets->kill(env);
+			workPackets = NULL;
+		}
+	}
+
+	return workPackets;
+}
+
+/**
+ * Initialize the shared packet lists and one deque per GC thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_WorkPacketsWorkStealing::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_WorkPacketsStandard::initialize(env)) {
+		return false;
+	}
+
+	_dequeCount = OMR_MAX(_extensions->gcThreadCount, 1);
+	uintptr_t dequeBytes = sizeof(PacketDeque) * _dequeCount;
+	uintptr_t slotBytes = sizeof(MM_Packet *) * _dequeSlots * _dequeCount;
+	_deques = (PacketDeque *)env->getForge()->allocate(dequeBytes + slotBytes, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _deques) {
+		_dequeCount = 0;
+		return false;
+	}
+
+	MM_Packet **slots = (MM_Packet **)((uintptr_t)_deques + dequeBytes);
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		PacketDeque *deque = &_deques[i];
+		deque->_top = 0;
+		deque->_bottom = 0;
+		deque->_slots = slots + (i * _dequeSlots);
+		/* any non-zero seed will do, keep them distinct so threads do not chase the same victims */
+		deque->_stealSeed = (i + 1) * 0x9E3779B9;
+	}
+
+	return true;
+}
+
+/**
+ * Destroy the resources a MM_WorkPacketsWorkStealing is responsible for
+ */
+void
+MM_WorkPacketsWorkStealing::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _deques) {
+		env->getForge()->free(_deques);
+		_deques = NULL;
+		_dequeCount = 0;
+	}
+
+	MM_WorkPacketsStandard::tearDown(env);
+}
+
+bool
+MM_WorkPacketsWorkStealing::dequeWorkAvailable()
+{
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		if (!_deques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+MM_Packet *
+MM_WorkPacketsWorkStealing::stealPacket(MM_EnvironmentBase *env, PacketDeque *deque)
+{
+	MM_Packet *packet = NULL;
+
+	if (1 < _dequeCount) {
+		uintptr_t seed = deque->_stealSeed;
+		uintptr_t self = (uintptr_t)(deque - _deques);
+
+		/* one pass worth of random probes, then a sweep so that a lone busy victim is always found */
+		for (uintptr_t attempt = 0; (NULL == packet) && (attempt < (2 * _dequeCount)); attempt++) {
+			uintptr_t victim = 0;
+			if (attempt < _dequeCount) {
+				/* xorshift */
+				seed ^= seed << 13;
+				seed ^= seed >> 7;
+				seed ^= seed << 17;
+				victim = seed % _dequeCount;
+			} else {
+				victim = (self + attempt) % _dequeCount;
+			}
+			if ((victim != self) && !_deques[victim].isEmpty()) {
+				env->_workPacketStats._stealAttempts += 1;
+				packet = _deques[victim].steal();
+			}
+		}
+
+		deque->_stealSeed = seed;
+		if (NULL != packet) {
+			env->_workPacketStats._stealCount += 1;
+		}
+	}
+
+	return packet;
+}
+
+/**
+ * Get an input packet, preferring the calling thread's deque, then other threads' deques,
+ * then the shared lists.
+ *
+ * @return pointer to a packet, or NULL if none available
+ */
+MM_Packet *
+MM_WorkPacketsWorkStealing::getInputPacketNoWait(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	PacketDeque *deque = getDeque(env);
+
+	if (NULL != deque) {
+		packet = deque->pop();
+		if (NULL == packet) {
+			packet = stealPacket(env, deque);
+		}
+
+		if (NULL != packet) {
+			packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			return packet;
+		}
+	}
+
+	packet = MM_WorkPackets::getInputPacketNoWait(env);
+	if ((NULL == packet) && (NULL != deque)) {
+		env->_workPacketStats._idleCount += 1;
+	}
+
+	return packet;
+}
+
+/**
+ * Put a full output packet onto the calling thread's deque, or onto the shared lists if the
+ * thread has no deque or its deque is full.
+ *
+ * @param packet The packet to put
+ */
+void
+MM_WorkPacketsWorkStealing::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	PacketDeque *deque = getDeque(env);
+
+	if ((NULL != deque) && !packet->isEmpty()) {
+		packet->resetOwner();
+		if (deque->push(packet)) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsReleased += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			/* work has appeared which other threads may steal - wake any waiting threads */
+			if (_inputListWaitCount > 0) {
+				notifyWaitingThreads(env);
+			}
+			return;
+		}
+	}
+
+	MM_WorkPackets::putOutputPacket(env, packet);
+}
+
+bool
+MM_WorkPacketsWorkStealing::inputPacketAvailable(MM_EnvironmentBase *env)
+{
+	return MM_WorkPackets::inputPacketAvailable(env) || dequeWorkAvailable();
+}
+
+/**
+ * Return any packets still held in the deques to the shared lists, then reset all packets.
+ * Must be called while no other thread is using the packets.
+ */
+void
+MM_WorkPacketsWorkStealing::resetAllPackets(MM_EnvironmentBase *env)
+{
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		MM_Packet *packet = NULL;
+		while (NULL != (packet = _deques[i].steal())) {
+			packet->resetData(env);
+			putPacket(env, packet);
+		}
+		_deques[i]._top = 0;
+		_deques[i]._bottom = 0;
+	}
+
+	MM_WorkPacketsStandard::resetAllPackets(env);
+}
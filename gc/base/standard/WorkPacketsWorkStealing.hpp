@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(WORKPACKETSWORKSTEALING_HPP_)
+#define WORKPACKETSWORKSTEALING_HPP_
+
+#include "omrcfg.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "WorkPacketsStandard.hpp"
+
+class MM_Packet;
+
+/**
+ * Work packets which distribute full output packets through per-GC-thread work-stealing
+ * deques (Chase-Lev) rather than the shared, lock protected packet lists.  A thread pushes
+ * the packets it fills onto the bottom of its own deque and pops from there first; when its
+ * deque runs dry it steals from the top of randomly selected victims before falling back to
+ * the shared lists and the overflow handler.  Selected with -Xgc:workStealingMarking.
+ *
+ * Only the packet hand-off changes, so MM_WorkStack and the marking code are unaffected.
+ * Threads which do not own a deque (non GC threads, or workers beyond the deque count)
+ * transparently use the shared lists.
+ */
+class MM_WorkPacketsWorkStealing : public MM_WorkPacketsStandard
+{
+/*
+ * Data members
+ */
+private:
+	enum {
+		_dequeSlots = 256, /**< capacity of each deque, must be a power of two */
+		_dequeSlotsMask = _dequeSlots - 1
+	};
+
+	/**
+	 * Fixed capacity Chase-Lev deque of packets.  Only the owning thread may push() and pop(),
+	 * any thread may steal().
+	 */
+	struct PacketDeque {
+		volatile uintptr_t _top; /**< index of the oldest entry, advanced by thieves and by the owner taking the last entry */
+		volatile uintptr_t _bottom; /**< index one past the newest entry, only written by the owner */
+		MM_Packet **_slots; /**< circular array of _dequeSlots entries */
+		uintptr_t _stealSeed; /**< owner-private state for random victim selection */
+		uint8_t _padding[64]; /**< keep neighbouring deques on separate cache lines */
+
+		MMINLINE bool isEmpty()
+		{
+			return ((intptr_t)_bottom - (intptr_t)_top) <= 0;
+		}
+
+		MMINLINE bool push(MM_Packet *packet)
+		{
+			uintptr_t bottom = _bottom;
+			if ((bottom - _top) >= (uintptr_t)_dequeSlots) {
+				return false;
+			}
+			_slots[bottom & _dequeSlotsMask] = packet;
+			/* the entry must be visible before thieves can observe the new bottom */
+			MM_AtomicOperations::writeBarrier();
+			_bottom = bottom + 1;
+			return true;
+		}
+
+		MMINLINE MM_Packet *pop()
+		{
+			intptr_t bottom = (intptr_t)_bottom - 1;
+			_bottom = (uintptr_t)bottom;
+			/* publish the reservation before reading top so that a racing thief sees it */
+			MM_AtomicOperations::readWriteBarrier();
+			intptr_t top = (intptr_t)_top;
+			MM_Packet *packet = NULL;
+
+			if (top <= bottom) {
+				packet = _slots[bottom & _dequeSlotsMask];
+				if (top == bottom) {
+					/* last entry - race any thieves for it */
+					if ((uintptr_t)top != MM_AtomicOperations::lockCompareExchange(&_top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+						packet = NULL;
+					}
+					_bottom = (uintptr_t)(top + 1);
+				}
+			} else {
+				_bottom = (uintptr_t)top;
+			}
+			return packet;
+		}
+
+		MMINLINE MM_Packet *steal()
+		{
+			uintptr_t top = _top;
+			MM_AtomicOperations::readBarrier();
+			uintptr_t bottom = _bottom;
+			MM_Packet *packet = NULL;
+
+			if ((intptr_t)(bottom - top) > 0) {
+				packet = _slots[top & _dequeSlotsMask];
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					packet = NULL;
+				}
+			}
+			return packet;
+		}
+	};
+
+	PacketDeque *_deques; /**< one deque per GC thread, indexed by worker ID */
+	uintptr_t _dequeCount; /**< number of entries in _deques */
+
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	/**
+	 * Answer the deque owned by the calling thread. Each thread running a task owns the deque of its worker ID,
+	 * including the thread which started the collection (worker 0), which may be a mutator.
+	 * @return the deque, or NULL if the thread does not own one
+	 */
+	MMINLINE PacketDeque *getDeque(MM_EnvironmentBase *env)
+	{
+		PacketDeque *deque = NULL;
+		uintptr_t workerID = env->getWorkerID();
+		if ((NULL != env->_currentTask) && (workerID < _dequeCount)) {
+			deque = &_deques[workerID];
+		}
+		return deque;
+	}
+
+	/**
+	 * Attempt to steal a packet from the deques of other threads, starting at random victims.
+	 * @param env[in] The thread which is stealing
+	 * @param deque[in] The deque owned by the calling thread
+	 * @return a stolen packet, or NULL if no victim had work
+	 */
+	MM_Packet *stealPacket(MM_EnvironmentBase *env, PacketDeque *deque);
+
+	/**
+	 * @return true if any deque contains at least one packet
+	 */
+	bool dequeWorkAvailable();
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_WorkPacketsWorkStealing *newInstance(MM_EnvironmentBase *env);
+
+	virtual MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
+	virtual void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	virtual bool inputPacketAvailable(MM_EnvironmentBase *env);
+	virtual void resetAllPackets(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a WorkPackets object.
+	 */
+	MM_WorkPacketsWorkStealing(MM_EnvironmentBase *env)
+		: MM_WorkPacketsStandard(env)
+		, _deques(NULL)
+		, _dequeCount(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* WORKPACKETSWORKSTEALING_HPP_ */
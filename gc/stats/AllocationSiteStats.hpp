@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(ALLOCATIONSITESTATS_HPP_)
+#define ALLOCATIONSITESTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+#define ALLOCATION_SITE_SAMPLE_BUFFER_SIZE 32
+#define ALLOCATION_SITE_STATS_SIZE 256
+
+/**
+ * Allocation samples taken at one allocation site.
+ * @ingroup GC_Stats
+ */
+struct MM_AllocationSiteSample {
+	const void *site; /**< Key of the allocating method (as inserted in the method dictionary), NULL if unknown */
+	uintptr_t bytes; /**< Bytes allocated at the site, estimated as the sampling interval each sample stands for */
+	uintptr_t samples; /**< Number of samples taken at the site, zero if the entry is unused */
+};
+
+/**
+ * Per-thread table of allocation samples, keyed by allocation site.
+ * Samples are only added by the owning thread, and the table is only drained while the owning thread is stopped
+ * for a collection (see MM_Collector::preCollect()), so neither side needs locks or atomic operations.
+ * @ingroup GC_Stats
+ */
+class MM_AllocationSiteSampleBuffer
+{
+private:
+	MM_AllocationSiteSample _entries[ALLOCATION_SITE_SAMPLE_BUFFER_SIZE];
+
+public:
+	uintptr_t _droppedBytes; /**< Sampled bytes of sites that did not fit in the table */
+	uintptr_t _droppedSamples; /**< Samples of sites that did not fit in the table */
+
+	MMINLINE void
+	add(const void *site, uintptr_t bytes)
+	{
+		uintptr_t start = ((uintptr_t)site >> 3) % ALLOCATION_SITE_SAMPLE_BUFFER_SIZE;
+		for (uintptr_t probe = 0; probe < ALLOCATION_SITE_SAMPLE_BUFFER_SIZE; probe++) {
+			MM_AllocationSiteSample *entry = &_entries[(start + probe) % ALLOCATION_SITE_SAMPLE_BUFFER_SIZE];
+			if (0 == entry->samples) {
+				entry->site = site;
+				entry->bytes = bytes;
+				entry->samples = 1;
+				return;
+			}
+			if (site == entry->site) {
+				entry->bytes += bytes;
+				entry->samples += 1;
+				return;
+			}
+		}
+		_droppedBytes += bytes;
+		_droppedSamples += 1;
+	}
+
+	MMINLINE MM_AllocationSiteSample *getEntry(uintptr_t index) { return &_entries[index]; }
+
+	MMINLINE void
+	clear()
+	{
+		for (uintptr_t i = 0; i < ALLOCATION_SITE_SAMPLE_BUFFER_SIZE; i++) {
+			_entries[i].site = NULL;
+			_entries[i].bytes = 0;
+			_entries[i].samples = 0;
+		}
+		_droppedBytes = 0;
+		_droppedSamples = 0;
+	}
+
+	MM_AllocationSiteSampleBuffer()
+	{
+		clear();
+	}
+};
+
+/**
+ * Allocation samples of all threads, aggregated per allocation site since the previous report.
+ * Sites are kept with the space-saving algorithm: once the table is full, a new site replaces the site with the
+ * fewest bytes and inherits its count, so heavy sites are retained and their bytes are never underestimated.
+ * @ingroup GC_Stats
+ */
+class MM_AllocationSiteStats : public MM_Base
+{
+private:
+	MM_AllocationSiteSample _entries[ALLOCATION_SITE_STATS_SIZE];
+	uintptr_t _entryCount; /**< Number of entries in use, they are kept at the front of the table */
+
+public:
+	uintptr_t _sampledBytes; /**< Total bytes represented by the samples, including those of dropped sites */
+	uintptr_t _samples; /**< Total number of samples, including those of dropped sites */
+
+	/**
+	 * Drain a thread's sample buffer into the receiver and clear it.
+	 */
+	void
+	merge(MM_AllocationSiteSampleBuffer *buffer)
+	{
+		for (uintptr_t i = 0; i < ALLOCATION_SITE_SAMPLE_BUFFER_SIZE; i++) {
+			MM_AllocationSiteSample *sample = buffer->getEntry(i);
+			if (0 != sample->samples) {
+				add(sample);
+			}
+		}
+		_sampledBytes += buffer->_droppedBytes;
+		_samples += buffer->_droppedSamples;
+		buffer->clear();
+	}
+
+	/**
+	 * Order the entries by decreasing bytes, so the heaviest sites come first.
+	 */
+	void
+	sort()
+	{
+		for (uintptr_t i = 1; i < _entryCount; i++) {
+			MM_AllocationSiteSample entry = _entries[i];
+			uintptr_t j = i;
+			while ((j > 0) && (_entries[j - 1].bytes < entry.bytes)) {
+				_entries[j] = _entries[j - 1];
+				j -= 1;
+			}
+			_entries[j] = entry;
+		}
+	}
+
+	MMINLINE uintptr_t getEntryCount() { return _entryCount; }
+	MMINLINE MM_AllocationSiteSample *getEntry(uintptr_t index) { return &_entries[index]; }
+
+	void
+	clear()
+	{
+		_entryCount = 0;
+		_sampledBytes = 0;
+		_samples = 0;
+	}
+
+	MM_AllocationSiteStats()
+		: MM_Base()
+	{
+		clear();
+	}
+
+private:
+	void
+	add(MM_AllocationSiteSample *sample)
+	{
+		_sampledBytes += sample->bytes;
+		_samples += sample->samples;
+
+		MM_AllocationSiteSample *minimum = NULL;
+		for (uintptr_t i = 0; i < _entryCount; i++) {
+			MM_AllocationSiteSample *entry = &_entries[i];
+			if (sample->site == entry->site) {
+				entry->bytes += sample->bytes;
+				entry->samples += sample->samples;
+				return;
+			}
+			if ((NULL == minimum) || (entry->bytes < minimum->bytes)) {
+				minimum = entry;
+			}
+		}
+
+		if (_entryCount < ALLOCATION_SITE_STATS_SIZE) {
+			_entries[_entryCount] = *sample;
+			_entryCount += 1;
+		} else {
+			minimum->site = sample->site;
+			minimum->bytes += sample->bytes;
+			minimum->samples += sample->samples;
+		}
+	}
+};
+
+#endif /* ALLOCATIONSITESTATS_HPP_ */
@@ -42,6 +42,7 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhWastedBytes; 			/**< The amount of unused TLH memory (current remainders and abandoned lists) dropped when caches were flushed. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -96,6 +97,7 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhWastedBytes(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
@@ -40,6 +40,10 @@ MM_CompactStats::clear()
 	_movedBytes = 0;
 	
 	_fixupObjects = 0;
+	_incrementalSubAreas = 0;
+	_incrementalCompactedSubAreas = 0;
+	_incrementalDenseSubAreas = 0;
+	_incrementalLeastGarbage = 100;
 	_setupStartTime = 0;
 	_setupEndTime = 0;
 	_moveStartTime = 0;
@@ -56,6 +60,10 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_movedObjects += statsToMerge->_movedObjects;
 	_movedBytes += statsToMerge->_movedBytes;
 	_fixupObjects += statsToMerge->_fixupObjects;
+	_incrementalSubAreas += statsToMerge->_incrementalSubAreas;
+	_incrementalCompactedSubAreas += statsToMerge->_incrementalCompactedSubAreas;
+	_incrementalDenseSubAreas += statsToMerge->_incrementalDenseSubAreas;
+	_incrementalLeastGarbage = OMR_MIN(_incrementalLeastGarbage, statsToMerge->_incrementalLeastGarbage);
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
@@ -50,6 +50,10 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _incrementalSubAreas; /**< subAreas which an incremental compaction could have compacted (0 unless the compaction was incremental) */
+	uintptr_t _incrementalCompactedSubAreas; /**< subAreas an incremental compaction selected within its budget */
+	uintptr_t _incrementalDenseSubAreas; /**< subAreas an incremental compaction left in place because less of them than -Xgc:incrementalCompactionGarbageThreshold= was free */
+	uintptr_t _incrementalLeastGarbage; /**< lowest percentage free of the subAreas an incremental compaction selected (100 if none was selected) */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
@@ -71,6 +71,11 @@ private:
 	uint64_t 				_ticksOutsideGC[RATIO_RESIZE_HISTORIES];
 	bool					_excludeCurrentGCTimeFromStats;
 
+	uintptr_t				_lastReleasedFreePagesSize; /**< bytes of free memory decommitted by the last release of free heap pages */
+	uint64_t				_totalReleasedFreePagesSize; /**< bytes of free memory decommitted by all releases of free heap pages */
+	uintptr_t				_committedBytesAfterRelease; /**< heap memory left committed after free heap pages were last released (active heap less the free memory decommitted) */
+	uint64_t				_residentBytesAfterRelease; /**< physical memory of the process after free heap pages were last released */
+
 protected:
 public:
 
@@ -179,6 +184,24 @@ public:
 	MMINLINE void setExcludeCurrentGCTimeFromStats() { _excludeCurrentGCTimeFromStats = TRUE; }
 	MMINLINE bool getExcludeCurrentGCTimeFromStats() { return _excludeCurrentGCTimeFromStats; }
 
+	/**
+	 * Record a release of free heap pages.
+	 * @param size bytes of free memory decommitted by the release
+	 * @param activeBytes active heap size at the time of the release
+	 * @param residentBytes physical memory of the process sampled after the release
+	 */
+	MMINLINE void setReleasedFreePages(uintptr_t size, uintptr_t activeBytes, uint64_t residentBytes)
+	{
+		_lastReleasedFreePagesSize = size;
+		_totalReleasedFreePagesSize += size;
+		_committedBytesAfterRelease = activeBytes - size;
+		_residentBytesAfterRelease = residentBytes;
+	}
+	MMINLINE uintptr_t getLastReleasedFreePagesSize() { return _lastReleasedFreePagesSize; }
+	MMINLINE uint64_t getTotalReleasedFreePagesSize() { return _totalReleasedFreePagesSize; }
+	MMINLINE uintptr_t getCommittedBytesAfterRelease() { return _committedBytesAfterRelease; }
+	MMINLINE uint64_t getResidentBytesAfterRelease() { return _residentBytesAfterRelease; }
+
 	MM_HeapResizeStats() :
 		MM_Base(),
 		_lastAFEndTime(0),
@@ -196,7 +219,11 @@ public:
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
 		_globalGCCountAtAF(0),
-		_excludeCurrentGCTimeFromStats(true)
+		_excludeCurrentGCTimeFromStats(true),
+		_lastReleasedFreePagesSize(0),
+		_totalReleasedFreePagesSize(0),
+		_committedBytesAfterRelease(0),
+		_residentBytesAfterRelease(0)
 	{
 		resetRatioTicks();
 	}
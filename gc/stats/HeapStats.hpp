@@ -45,6 +45,12 @@ public:
 	uintptr_t _activeFreeEntryCount;
 	uintptr_t _inactiveFreeEntryCount;
 
+	uintptr_t _sizeClassCacheAllocCount; /**< Allocations (included in _allocCount) satisfied by free entry size class caches */
+	uintptr_t _sizeClassCacheAllocBytes; /**< Bytes (included in _allocBytes) allocated from free entry size class caches */
+
+	uintptr_t _numaLocalTLHAllocCount; /**< TLH allocations served from a free list of the allocating thread's NUMA node */
+	uintptr_t _numaRemoteTLHAllocCount; /**< TLH allocations by threads with a known NUMA node served from another node's free list */
+
 	/**
 	 * Create a HeapStats object.
 	 */   
@@ -56,7 +62,11 @@ public:
 		_allocSearchCount(0),
 		_lastFreeBytes(0),
 		_activeFreeEntryCount(0),
-		_inactiveFreeEntryCount(0)
+		_inactiveFreeEntryCount(0),
+		_sizeClassCacheAllocCount(0),
+		_sizeClassCacheAllocBytes(0),
+		_numaLocalTLHAllocCount(0),
+		_numaRemoteTLHAllocCount(0)
 	{};
 };
 
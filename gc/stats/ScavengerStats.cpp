@@ -34,6 +34,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	_gcCount(UDATA_MAX)
 	,_rememberedSetOverflow(0)
 	,_causedRememberedSetOverflow(0)
+	,_rememberedSetOverflowCardsWalked(0)
+	,_rememberedSetOverflowHeapWalks(0)
 	,_scanCacheOverflow(0)
 	,_scanCacheAllocationFromHeap(0)
 	,_scanCacheAllocationDurationDuringSavenger(0)
@@ -80,6 +82,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureDiscardBytes(0)
 	,_survivorTLHRemainderCount(0)
 	,_tenureTLHRemainderCount(0)
+	,_hotFieldSampledObjects(0)
+	,_hotFieldCoLocatedCount(0)
 	,_semiSpaceAllocBytesAcumulation(0)
 	,_tenureSpaceAllocBytesAcumulation(0)
 	,_semiSpaceAllocationCountLarge(0)
@@ -137,6 +141,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	
 	_rememberedSetOverflow = 0;
 	_causedRememberedSetOverflow = 0;
+	_rememberedSetOverflowCardsWalked = 0;
+	_rememberedSetOverflowHeapWalks = 0;
 	_scanCacheOverflow = 0;
 	_scanCacheAllocationFromHeap = 0;
 	_scanCacheAllocationDurationDuringSavenger = 0;
@@ -185,6 +191,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_survivorTLHRemainderCount = 0;
 	_tenureTLHRemainderCount = 0;
 
+	_hotFieldSampledObjects = 0;
+	_hotFieldCoLocatedCount = 0;
+
 	_semiSpaceAllocationCountLarge = 0;
 	_semiSpaceAllocationCountSmall = 0;
 	_tenureSpaceAllocationCountLarge = 0;
@@ -57,6 +57,8 @@ public:
 	uintptr_t _gcCount;  /**< Count of the number of GC cycles that have occurred */
 	uintptr_t _rememberedSetOverflow;
 	uintptr_t _causedRememberedSetOverflow;
+	uintptr_t _rememberedSetOverflowCardsWalked; /**< Overflow cards walked to find remembered objects while the remembered set was in overflow */
+	uintptr_t _rememberedSetOverflowHeapWalks; /**< Walks of all of tenure space to find remembered objects while the remembered set was in overflow */
 	uintptr_t _scanCacheOverflow;
 	uintptr_t _scanCacheAllocationFromHeap;
 	uint64_t  _scanCacheAllocationDurationDuringSavenger;
@@ -129,6 +131,9 @@ public:
 	uintptr_t _survivorTLHRemainderCount;
 	uintptr_t _tenureTLHRemainderCount;
 
+	uintptr_t _hotFieldSampledObjects; /**< Objects whose child slots were sampled for hot field co-location */
+	uintptr_t _hotFieldCoLocatedCount; /**< Children copied immediately after their parent by hot field co-location */
+
 	uintptr_t _semiSpaceAllocBytesAcumulation; /**< Bytes allocated in new space between scavenges, updated on global collects. */
 	uintptr_t _tenureSpaceAllocBytesAcumulation; /**< Bytes allocated in tenure space between scavenges, updated on global collects. */
 
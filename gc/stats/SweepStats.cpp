@@ -35,6 +35,12 @@
 void
 MM_SweepStats::clear()
 {
+	_lazySweepChunks = 0;
+	_lazySweepChunksDeferred = 0;
+	_sweepIncrements = 0;
+	_sweepIncrementsOverBudget = 0;
+	_sweepRegionsReturned = 0;
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -49,6 +55,10 @@ MM_SweepStats::clear()
 void
 MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 {
+	_sweepIncrements += statsToMerge->_sweepIncrements;
+	_sweepIncrementsOverBudget += statsToMerge->_sweepIncrementsOverBudget;
+	_sweepRegionsReturned += statsToMerge->_sweepRegionsReturned;
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal += statsToMerge->sweepHeapBytesTotal;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
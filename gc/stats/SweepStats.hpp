@@ -52,6 +52,12 @@ public:
 	uintptr_t sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	uintptr_t _lazySweepChunks; /**< Number of chunks a lazy sweep (-Xgc:lazySweep) assigned to the heap, 0 when not sweeping lazily */
+	uintptr_t _lazySweepChunksDeferred; /**< Number of those chunks left unswept at the end of the pause, for allocation to sweep on demand */
+	uintptr_t _sweepIncrements; /**< Number of segregated small region sweep increments, 0 when the heap is not segregated */
+	uintptr_t _sweepIncrementsOverBudget; /**< Number of those increments ended early by the -Xgc:sweepIncrementMicro= budget */
+	uintptr_t _sweepRegionsReturned; /**< Number of regions the increments ended early returned unswept to the sweep queues */
+
 	uint64_t _startTime;	/**< Sweep start time */
 	uint64_t _endTime;		/**< Sweep end time */
 
@@ -52,6 +52,11 @@ public:
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
 	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting for all other threads to complete working */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	uintptr_t _stealAttempts; /**< The number of times the thread probed another thread's work-stealing deque (-Xgc:workStealingMarking only) */
+	uintptr_t _stealCount; /**< The number of packets the thread successfully stole from other threads (-Xgc:workStealingMarking only) */
+	uintptr_t _idleCount; /**< The number of times the thread found no local, stealable or shared work (-Xgc:workStealingMarking only) */
+	uintptr_t _nodeLocalPops; /**< The number of packets the thread took from a packet sublist of its own NUMA node (-Xgc:numaAwareParallelGC only) */
+	uintptr_t _nodeRemotePops; /**< The number of packets the thread took from a packet sublist of another NUMA node (-Xgc:numaAwareParallelGC only) */
 
 protected:
 private:
@@ -65,6 +70,11 @@ public:
 		_stwWorkStackOverflowCount = 0;
 		_stwWorkStackOverflowOccured = false;
 		_stwWorkpacketCountAtOverflow = 0;
+		_stealAttempts = 0;
+		_stealCount = 0;
+		_idleCount = 0;
+		_nodeLocalPops = 0;
+		_nodeRemotePops = 0;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		_workStallCount = 0;
 		_completeStallCount = 0;
@@ -81,6 +91,11 @@ public:
 		_stwWorkStackOverflowCount += statsToMerge->_stwWorkStackOverflowCount;
 		_stwWorkStackOverflowOccured = (_stwWorkStackOverflowOccured || statsToMerge->_stwWorkStackOverflowOccured);
 		_stwWorkpacketCountAtOverflow = OMR_MAX(_stwWorkpacketCountAtOverflow, statsToMerge->_stwWorkpacketCountAtOverflow);
+		_stealAttempts += statsToMerge->_stealAttempts;
+		_stealCount += statsToMerge->_stealCount;
+		_idleCount += statsToMerge->_idleCount;
+		_nodeLocalPops += statsToMerge->_nodeLocalPops;
+		_nodeRemotePops += statsToMerge->_nodeRemotePops;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		/* It may not ever be useful to merge these stats, but do it anyways */
@@ -151,6 +166,11 @@ public:
 		,_completeStallCount(0)
 		,_workStallTime(0)
 		,_completeStallTime(0)
+		,_stealAttempts(0)
+		,_stealCount(0)
+		,_idleCount(0)
+		,_nodeLocalPops(0)
+		,_nodeRemotePops(0)
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
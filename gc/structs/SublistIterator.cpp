@@ -42,6 +42,8 @@ GC_SublistIterator::nextList()
 	if(NULL != _currentPuddle) {
 		_currentPuddle = _currentPuddle->_next;
 	} else {
+		/* puddles handed back after processing are only visible once spliced into the list */
+		_sublistPool->reclaimProcessedPuddles();
 		_currentPuddle = _sublistPool->_list;
 	}
 	
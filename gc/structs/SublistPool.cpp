@@ -66,7 +66,7 @@ MM_SublistPool::tearDown(MM_EnvironmentBase *env)
 
 	/* Free all puddles associated to the sublist */
 	freePuddles(env, _list);
-	freePuddles(env, _previousList);
+	freePreviousPuddles(env);
 }
 
 void
@@ -82,6 +82,17 @@ MM_SublistPool::freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list)
 	}
 }
 
+void
+MM_SublistPool::freePreviousPuddles(MM_EnvironmentBase *env)
+{
+	for (uintptr_t shard = 0; shard < SUBLIST_POOL_PROCESSING_SHARDS; shard++) {
+		freePuddles(env, _previousShards[shard]);
+		_previousShards[shard] = NULL;
+	}
+	freePuddles(env, _processedList);
+	_processedList = NULL;
+}
+
 /**
  * Allocate a new puddle for the current sublist pool.
  * 
@@ -280,6 +291,8 @@ MM_SublistPool::compact(MM_EnvironmentBase *env)
 	MM_SublistPuddle *sourcePuddle, *destinationPuddle;
 	MM_SublistPuddle *lastPuddle = NULL;
 
+	reclaimProcessedPuddles();
+
 	/* Use the list of puddles to iterate through and reset the list pointer to NULL
 	 * as we will add puddles back
 	 */
@@ -392,11 +405,10 @@ MM_SublistPool::clear(MM_EnvironmentBase *env)
 
 	/* Free the puddles and reset the lists to NULL */
 	freePuddles(env, _list);
-	freePuddles(env, _previousList);
+	freePreviousPuddles(env);
 
 	_list = NULL;
 	_allocPuddle = NULL;
-	_previousList = NULL;
 	_count = 0;
 }
 
@@ -414,8 +426,9 @@ MM_SublistPool::countElements()
 void
 MM_SublistPool::startProcessingSublist() 
 {
-	Assert_MM_true(NULL == _previousList);
-	_previousList = _list;
+	reclaimProcessedPuddles();
+
+	MM_SublistPuddle *previousList = _list;
 
 	MM_SublistPuddle* tail = _allocPuddle;
 	if (NULL == tail) {
@@ -429,36 +442,87 @@ MM_SublistPool::startProcessingSublist()
 		/* if there is an _allocPuddle it must be empty at this point */
 		Assert_MM_true( (NULL == _allocPuddle) || (_allocPuddle->isEmpty()) ); 
 	}
+
+	/* deal the previous puddles round robin, so that threads starting on different shards do not contend */
+	uintptr_t shard = 0;
+	while (NULL != previousList) {
+		MM_SublistPuddle *puddle = previousList;
+		previousList = puddle->getNext();
+		puddle->setNext(_previousShards[shard]);
+		_previousShards[shard] = puddle;
+		shard = (shard + 1) % SUBLIST_POOL_PROCESSING_SHARDS;
+	}
 }
 
-MM_SublistPuddle *
-MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
+void
+MM_SublistPool::stopProcessingSublist()
 {
-	omrthread_monitor_enter(_mutex);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = popPreviousPuddle(puddle))) {
+		/* hand each unprocessed puddle straight back */
+	}
+	reclaimProcessedPuddles();
+}
 
-	/* return returnedPuddle to the list of used puddles */
+MM_SublistPuddle *
+MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle, uintptr_t shardHint)
+{
+	/* push returnedPuddle onto the processed list. Puddles are never pushed back onto the
+	 * shards while they are being processed, so popping from the shards below is free of ABA.
+	 */
 	if (NULL != returnedPuddle) {
 		Assert_MM_true(NULL == returnedPuddle->getNext());
-		returnedPuddle->setNext(_list);
-		_list = returnedPuddle;
+		MM_SublistPuddle *head = NULL;
+		do {
+			head = _processedList;
+			returnedPuddle->setNext(head);
+		} while ((uintptr_t)head != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_processedList, (uintptr_t)head, (uintptr_t)returnedPuddle));
+	}
+
+	/* pop an element from the preferred shard, or steal one from the others */
+	for (uintptr_t i = 0; i < SUBLIST_POOL_PROCESSING_SHARDS; i++) {
+		MM_SublistPuddle * volatile *shardHead = &_previousShards[(shardHint + i) % SUBLIST_POOL_PROCESSING_SHARDS];
+		MM_SublistPuddle *result = NULL;
+		while (NULL != (result = *shardHead)) {
+			MM_SublistPuddle *next = result->getNext();
+			if ((uintptr_t)result == MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)shardHead, (uintptr_t)result, (uintptr_t)next)) {
+				result->setNext(NULL);
+				return result;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+void
+MM_SublistPool::reclaimProcessedPuddles()
+{
+	omrthread_monitor_enter(_mutex);
+
+	MM_SublistPuddle *head = NULL;
+	do {
+		head = _processedList;
+	} while ((NULL != head) && ((uintptr_t)head != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_processedList, (uintptr_t)head, (uintptr_t)NULL)));
+
+	if (NULL != head) {
+		MM_SublistPuddle *tail = head;
+		while (NULL != tail->getNext()) {
+			tail = tail->getNext();
+		}
+
+		/* return the processed puddles to the head of the list of used puddles */
+		tail->setNext(_list);
+		_list = head;
 
 		/* It's illegal to have a non-empty list without an _allocPuddle. If 
-		 * this is the only puddle in the pool, make it the _allocPuddle. 
+		 * these are the only puddles in the pool, the last of them is the _allocPuddle. 
 		 */
 		if (NULL == _allocPuddle) {
-			_allocPuddle = returnedPuddle;
+			_allocPuddle = tail;
 			Assert_MM_true(NULL == _allocPuddle->getNext());
 		}
 	}
 
-	/* pop an element from the previous list */
-	MM_SublistPuddle *result = _previousList;
-	if (NULL != result) {
-		_previousList = result->getNext();
-		result->setNext(NULL);
-	}
-	
 	omrthread_monitor_exit(_mutex);
-	
-	return result;
 }
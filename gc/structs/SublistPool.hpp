@@ -42,6 +42,9 @@ class MM_SublistPuddle;
 
 class GC_SublistIterator;
 
+/* Number of shards the puddles of a sublist are dealt into by MM_SublistPool::startProcessingSublist() */
+#define SUBLIST_POOL_PROCESSING_SHARDS 16
+
 /**
  * A thread-safe growable list that supports batch-reservation of uintptr_t-sized elements.
  * An MM_SublistPool is a pool of memory which consists of a linked list of zero or 
@@ -64,7 +67,8 @@ private:
 	volatile uintptr_t _count; /**< A count for number of elements across all sublistPuddles */
 	OMR::GC::AllocationCategory::Enum _allocCategory;
 	
-	MM_SublistPuddle *_previousList; /**< A list of the non-empty puddles when #startProcessingSublist() was called */
+	MM_SublistPuddle * volatile _previousShards[SUBLIST_POOL_PROCESSING_SHARDS]; /**< The non-empty puddles when #startProcessingSublist() was called, dealt round robin into shards */
+	MM_SublistPuddle * volatile _processedList; /**< Puddles handed back to #popPreviousPuddle(), spliced back into the pool by #reclaimProcessedPuddles() */
 	
 protected:
 public:
@@ -75,6 +79,7 @@ public:
 private:
 	MM_SublistPuddle *createNewPuddle(MM_EnvironmentBase *env);
 	void freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list);
+	void freePreviousPuddles(MM_EnvironmentBase *env);
 
 protected:
 public:
@@ -112,19 +117,34 @@ public:
 	
 	/**
 	 * Prepare to process this sublist by moving all of its non-empty puddles onto
-	 * the list of previous puddles. The puddles may be retrieved by calling #popPreviousPuddle().
+	 * the shards of previous puddles. The puddles may be retrieved by calling #popPreviousPuddle().
 	 */
 	void startProcessingSublist();
 
 	/**
-	 * Pop a puddle from the list of puddles which were active when #startProcessingSublist() was called.
-	 * Return returnedPuddle to the list of puddles. It should be a puddle returned by a previous call to this function. 
-	 * This is protected by a lock, so may safely be called by multiple threads.
+	 * Return any previous puddles which have not been popped since #startProcessingSublist() was called
+	 * to the pool, without processing them. Not thread safe.
+	 */
+	void stopProcessingSublist();
+
+	/**
+	 * Pop a puddle from the puddles which were active when #startProcessingSublist() was called.
+	 * Return returnedPuddle to the pool. It should be a puddle returned by a previous call to this function.
+	 * Puddles are popped from the shard selected by shardHint first and stolen from the other shards once
+	 * it is empty. Both operations are lock free, so may safely be called by multiple threads.
 	 * 
 	 * @param emptyPuddle[in] a puddle which has already been processed, or NULL
-	 * @return a puddle to process, or NULL if the list is empty
+	 * @param shardHint[in] preferred shard, typically the worker ID of the calling thread
+	 * @return a puddle to process, or NULL if all shards are empty
 	 */
-	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle);
+	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle, uintptr_t shardHint = 0);
+
+	/**
+	 * Splice puddles returned to #popPreviousPuddle() back into the list of used puddles. Called
+	 * implicitly before the pool is iterated, compacted or processed again.
+	 * This is protected by a lock, so may safely be called by multiple threads.
+	 */
+	void reclaimProcessedPuddles();
 	
 	MM_SublistPool() 
 		: _list(NULL)
@@ -135,8 +155,12 @@ public:
 		, _maxSize(0)
 		, _count(0)
 		, _allocCategory(OMR::GC::AllocationCategory::OTHER)
-		, _previousList(NULL)
-	{}
+		, _processedList(NULL)
+	{
+		for (uintptr_t shard = 0; shard < SUBLIST_POOL_PROCESSING_SHARDS; shard++) {
+			_previousShards[shard] = NULL;
+		}
+	}
 
 	friend class GC_SublistIterator;
 };
@@ -0,0 +1,829 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseBinaryFormat.hpp"
+
+#include <string.h>
+
+#define VERBOSE_BINARY_MAX_RENDERED_VALUE 32
+#define VERBOSE_BINARY_TIMESTAMP_LENGTH 23
+#define VERBOSE_BINARY_MAX_DECIMAL_SCALE 9
+#define VERBOSE_BINARY_MAX_DECIMAL_DIGITS 18
+#define VERBOSE_BINARY_MAX_UNSIGNED_DIGITS 19
+#define VERBOSE_BINARY_MAX_HEX_DIGITS 16
+#define VERBOSE_BINARY_MAX_NAME_LENGTH 255
+#define VERBOSE_BINARY_INDENT_CHUNK 64
+
+static uint8_t *
+writeVarint(uint8_t *cursor, uint64_t value)
+{
+	while (value >= 0x80) {
+		*cursor++ = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	*cursor++ = (uint8_t)value;
+	return cursor;
+}
+
+/**
+ * @return cursor after the varint, or NULL if the varint is truncated or too long
+ */
+static const uint8_t *
+readVarint(const uint8_t *cursor, const uint8_t *end, uint64_t *value)
+{
+	uint64_t result = 0;
+	for (uintptr_t shift = 0; (cursor < end) && (shift < (7 * VERBOSE_BINARY_MAX_VARINT_LENGTH)); shift += 7) {
+		uint8_t byte = *cursor++;
+		result |= ((uint64_t)(byte & 0x7F)) << shift;
+		if (0 == (byte & 0x80)) {
+			*value = result;
+			return cursor;
+		}
+	}
+	return NULL;
+}
+
+static uint8_t *
+writeBytes(uint8_t *cursor, const char *text, uintptr_t length)
+{
+	cursor = writeVarint(cursor, length);
+	memcpy(cursor, text, length);
+	return cursor + length;
+}
+
+static bool
+isNameChar(char c)
+{
+	return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) || ('-' == c) || ('_' == c) || (':' == c) || ('.' == c);
+}
+
+static bool
+isDigit(char c)
+{
+	return (c >= '0') && (c <= '9');
+}
+
+static uintptr_t
+renderUnsigned(uint64_t value, char *buffer)
+{
+	char digits[VERBOSE_BINARY_MAX_RENDERED_VALUE];
+	uintptr_t count = 0;
+	do {
+		digits[count++] = (char)('0' + (value % 10));
+		value /= 10;
+	} while (0 != value);
+	for (uintptr_t i = 0; i < count; i++) {
+		buffer[i] = digits[count - 1 - i];
+	}
+	return count;
+}
+
+static uintptr_t
+renderHex(uint64_t value, char *buffer)
+{
+	static const char hexDigits[] = "0123456789abcdef";
+	char digits[VERBOSE_BINARY_MAX_RENDERED_VALUE];
+	uintptr_t count = 0;
+	do {
+		digits[count++] = hexDigits[value & 0xF];
+		value >>= 4;
+	} while (0 != value);
+	buffer[0] = '0';
+	buffer[1] = 'x';
+	for (uintptr_t i = 0; i < count; i++) {
+		buffer[2 + i] = digits[count - 1 - i];
+	}
+	return count + 2;
+}
+
+static uintptr_t
+renderDecimal(uint64_t digits, uintptr_t scale, char *buffer)
+{
+	uint64_t divisor = 1;
+	for (uintptr_t i = 0; i < scale; i++) {
+		divisor *= 10;
+	}
+	uintptr_t length = renderUnsigned(digits / divisor, buffer);
+	buffer[length++] = '.';
+	uint64_t fraction = digits % divisor;
+	for (uintptr_t i = scale; i > 0; i--) {
+		buffer[length + i - 1] = (char)('0' + (fraction % 10));
+		fraction /= 10;
+	}
+	return length + scale;
+}
+
+static void
+renderFixedDigits(uint64_t value, uintptr_t count, char *buffer)
+{
+	for (uintptr_t i = count; i > 0; i--) {
+		buffer[i - 1] = (char)('0' + (value % 10));
+		value /= 10;
+	}
+}
+
+/**
+ * Render milliseconds since the epoch as yyyy-mm-ddThh:mm:ss.mmm (days to civil date conversion
+ * for the proleptic Gregorian calendar).
+ */
+static uintptr_t
+renderTimestamp(uint64_t millis, char *buffer)
+{
+	int64_t days = (int64_t)(millis / 86400000) + 719468;
+	uint64_t millisOfDay = millis % 86400000;
+	int64_t era = days / 146097;
+	int64_t dayOfEra = days - (era * 146097);
+	int64_t yearOfEra = (dayOfEra - (dayOfEra / 1460) + (dayOfEra / 36524) - (dayOfEra / 146096)) / 365;
+	int64_t dayOfYear = dayOfEra - ((365 * yearOfEra) + (yearOfEra / 4) - (yearOfEra / 100));
+	int64_t monthIndex = ((5 * dayOfYear) + 2) / 153;
+	int64_t day = dayOfYear - (((153 * monthIndex) + 2) / 5) + 1;
+	int64_t month = monthIndex + ((monthIndex < 10) ? 3 : -9);
+	int64_t year = yearOfEra + (era * 400) + ((month <= 2) ? 1 : 0);
+
+	renderFixedDigits((uint64_t)year, 4, buffer);
+	buffer[4] = '-';
+	renderFixedDigits((uint64_t)month, 2, buffer + 5);
+	buffer[7] = '-';
+	renderFixedDigits((uint64_t)day, 2, buffer + 8);
+	buffer[10] = 'T';
+	renderFixedDigits(millisOfDay / 3600000, 2, buffer + 11);
+	buffer[13] = ':';
+	renderFixedDigits((millisOfDay / 60000) % 60, 2, buffer + 14);
+	buffer[16] = ':';
+	renderFixedDigits((millisOfDay / 1000) % 60, 2, buffer + 17);
+	buffer[19] = '.';
+	renderFixedDigits(millisOfDay % 1000, 3, buffer + 20);
+	return VERBOSE_BINARY_TIMESTAMP_LENGTH;
+}
+
+static bool
+parseDigits(const char *text, uintptr_t length, uint64_t *value)
+{
+	uint64_t result = 0;
+	for (uintptr_t i = 0; i < length; i++) {
+		if (!isDigit(text[i])) {
+			return false;
+		}
+		result = (result * 10) + (uint64_t)(text[i] - '0');
+	}
+	*value = result;
+	return true;
+}
+
+/*
+ * Each parser only accepts text which renders back identically, so that decoding is exact.
+ */
+
+static bool
+parseUnsigned(const char *text, uintptr_t length, uint64_t *value)
+{
+	char rendered[VERBOSE_BINARY_MAX_RENDERED_VALUE];
+	return (0 < length) && (length <= VERBOSE_BINARY_MAX_UNSIGNED_DIGITS)
+		&& parseDigits(text, length, value)
+		&& (length == renderUnsigned(*value, rendered)) && (0 == memcmp(text, rendered, length));
+}
+
+static bool
+parseHex(const char *text, uintptr_t length, uint64_t *value)
+{
+	char rendered[VERBOSE_BINARY_MAX_RENDERED_VALUE];
+	if ((length < 3) || (length > (VERBOSE_BINARY_MAX_HEX_DIGITS + 2)) || ('0' != text[0]) || ('x' != text[1])) {
+		return false;
+	}
+	uint64_t result = 0;
+	for (uintptr_t i = 2; i < length; i++) {
+		char c = text[i];
+		if (isDigit(c)) {
+			result = (result << 4) | (uint64_t)(c - '0');
+		} else if ((c >= 'a') && (c <= 'f')) {
+			result = (result << 4) | (uint64_t)(c - 'a' + 10);
+		} else {
+			return false;
+		}
+	}
+	*value = result;
+	return (length == renderHex(result, rendered)) && (0 == memcmp(text, rendered, length));
+}
+
+static bool
+parseDecimal(const char *text, uintptr_t length, uint64_t *digits, uintptr_t *scale)
+{
+	char rendered[VERBOSE_BINARY_MAX_RENDERED_VALUE];
+	const char *point = (const char *)memchr(text, '.', length);
+	if ((NULL == point) || (point == text) || (length > (VERBOSE_BINARY_MAX_DECIMAL_DIGITS + 1))) {
+		return false;
+	}
+	uintptr_t integerLength = point - text;
+	uintptr_t fractionLength = length - integerLength - 1;
+	uint64_t integerPart = 0;
+	uint64_t fractionPart = 0;
+	if ((0 == fractionLength) || (fractionLength > VERBOSE_BINARY_MAX_DECIMAL_SCALE)
+		|| !parseDigits(text, integerLength, &integerPart) || !parseDigits(point + 1, fractionLength, &fractionPart)
+	) {
+		return false;
+	}
+	uint64_t result = integerPart;
+	for (uintptr_t i = 0; i < fractionLength; i++) {
+		result *= 10;
+	}
+	*digits = result + fractionPart;
+	*scale = fractionLength;
+	return (length == renderDecimal(*digits, *scale, rendered)) && (0 == memcmp(text, rendered, length));
+}
+
+static bool
+parseTimestamp(const char *text, uintptr_t length, uint64_t *millis)
+{
+	char rendered[VERBOSE_BINARY_MAX_RENDERED_VALUE];
+	uint64_t year = 0;
+	uint64_t month = 0;
+	uint64_t day = 0;
+	uint64_t hour = 0;
+	uint64_t minute = 0;
+	uint64_t second = 0;
+	uint64_t milli = 0;
+	if ((VERBOSE_BINARY_TIMESTAMP_LENGTH != length)
+		|| ('-' != text[4]) || ('-' != text[7]) || ('T' != text[10]) || (':' != text[13]) || (':' != text[16]) || ('.' != text[19])
+		|| !parseDigits(text, 4, &year) || !parseDigits(text + 5, 2, &month) || !parseDigits(text + 8, 2, &day)
+		|| !parseDigits(text + 11, 2, &hour) || !parseDigits(text + 14, 2, &minute) || !parseDigits(text + 17, 2, &second)
+		|| !parseDigits(text + 20, 3, &milli)
+		|| (year < 1970) || (month < 1) || (month > 12) || (day < 1) || (day > 31)
+	) {
+		return false;
+	}
+	/* civil date to days conversion, the inverse of renderTimestamp */
+	int64_t y = (int64_t)year - ((month <= 2) ? 1 : 0);
+	int64_t era = y / 400;
+	int64_t yearOfEra = y - (era * 400);
+	int64_t dayOfYear = ((153 * ((int64_t)month + ((month > 2) ? -3 : 9))) + 2) / 5 + (int64_t)day - 1;
+	int64_t dayOfEra = (yearOfEra * 365) + (yearOfEra / 4) - (yearOfEra / 100) + dayOfYear;
+	int64_t days = (era * 146097) + dayOfEra - 719468;
+	*millis = ((uint64_t)days * 86400000) + (hour * 3600000) + (minute * 60000) + (second * 1000) + milli;
+	return (0 == memcmp(text, rendered, renderTimestamp(*millis, rendered)));
+}
+
+void
+MM_VerboseBinaryDictionary::reset()
+{
+	_count = 0;
+	_poolUsed = 0;
+	memset(_hashTable, 0, sizeof(_hashTable));
+}
+
+uintptr_t
+MM_VerboseBinaryDictionary::hash(const char *text, uintptr_t length)
+{
+	uint32_t result = 2166136261U;
+	for (uintptr_t i = 0; i < length; i++) {
+		result = (result ^ (uint8_t)text[i]) * 16777619U;
+	}
+	return result;
+}
+
+intptr_t
+MM_VerboseBinaryDictionary::find(const char *text, uintptr_t length)
+{
+	uintptr_t mask = (sizeof(_hashTable) / sizeof(_hashTable[0])) - 1;
+	for (uintptr_t slot = hash(text, length) & mask; 0 != _hashTable[slot]; slot = (slot + 1) & mask) {
+		uintptr_t index = _hashTable[slot] - 1;
+		if ((_lengths[index] == length) && (0 == memcmp(_pool + _offsets[index], text, length))) {
+			return (intptr_t)index;
+		}
+	}
+	return -1;
+}
+
+intptr_t
+MM_VerboseBinaryDictionary::add(const char *text, uintptr_t length)
+{
+	if ((VERBOSE_BINARY_MAX_DICTIONARY_ENTRIES <= _count) || (VERBOSE_BINARY_MAX_NAME_LENGTH < length) || ((_poolUsed + length) > sizeof(_pool))) {
+		return -1;
+	}
+	uintptr_t index = _count;
+	_offsets[index] = (uint16_t)_poolUsed;
+	_lengths[index] = (uint8_t)length;
+	memcpy(_pool + _poolUsed, text, length);
+	_poolUsed += length;
+	_count += 1;
+
+	uintptr_t mask = (sizeof(_hashTable) / sizeof(_hashTable[0])) - 1;
+	uintptr_t slot = hash(text, length) & mask;
+	while (0 != _hashTable[slot]) {
+		slot = (slot + 1) & mask;
+	}
+	_hashTable[slot] = (uint16_t)(index + 1);
+	return (intptr_t)index;
+}
+
+bool
+MM_VerboseBinaryDictionary::hasRoomFor(uintptr_t entries, uintptr_t bytes)
+{
+	return ((_count + entries) <= VERBOSE_BINARY_MAX_DICTIONARY_ENTRIES) && ((_poolUsed + bytes) <= sizeof(_pool));
+}
+
+const char *
+MM_VerboseBinaryDictionary::get(uintptr_t index, uintptr_t *length)
+{
+	if (index >= _count) {
+		return NULL;
+	}
+	*length = _lengths[index];
+	return _pool + _offsets[index];
+}
+
+void
+MM_VerboseBinaryEncoder::reset()
+{
+	_names.reset();
+	_values.reset();
+	_lastTimestamp = 0;
+}
+
+uintptr_t
+MM_VerboseBinaryEncoder::encodeRecord(const char *text, uintptr_t length, uint8_t *output)
+{
+	/* encode the payload after room for the largest length prefix, then move it up behind the actual prefix */
+	uint8_t *payload = output + VERBOSE_BINARY_MAX_VARINT_LENGTH;
+	uintptr_t payloadLength = encodeText(text, length, payload) - payload;
+	uint8_t *cursor = writeVarint(output, payloadLength);
+	memmove(cursor, payload, payloadLength);
+	return (cursor - output) + payloadLength;
+}
+
+/**
+ * Check that text starts with a start tag the encoder can represent, "<name" followed by any number of
+ * " name=\"value\"" and one of ">", " />" or "/>", with room in the dictionary for all its names.
+ * @param[out] tagEnd the character after the tag
+ */
+bool
+MM_VerboseBinaryEncoder::parseElementStart(const char *text, const char *end, const char **tagEnd)
+{
+	uintptr_t newNames = 0;
+	uintptr_t newNameBytes = 0;
+	const char *cursor = text + 1;
+	for (bool elementName = true; ; elementName = false) {
+		const char *name = cursor;
+		while ((cursor < end) && isNameChar(*cursor)) {
+			cursor += 1;
+		}
+		uintptr_t nameLength = cursor - name;
+		if ((0 == nameLength) || (VERBOSE_BINARY_MAX_NAME_LENGTH < nameLength)) {
+			return false;
+		}
+		if (0 > _names.find(name, nameLength)) {
+			newNames += 1;
+			newNameBytes += nameLength;
+		}
+		if (!elementName) {
+			if (((end - cursor) < 2) || ('=' != cursor[0]) || ('"' != cursor[1])) {
+				return false;
+			}
+			const char *value = cursor + 2;
+			cursor = (const char *)memchr(value, '"', end - value);
+			if (NULL == cursor) {
+				return false;
+			}
+			cursor += 1;
+		}
+		if (cursor >= end) {
+			return false;
+		}
+		if ('>' == *cursor) {
+			*tagEnd = cursor + 1;
+			break;
+		}
+		if (((end - cursor) >= 2) && (0 == memcmp(cursor, "/>", 2))) {
+			*tagEnd = cursor + 2;
+			break;
+		}
+		if (((end - cursor) >= 3) && (0 == memcmp(cursor, " />", 3))) {
+			*tagEnd = cursor + 3;
+			break;
+		}
+		if ((' ' != *cursor) || ((cursor + 1) >= end) || !isNameChar(cursor[1])) {
+			return false;
+		}
+		cursor += 1;
+	}
+
+	/* a name repeated within the tag is counted more than once, which only errs on the safe side */
+	return _names.hasRoomFor(newNames, newNameBytes);
+}
+
+uint8_t *
+MM_VerboseBinaryEncoder::encodeName(uint8_t token, const char *name, uintptr_t length, uint8_t *cursor)
+{
+	intptr_t index = _names.find(name, length);
+	if (0 > index) {
+		/* parseElementStart has checked there is room */
+		index = _names.add(name, length);
+		*cursor++ = VERBOSE_BINARY_TOKEN_DEFINE_NAME;
+		cursor = writeBytes(cursor, name, length);
+	}
+	*cursor++ = token;
+	return writeVarint(cursor, (uint64_t)index);
+}
+
+uint8_t *
+MM_VerboseBinaryEncoder::encodeValue(const char *value, uintptr_t length, uint8_t *cursor)
+{
+	uint64_t number = 0;
+	uintptr_t scale = 0;
+
+	if (parseTimestamp(value, length, &number)) {
+		int64_t delta = (int64_t)(number - _lastTimestamp);
+		_lastTimestamp = number;
+		*cursor++ = VERBOSE_BINARY_VALUE_TIMESTAMP;
+		return writeVarint(cursor, ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+	}
+	if (parseUnsigned(value, length, &number)) {
+		*cursor++ = VERBOSE_BINARY_VALUE_UNSIGNED;
+		return writeVarint(cursor, number);
+	}
+	if (parseHex(value, length, &number)) {
+		*cursor++ = VERBOSE_BINARY_VALUE_HEX;
+		return writeVarint(cursor, number);
+	}
+	if (parseDecimal(value, length, &number, &scale)) {
+		*cursor++ = VERBOSE_BINARY_VALUE_DECIMAL;
+		*cursor++ = (uint8_t)scale;
+		return writeVarint(cursor, number);
+	}
+
+	if ((0 < length) && (length <= VERBOSE_BINARY_MAX_DICTIONARY_VALUE_LENGTH)) {
+		intptr_t index = _values.find(value, length);
+		if (0 > index) {
+			index = _values.add(value, length);
+			if (0 <= index) {
+				*cursor++ = VERBOSE_BINARY_TOKEN_DEFINE_VALUE;
+				cursor = writeBytes(cursor, value, length);
+			}
+		}
+		if (0 <= index) {
+			*cursor++ = VERBOSE_BINARY_VALUE_DICTIONARY;
+			return writeVarint(cursor, (uint64_t)index);
+		}
+	}
+
+	*cursor++ = VERBOSE_BINARY_VALUE_STRING;
+	return writeBytes(cursor, value, length);
+}
+
+uint8_t *
+MM_VerboseBinaryEncoder::encodeText(const char *text, uintptr_t length, uint8_t *cursor)
+{
+	const char *end = text + length;
+	const char *textStart = text;
+	const char *current = text;
+
+	while (current < end) {
+		const char *next = NULL;
+		if ('\n' == *current) {
+			next = current + 1;
+			while ((next < end) && (' ' == *next)) {
+				next += 1;
+			}
+		} else if (('<' == *current) && ((current + 1) < end)) {
+			if ('/' == current[1]) {
+				const char *name = current + 2;
+				const char *nameEnd = name;
+				while ((nameEnd < end) && isNameChar(*nameEnd)) {
+					nameEnd += 1;
+				}
+				if ((nameEnd < end) && ('>' == *nameEnd) && (name != nameEnd) && (0 <= _names.find(name, nameEnd - name))) {
+					next = nameEnd + 1;
+				}
+			} else if (parseElementStart(current, end, &next)) {
+				/* next is set */
+			} else {
+				next = NULL;
+			}
+		}
+
+		if (NULL == next) {
+			current += 1;
+			continue;
+		}
+
+		if (textStart != current) {
+			*cursor++ = VERBOSE_BINARY_TOKEN_TEXT;
+			cursor = writeBytes(cursor, textStart, current - textStart);
+		}
+
+		if ('\n' == *current) {
+			*cursor++ = VERBOSE_BINARY_TOKEN_NEWLINE;
+			cursor = writeVarint(cursor, (next - current) - 1);
+		} else if ('/' == current[1]) {
+			cursor = encodeName(VERBOSE_BINARY_TOKEN_END_ELEMENT, current + 2, (next - current) - 3, cursor);
+		} else {
+			/* the tag has been validated by parseElementStart, so walk it without checks */
+			const char *name = current + 1;
+			const char *nameEnd = name;
+			while (isNameChar(*nameEnd)) {
+				nameEnd += 1;
+			}
+			cursor = encodeName(VERBOSE_BINARY_TOKEN_START_ELEMENT, name, nameEnd - name, cursor);
+			while ((' ' == *nameEnd) && isNameChar(nameEnd[1])) {
+				name = nameEnd + 1;
+				nameEnd = name;
+				while (isNameChar(*nameEnd)) {
+					nameEnd += 1;
+				}
+				cursor = encodeName(VERBOSE_BINARY_TOKEN_ATTRIBUTE, name, nameEnd - name, cursor);
+				const char *value = nameEnd + 2;
+				const char *valueEnd = (const char *)memchr(value, '"', end - value);
+				cursor = encodeValue(value, valueEnd - value, cursor);
+				nameEnd = valueEnd + 1;
+			}
+			if ('>' == *nameEnd) {
+				*cursor++ = VERBOSE_BINARY_TOKEN_START_ELEMENT_END;
+			} else if ('/' == *nameEnd) {
+				*cursor++ = VERBOSE_BINARY_TOKEN_EMPTY_ELEMENT_END_NO_SPACE;
+			} else {
+				*cursor++ = VERBOSE_BINARY_TOKEN_EMPTY_ELEMENT_END;
+			}
+		}
+
+		current = next;
+		textStart = next;
+	}
+
+	if (textStart != end) {
+		*cursor++ = VERBOSE_BINARY_TOKEN_TEXT;
+		cursor = writeBytes(cursor, textStart, end - textStart);
+	}
+
+	return cursor;
+}
+
+void
+MM_VerboseBinaryDecoder::reset()
+{
+	_names.reset();
+	_values.reset();
+	_lastTimestamp = 0;
+	_magicRead = false;
+}
+
+bool
+MM_VerboseBinaryDecoder::isBinaryLog(const uint8_t *data, uintptr_t length)
+{
+	return (VERBOSE_BINARY_MAGIC_LENGTH <= length) && (0 == memcmp(data, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH));
+}
+
+intptr_t
+MM_VerboseBinaryDecoder::decode(const uint8_t *data, uintptr_t length)
+{
+	const uint8_t *end = data + length;
+	const uint8_t *cursor = data;
+
+	if (!_magicRead) {
+		if (VERBOSE_BINARY_MAGIC_LENGTH > length) {
+			return (0 == memcmp(data, VERBOSE_BINARY_MAGIC, length)) ? 0 : -1;
+		}
+		if (!isBinaryLog(data, length)) {
+			return -1;
+		}
+		cursor += VERBOSE_BINARY_MAGIC_LENGTH;
+		_magicRead = true;
+	}
+
+	while (cursor < end) {
+		uint64_t recordLength = 0;
+		const uint8_t *record = readVarint(cursor, end, &recordLength);
+		if (NULL == record) {
+			if ((end - cursor) >= VERBOSE_BINARY_MAX_VARINT_LENGTH) {
+				return -1;
+			}
+			/* length prefix incomplete */
+			break;
+		}
+		if (recordLength > (uint64_t)(end - record)) {
+			/* record incomplete */
+			break;
+		}
+		if (!decodeRecord(record, record + recordLength)) {
+			return -1;
+		}
+		cursor = record + recordLength;
+	}
+
+	return cursor - data;
+}
+
+const uint8_t *
+MM_VerboseBinaryDecoder::decodeValue(const uint8_t *cursor, const uint8_t *end, char *valueBuffer, const char **value, uintptr_t *valueLength)
+{
+	uint64_t number = 0;
+
+	if (cursor >= end) {
+		return NULL;
+	}
+
+	uint8_t kind = *cursor++;
+	if (VERBOSE_BINARY_TOKEN_DEFINE_VALUE == kind) {
+		/* a value seen for the first time is defined in place, ahead of its dictionary reference */
+		if ((NULL == (cursor = readVarint(cursor, end, &number))) || (number > (uint64_t)(end - cursor))
+			|| (0 > _values.add((const char *)cursor, (uintptr_t)number))
+		) {
+			return NULL;
+		}
+		cursor += number;
+		if ((cursor >= end) || (VERBOSE_BINARY_VALUE_DICTIONARY != *cursor)) {
+			return NULL;
+		}
+		kind = *cursor++;
+	}
+	if (VERBOSE_BINARY_VALUE_DECIMAL == kind) {
+		if (cursor >= end) {
+			return NULL;
+		}
+		uintptr_t scale = *cursor++;
+		if ((0 == scale) || (VERBOSE_BINARY_MAX_DECIMAL_SCALE < scale) || (NULL == (cursor = readVarint(cursor, end, &number)))) {
+			return NULL;
+		}
+		*value = valueBuffer;
+		*valueLength = renderDecimal(number, scale, valueBuffer);
+		return cursor;
+	}
+
+	if (NULL == (cursor = readVarint(cursor, end, &number))) {
+		return NULL;
+	}
+
+	switch (kind) {
+	case VERBOSE_BINARY_VALUE_STRING:
+		if (number > (uint64_t)(end - cursor)) {
+			return NULL;
+		}
+		*value = (const char *)cursor;
+		*valueLength = (uintptr_t)number;
+		cursor += number;
+		break;
+	case VERBOSE_BINARY_VALUE_DICTIONARY:
+		*value = _values.get((uintptr_t)number, valueLength);
+		if (NULL == *value) {
+			return NULL;
+		}
+		break;
+	case VERBOSE_BINARY_VALUE_UNSIGNED:
+		*value = valueBuffer;
+		*valueLength = renderUnsigned(number, valueBuffer);
+		break;
+	case VERBOSE_BINARY_VALUE_HEX:
+		*value = valueBuffer;
+		*valueLength = renderHex(number, valueBuffer);
+		break;
+	case VERBOSE_BINARY_VALUE_TIMESTAMP:
+		_lastTimestamp += (uint64_t)((int64_t)(number >> 1) ^ -(int64_t)(number & 1));
+		*value = valueBuffer;
+		*valueLength = renderTimestamp(_lastTimestamp, valueBuffer);
+		break;
+	default:
+		return NULL;
+	}
+
+	return cursor;
+}
+
+bool
+MM_VerboseBinaryDecoder::decodeRecord(const uint8_t *cursor, const uint8_t *end)
+{
+	char valueBuffer[VERBOSE_BINARY_MAX_RENDERED_VALUE];
+
+	while (cursor < end) {
+		uint8_t token = *cursor++;
+		uint64_t operand = 0;
+		const char *name = NULL;
+		uintptr_t nameLength = 0;
+
+		switch (token) {
+		case VERBOSE_BINARY_TOKEN_START_ELEMENT_END:
+			_listener->startElementEnd(">");
+			continue;
+		case VERBOSE_BINARY_TOKEN_EMPTY_ELEMENT_END:
+			_listener->startElementEnd(" />");
+			continue;
+		case VERBOSE_BINARY_TOKEN_EMPTY_ELEMENT_END_NO_SPACE:
+			_listener->startElementEnd("/>");
+			continue;
+		default:
+			break;
+		}
+
+		/* all other tokens have a varint operand */
+		if (NULL == (cursor = readVarint(cursor, end, &operand))) {
+			return false;
+		}
+
+		switch (token) {
+		case VERBOSE_BINARY_TOKEN_TEXT:
+		case VERBOSE_BINARY_TOKEN_DEFINE_NAME:
+			if (operand > (uint64_t)(end - cursor)) {
+				return false;
+			}
+			if (VERBOSE_BINARY_TOKEN_TEXT == token) {
+				_listener->text((const char *)cursor, (uintptr_t)operand);
+			} else if (0 > _names.add((const char *)cursor, (uintptr_t)operand)) {
+				return false;
+			}
+			cursor += operand;
+			break;
+		case VERBOSE_BINARY_TOKEN_NEWLINE:
+		{
+			char indent[VERBOSE_BINARY_INDENT_CHUNK];
+			memset(indent, ' ', sizeof(indent));
+			indent[0] = '\n';
+			uintptr_t remaining = (uintptr_t)operand + 1;
+			const char *chunk = indent;
+			while (0 < remaining) {
+				uintptr_t chunkLength = (remaining < (uintptr_t)((indent + sizeof(indent)) - chunk)) ? remaining : (uintptr_t)((indent + sizeof(indent)) - chunk);
+				_listener->text(chunk, chunkLength);
+				remaining -= chunkLength;
+				chunk = indent + 1;
+			}
+			break;
+		}
+		case VERBOSE_BINARY_TOKEN_START_ELEMENT:
+		case VERBOSE_BINARY_TOKEN_ATTRIBUTE:
+		case VERBOSE_BINARY_TOKEN_END_ELEMENT:
+			name = _names.get((uintptr_t)operand, &nameLength);
+			if (NULL == name) {
+				return false;
+			}
+			if (VERBOSE_BINARY_TOKEN_START_ELEMENT == token) {
+				_listener->startElement(name, nameLength);
+			} else if (VERBOSE_BINARY_TOKEN_END_ELEMENT == token) {
+				_listener->endElement(name, nameLength);
+			} else {
+				const char *value = NULL;
+				uintptr_t valueLength = 0;
+				if (NULL == (cursor = decodeValue(cursor, end, valueBuffer, &value, &valueLength))) {
+					return false;
+				}
+				_listener->attribute(name, nameLength, value, valueLength);
+			}
+			break;
+		default:
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+MM_VerboseBinaryXMLConverter::text(const char *text, uintptr_t length)
+{
+	_sink(_userData, text, length);
+}
+
+void
+MM_VerboseBinaryXMLConverter::startElement(const char *name, uintptr_t nameLength)
+{
+	_sink(_userData, "<", 1);
+	_sink(_userData, name, nameLength);
+}
+
+void
+MM_VerboseBinaryXMLConverter::attribute(const char *name, uintptr_t nameLength, const char *value, uintptr_t valueLength)
+{
+	_sink(_userData, " ", 1);
+	_sink(_userData, name, nameLength);
+	_sink(_userData, "=\"", 2);
+	_sink(_userData, value, valueLength);
+	_sink(_userData, "\"", 1);
+}
+
+void
+MM_VerboseBinaryXMLConverter::startElementEnd(const char *terminator)
+{
+	_sink(_userData, terminator, strlen(terminator));
+}
+
+void
+MM_VerboseBinaryXMLConverter::endElement(const char *name, uintptr_t nameLength)
+{
+	_sink(_userData, "</", 2);
+	_sink(_userData, name, nameLength);
+	_sink(_userData, ">", 1);
+}
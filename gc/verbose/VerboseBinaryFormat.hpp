@@ -0,0 +1,280 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+/**
+ * @name Binary verbose GC format
+ *
+ * A binary verbose GC log starts with VERBOSE_BINARY_MAGIC and is followed by records, each a varint
+ * payload length and a payload encoding one string written by the verbose handlers. The payload is a
+ * stream of tokens describing the XML text: element and attribute names are replaced by dictionary
+ * indices, short string values are replaced by dictionary indices once seen, and integer, hexadecimal,
+ * fixed point and timestamp values are stored as varints. Dictionary entries are defined in line on
+ * first use, so each file can be decoded on its own and from the start, and decoding reproduces the
+ * XML text exactly.
+ * @{
+ */
+#define VERBOSE_BINARY_MAGIC "OMRVGCB1"
+#define VERBOSE_BINARY_MAGIC_LENGTH 8
+
+#define VERBOSE_BINARY_MAX_DICTIONARY_ENTRIES 256
+#define VERBOSE_BINARY_DICTIONARY_POOL_SIZE 8192
+#define VERBOSE_BINARY_MAX_DICTIONARY_VALUE_LENGTH 48
+#define VERBOSE_BINARY_MAX_VARINT_LENGTH 10
+
+/* Tokens */
+#define VERBOSE_BINARY_TOKEN_TEXT 0x01 /**< varint length, text */
+#define VERBOSE_BINARY_TOKEN_NEWLINE 0x02 /**< varint indent: a new line followed by indent spaces */
+#define VERBOSE_BINARY_TOKEN_DEFINE_NAME 0x03 /**< varint length, text: next name dictionary entry */
+#define VERBOSE_BINARY_TOKEN_DEFINE_VALUE 0x04 /**< varint length, text: next value dictionary entry, only in place of a value and followed by its reference */
+#define VERBOSE_BINARY_TOKEN_START_ELEMENT 0x05 /**< varint name: "<name" */
+#define VERBOSE_BINARY_TOKEN_ATTRIBUTE 0x06 /**< varint name, value: " name=\"value\"" */
+#define VERBOSE_BINARY_TOKEN_START_ELEMENT_END 0x07 /**< ">" */
+#define VERBOSE_BINARY_TOKEN_EMPTY_ELEMENT_END 0x08 /**< " />" */
+#define VERBOSE_BINARY_TOKEN_EMPTY_ELEMENT_END_NO_SPACE 0x09 /**< "/>" */
+#define VERBOSE_BINARY_TOKEN_END_ELEMENT 0x0A /**< varint name: "</name>" */
+
+/* Attribute values */
+#define VERBOSE_BINARY_VALUE_STRING 0x10 /**< varint length, text */
+#define VERBOSE_BINARY_VALUE_DICTIONARY 0x11 /**< varint value dictionary index */
+#define VERBOSE_BINARY_VALUE_UNSIGNED 0x12 /**< varint: decimal integer */
+#define VERBOSE_BINARY_VALUE_HEX 0x13 /**< varint: "0x" followed by lower case hex digits */
+#define VERBOSE_BINARY_VALUE_DECIMAL 0x14 /**< byte scale, varint digits: fixed point number with scale fraction digits */
+#define VERBOSE_BINARY_VALUE_TIMESTAMP 0x15 /**< zigzag varint: milliseconds since the previous timestamp, rendered as yyyy-mm-ddThh:mm:ss.mmm */
+/**
+ * @}
+ */
+
+/**
+ * Dictionary of names or values, shared by the encoder and decoder. Indices are assigned in order
+ * of definition; the dictionary stops accepting entries once full.
+ */
+class MM_VerboseBinaryDictionary
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _count; /**< number of entries */
+	uintptr_t _poolUsed; /**< bytes of _pool in use */
+	uint16_t _offsets[VERBOSE_BINARY_MAX_DICTIONARY_ENTRIES]; /**< offset of each entry in _pool */
+	uint8_t _lengths[VERBOSE_BINARY_MAX_DICTIONARY_ENTRIES]; /**< length of each entry */
+	uint16_t _hashTable[VERBOSE_BINARY_MAX_DICTIONARY_ENTRIES * 2]; /**< open addressed index + 1 of each entry, 0 when empty */
+	char _pool[VERBOSE_BINARY_DICTIONARY_POOL_SIZE]; /**< text of the entries */
+
+	/*
+	 * Function members
+	 */
+public:
+	void reset();
+
+	/**
+	 * @return index of the entry matching text, or -1 if there is none
+	 */
+	intptr_t find(const char *text, uintptr_t length);
+
+	/**
+	 * Add an entry.
+	 * @return index of the new entry, or -1 if the dictionary is full
+	 */
+	intptr_t add(const char *text, uintptr_t length);
+
+	/**
+	 * @return true if entries more entries totalling bytes in length can be added
+	 */
+	bool hasRoomFor(uintptr_t entries, uintptr_t bytes);
+
+	/**
+	 * @return text of the entry at index, or NULL if index is not defined
+	 */
+	const char *get(uintptr_t index, uintptr_t *length);
+
+	MM_VerboseBinaryDictionary()
+	{
+		reset();
+	}
+
+private:
+	static uintptr_t hash(const char *text, uintptr_t length);
+};
+
+/**
+ * Encodes the strings written by the verbose handlers into binary records. Holds the dictionaries of
+ * the file being written, which must be reset whenever a new file is started.
+ */
+class MM_VerboseBinaryEncoder
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_VerboseBinaryDictionary _names; /**< element and attribute names */
+	MM_VerboseBinaryDictionary _values; /**< short string attribute values */
+	uint64_t _lastTimestamp; /**< last timestamp encoded, in milliseconds */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Start a new file.
+	 */
+	void reset();
+
+	/**
+	 * @return upper bound of the size of the record encoding length bytes of text
+	 */
+	static uintptr_t maximumRecordSize(uintptr_t length) { return (4 * length) + 16 + VERBOSE_BINARY_MAX_VARINT_LENGTH; }
+
+	/**
+	 * Encode text into a length prefixed record.
+	 * @param output buffer of at least maximumRecordSize(length) bytes
+	 * @return size of the record
+	 */
+	uintptr_t encodeRecord(const char *text, uintptr_t length, uint8_t *output);
+
+	MM_VerboseBinaryEncoder()
+		: _lastTimestamp(0)
+	{}
+
+private:
+	uint8_t *encodeText(const char *text, uintptr_t length, uint8_t *cursor);
+	uint8_t *encodeName(uint8_t token, const char *name, uintptr_t length, uint8_t *cursor);
+	uint8_t *encodeValue(const char *value, uintptr_t length, uint8_t *cursor);
+	bool parseElementStart(const char *text, const char *end, const char **tagEnd);
+};
+
+/**
+ * Receives the XML structure decoded from a binary verbose GC log.
+ */
+class MM_VerboseBinaryDecoderListener
+{
+public:
+	/**
+	 * Text outside of tags, including line breaks and indentation.
+	 */
+	virtual void text(const char *text, uintptr_t length) = 0;
+	/**
+	 * Start of an element tag, "<name".
+	 */
+	virtual void startElement(const char *name, uintptr_t nameLength) = 0;
+	/**
+	 * Attribute of the element being started.
+	 */
+	virtual void attribute(const char *name, uintptr_t nameLength, const char *value, uintptr_t valueLength) = 0;
+	/**
+	 * End of an element start tag, terminator is one of ">", " />" or "/>".
+	 */
+	virtual void startElementEnd(const char *terminator) = 0;
+	/**
+	 * End tag of an element, "</name>".
+	 */
+	virtual void endElement(const char *name, uintptr_t nameLength) = 0;
+
+	virtual ~MM_VerboseBinaryDecoderListener() {}
+};
+
+/**
+ * Streaming decoder of binary verbose GC logs. Data can be supplied in pieces of any size; the decoder
+ * consumes complete records and reports their content to a listener as it goes.
+ */
+class MM_VerboseBinaryDecoder
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_VerboseBinaryDecoderListener *_listener; /**< receives the decoded content */
+	MM_VerboseBinaryDictionary _names; /**< element and attribute names */
+	MM_VerboseBinaryDictionary _values; /**< short string attribute values */
+	uint64_t _lastTimestamp; /**< last timestamp decoded, in milliseconds */
+	bool _magicRead; /**< true once the file magic has been consumed */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Start decoding a new file.
+	 */
+	void reset();
+
+	/**
+	 * Decode the complete records at the start of data.
+	 * @param data the next bytes of the file, starting where the previous call stopped consuming
+	 * @param length the number of bytes available
+	 * @return the number of bytes consumed, or -1 if the data is not a valid binary verbose GC log. The
+	 * bytes not consumed are the start of an incomplete record, and must be supplied again with more data.
+	 */
+	intptr_t decode(const uint8_t *data, uintptr_t length);
+
+	/**
+	 * @return true if data starts with the binary verbose GC log magic
+	 */
+	static bool isBinaryLog(const uint8_t *data, uintptr_t length);
+
+	MM_VerboseBinaryDecoder(MM_VerboseBinaryDecoderListener *listener)
+		: _listener(listener)
+		, _lastTimestamp(0)
+		, _magicRead(false)
+	{}
+
+private:
+	bool decodeRecord(const uint8_t *cursor, const uint8_t *end);
+	const uint8_t *decodeValue(const uint8_t *cursor, const uint8_t *end, char *valueBuffer, const char **value, uintptr_t *valueLength);
+};
+
+/**
+ * Decoder listener which converts the decoded content back to the verbose GC XML text.
+ */
+class MM_VerboseBinaryXMLConverter : public MM_VerboseBinaryDecoderListener
+{
+public:
+	/**
+	 * Receives the XML text, in pieces.
+	 */
+	typedef void (*TextSink)(void *userData, const char *text, uintptr_t length);
+
+private:
+	TextSink _sink; /**< receives the XML text */
+	void *_userData; /**< passed to _sink */
+
+public:
+	virtual void text(const char *text, uintptr_t length);
+	virtual void startElement(const char *name, uintptr_t nameLength);
+	virtual void attribute(const char *name, uintptr_t nameLength, const char *value, uintptr_t valueLength);
+	virtual void startElementEnd(const char *terminator);
+	virtual void endElement(const char *name, uintptr_t nameLength);
+
+	MM_VerboseBinaryXMLConverter(TextSink sink, void *userData)
+		: MM_VerboseBinaryDecoderListener()
+		, _sink(sink)
+		, _userData(userData)
+	{}
+};
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
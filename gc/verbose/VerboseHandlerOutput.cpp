@@ -29,6 +29,8 @@
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapResizeStats.hpp"
+#include "HeapStats.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ParallelDispatcher.hpp"
 #include "VerboseHandlerOutput.hpp"
@@ -846,6 +848,23 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+		if (0 != systemStats->_tlhRefreshCountFresh) {
+			writer->formatAndOutput(env, 1, "<tlh-refresh count=\"%zu\" requestedbytes=\"%zu\" wastedbytes=\"%zu\" />",
+					systemStats->_tlhRefreshCountFresh, systemStats->_tlhRequestedBytes, systemStats->_tlhWastedBytes);
+		}
+		if (_extensions->freeEntrySizeClassCache || _extensions->numaSplitFreeList) {
+			/* the free list statistics cover the allocations since the last global collection */
+			MM_HeapStats heapStats;
+			_extensions->heap->mergeHeapStats(&heapStats, MEMORY_TYPE_OLD);
+			if (_extensions->freeEntrySizeClassCache) {
+				writer->formatAndOutput(env, 1, "<free-entry-cache allocations=\"%zu\" bytes=\"%zu\" />",
+						heapStats._sizeClassCacheAllocCount, heapStats._sizeClassCacheAllocBytes);
+			}
+			if (_extensions->numaSplitFreeList) {
+				writer->formatAndOutput(env, 1, "<numa-split-free-list nodes=\"%zu\" localtlhs=\"%zu\" remotetlhs=\"%zu\" />",
+						_extensions->_numaManager.getAffinityLeaderCount(), heapStats._numaLocalTLHAllocCount, heapStats._numaRemoteTLHAllocCount);
+			}
+		}
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -1028,7 +1047,15 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 
 	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
 
-	writer->formatAndOutput(env, indent, "<heap-resize id=\"%zu\" type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" %s />", id, resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString, tagTemplate);
+	if (HEAP_RELEASE_FREE_PAGES == resizeType) {
+		/* heap left committed and bytes decommitted by this and all releases, versus the process physical memory sampled after the release */
+		MM_HeapResizeStats *resizeStats = _extensions->heap->getResizeStats();
+		writer->formatAndOutput(env, indent, "<heap-resize id=\"%zu\" type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" committed=\"%zu\" released=\"%zu\" totalreleased=\"%llu\" resident=\"%llu\" %s />",
+				id, resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString,
+				resizeStats->getCommittedBytesAfterRelease(), resizeStats->getLastReleasedFreePagesSize(), resizeStats->getTotalReleasedFreePagesSize(), resizeStats->getResidentBytesAfterRelease(), tagTemplate);
+	} else {
+		writer->formatAndOutput(env, indent, "<heap-resize id=\"%zu\" type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" %s />", id, resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString, tagTemplate);
+	}
 	writer->flush(env);
 }
 
@@ -1096,6 +1123,32 @@ MM_VerboseHandlerOutput::handleExcessiveGCRaised(J9HookInterface** hook, uintptr
 	exitAtomicReportingBlock();
 }
 
+void
+MM_VerboseHandlerOutput::handleAllocationSitesSampled(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_AllocationSitesSampledEvent * event = (MM_AllocationSitesSampledEvent *)eventData;
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_AllocationSiteStats *allocationSiteStats = &_extensions->allocationSiteStats;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	uintptr_t indentLevel = _manager->getIndentLevel();
+	uintptr_t reportedSites = OMR_MIN(allocationSiteStats->getEntryCount(), _extensions->allocationSiteSamplingDepth);
+
+	char tagTemplate[200];
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(), omrtime_current_time_millis());
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, indentLevel, "<allocation-sites %s samplingbytes=\"%zu\" sampledbytes=\"%zu\" samples=\"%zu\" sites=\"%zu\">",
+			tagTemplate, _extensions->allocationSiteSamplingBytesGranularity, allocationSiteStats->_sampledBytes, allocationSiteStats->_samples, allocationSiteStats->getEntryCount());
+	for (uintptr_t i = 0; i < reportedSites; i++) {
+		MM_AllocationSiteSample *entry = allocationSiteStats->getEntry(i);
+		writer->formatAndOutput(env, indentLevel + 1, "<allocation-site site=\"%p\" bytes=\"%zu\" samples=\"%zu\" />", entry->site, entry->bytes, entry->samples);
+	}
+	writer->formatAndOutput(env, indentLevel, "</allocation-sites>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
 void
 MM_VerboseHandlerOutput::outputStringConstantInfo(MM_EnvironmentBase *env, uintptr_t indent, uintptr_t candidates, uintptr_t cleared)
 {
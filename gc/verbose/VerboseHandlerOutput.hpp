@@ -525,6 +525,14 @@ public:
 	 */
 	void handleExcessiveGCRaised(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write the verbose stanza listing the heaviest allocation sites sampled since the previous collection.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleAllocationSitesSampled(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
 };
 
 #endif /* VERBOSEHANDLEROUTPUT_HPP_ */
@@ -34,6 +34,8 @@
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
@@ -140,6 +142,16 @@ MM_VerboseManager::closeStreams(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_VerboseManager::flushStreams(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriter *writer = _writerChain->getFirstWriter();
+	while(NULL != writer) {
+		writer->flushStream(env);
+		writer = writer->getNextWriter();
+	}
+}
+
 bool
 MM_VerboseManager::openStreams(MM_EnvironmentBase *env)
 {
@@ -250,6 +262,20 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (extensions->verboseBinaryFormat) {
+		if (extensions->asyncLogging || extensions->bufferedLogging) {
+			/* MM_StartupManager rejects these combinations, this covers runtimes which set the options themselves */
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			omrtty_err_printf("Warning: binary verbose GC logs are written synchronously, %s logging is ignored\n",
+					extensions->asyncLogging ? "asynchronous" : "buffered");
+		}
+		return VERBOSE_WRITER_FILE_LOGGING_BINARY;
+	}
+
+	if (extensions->asyncLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -330,6 +356,30 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS:
+		writer = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
+	case VERBOSE_WRITER_FILE_LOGGING_BINARY:
+		writer = MM_VerboseWriterFileLoggingBinary::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
 
 	default:
 		return NULL;
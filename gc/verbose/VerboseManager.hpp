@@ -116,6 +116,12 @@ public:
 	 */
 	virtual void closeStreams(MM_EnvironmentBase *env);
 
+	/**
+	 * Wait until all output mechanisms on the receiver have written out the output they have accepted.
+	 * @param env vm thread.
+	 */
+	void flushStreams(MM_EnvironmentBase *env);
+
 	/**
 	 * Open all output mechanisms on the receiver.
 	 * @param[in] env the current environment.
@@ -35,7 +35,9 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 7
 } WriterType;
 
 /**
@@ -82,6 +84,13 @@ public:
 	 */
 	virtual bool openStream(MM_EnvironmentBase *env) { return true; }
 
+	/**
+	 * Wait until the output accepted by the writer has been written out. Writers which write
+	 * from the reporting thread have nothing to wait for.
+	 * @param[in] env the current environment.
+	 */
+	virtual void flushStream(MM_EnvironmentBase *env) {}
+
 	MMINLINE WriterType getType(void) { return _type; }
 
 	MMINLINE bool isActive(void) { return _isActive; }
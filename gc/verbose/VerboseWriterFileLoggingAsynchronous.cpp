@@ -0,0 +1,480 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrutil.h"
+#include "modronapicore.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+/* Each record starts with a header slot holding the text length and the record kind. A zero
+ * header marks space which has been reserved but not yet filled in by its producer.
+ */
+#define ASYNC_RECORD_HEADER_SIZE sizeof(uintptr_t)
+#define ASYNC_RECORD_KIND_SHIFT 2
+#define ASYNC_RECORD_KIND_MASK (((uintptr_t)1 << ASYNC_RECORD_KIND_SHIFT) - 1)
+#define ASYNC_RECORD_KIND_TEXT 1
+#define ASYNC_RECORD_KIND_END_OF_CYCLE 2
+
+/* Upper bound on the time records may sit in the ring buffer if a wake-up was missed */
+#define ASYNC_IO_THREAD_WAIT_MILLIS 100
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_logFileDescriptor(-1)
+	,_records(NULL)
+	,_recordsSize(0)
+	,_recordsReserved(0)
+	,_recordsWritten(0)
+	,_droppedRecords(0)
+	,_reportedDroppedRecords(0)
+	,_ioMonitor(NULL)
+	,_ioThread(NULL)
+	,_ioThreadState(STATE_ERROR)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance.
+ * Allocates the ring buffer, opens the log file and starts the I/O thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL == _records) {
+		_recordsSize = MM_Math::roundToCeiling(ASYNC_RECORD_HEADER_SIZE, extensions->asyncLoggingBufferSize);
+		_records = (uint8_t *)extensions->getForge()->allocate(_recordsSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _records) {
+			return false;
+		}
+		memset(_records, 0, _recordsSize);
+	}
+
+	if ((NULL == _ioMonitor) && (0 != omrthread_monitor_init_with_name(&_ioMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_ioMonitor"))) {
+		_ioMonitor = NULL;
+		return false;
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	/* Reconfiguration re-initializes a running writer, which keeps its I/O thread */
+	return (STATE_WAITING == _ioThreadState) ? true : startIOThread(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the I/O thread once it has written all queued records and frees the ring buffer.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	shutdownIOThread(env);
+
+	if (NULL != _ioMonitor) {
+		omrthread_monitor_destroy(_ioMonitor);
+		_ioMonitor = NULL;
+	}
+
+	env->getExtensions()->getForge()->free(_records);
+	_records = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Start the I/O thread and wait for it to report whether it started.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startIOThread(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can not notify us of its state before we wait */
+	omrthread_monitor_enter(_ioMonitor);
+	_ioThreadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		&_ioThread,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		io_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _ioThreadState) {
+			omrthread_monitor_wait(_ioMonitor);
+		}
+		success = (STATE_WAITING == _ioThreadState);
+	} else {
+		_ioThread = NULL;
+		_ioThreadState = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_ioMonitor);
+
+	return success;
+}
+
+/**
+ * Ask the I/O thread to write out the remaining records and terminate, and wait for it to do so.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::shutdownIOThread(MM_EnvironmentBase *env)
+{
+	if ((NULL != _ioMonitor) && (STATE_WAITING == _ioThreadState)) {
+		omrthread_monitor_enter(_ioMonitor);
+		while (STATE_TERMINATED != _ioThreadState) {
+			_ioThreadState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_ioMonitor);
+			omrthread_monitor_wait(_ioMonitor);
+		}
+		omrthread_monitor_exit(_ioMonitor);
+		_ioThread = NULL;
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::io_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->ioThreadEntryPoint();
+	return 0;
+}
+
+/**
+ * Main loop of the I/O thread. Sleep until woken by a producer (or the wait times out) and
+ * write out all complete records, until termination is requested.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::ioThreadEntryPoint()
+{
+	/* The I/O thread only does file I/O and formats the initialized stanza, neither needs an attached VM thread */
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_ioMonitor);
+	_ioThreadState = STATE_WAITING;
+	omrthread_monitor_notify_all(_ioMonitor);
+
+	while (STATE_TERMINATION_REQUESTED != _ioThreadState) {
+		if (_recordsWritten == _recordsReserved) {
+			omrthread_monitor_wait_timed(_ioMonitor, ASYNC_IO_THREAD_WAIT_MILLIS, 0);
+		}
+		omrthread_monitor_exit(_ioMonitor);
+
+		writeRecords(&env);
+
+		omrthread_monitor_enter(_ioMonitor);
+		/* wake any thread waiting for the records to be written */
+		omrthread_monitor_notify_all(_ioMonitor);
+		if ((_recordsWritten != _recordsReserved) && (STATE_TERMINATION_REQUESTED != _ioThreadState)) {
+			/* a producer is still filling in the next record; give it time rather than spin */
+			omrthread_monitor_wait_timed(_ioMonitor, 1, 0);
+		}
+	}
+
+	/* write everything queued before termination was requested */
+	omrthread_monitor_exit(_ioMonitor);
+	writeRecords(&env);
+	omrthread_monitor_enter(_ioMonitor);
+
+	_ioThreadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_ioMonitor);
+	/* exit the monitor and terminate the thread */
+	omrthread_exit(_ioMonitor);
+}
+
+/**
+ * Reserve space in the ring buffer for a record and copy it in. May be called by several threads at
+ * once; space is reserved with a compare and swap and the record is published by writing its header
+ * last, so no lock is taken and the file is not touched.
+ * @param kind the kind of record
+ * @param string the record text (may be NULL if length is 0)
+ * @param length the length of the record text
+ * @return true if the record was queued, false if it was dropped because the ring buffer was full
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::appendRecord(MM_EnvironmentBase *env, uintptr_t kind, const char *string, uintptr_t length)
+{
+	uintptr_t recordSize = MM_Math::roundToCeiling(ASYNC_RECORD_HEADER_SIZE, ASYNC_RECORD_HEADER_SIZE + length);
+	uintptr_t reserved = 0;
+
+	do {
+		reserved = _recordsReserved;
+		if ((reserved + recordSize - _recordsWritten) > _recordsSize) {
+			MM_AtomicOperations::add(&_droppedRecords, 1);
+			return false;
+		}
+	} while (reserved != MM_AtomicOperations::lockCompareExchange(&_recordsReserved, reserved, reserved + recordSize));
+
+	/* the header slot never wraps since the ring buffer size is a multiple of the slot size */
+	uintptr_t headerOffset = reserved % _recordsSize;
+	uintptr_t textOffset = (headerOffset + ASYNC_RECORD_HEADER_SIZE) % _recordsSize;
+	if (0 < length) {
+		uintptr_t firstPart = OMR_MIN(length, _recordsSize - textOffset);
+		memcpy(_records + textOffset, string, firstPart);
+		memcpy(_records, string + firstPart, length - firstPart);
+	}
+
+	/* publish the record only once its text is visible */
+	MM_AtomicOperations::writeBarrier();
+	*(volatile uintptr_t *)(_records + headerOffset) = (length << ASYNC_RECORD_KIND_SHIFT) | kind;
+
+	return true;
+}
+
+/**
+ * Write out all complete records in the ring buffer, in order. Called by the I/O thread only.
+ * Stops at the first record which has been reserved but not yet published.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeRecords(MM_EnvironmentBase *env)
+{
+	while (_recordsWritten != _recordsReserved) {
+		uintptr_t headerOffset = _recordsWritten % _recordsSize;
+		uintptr_t header = *(volatile uintptr_t *)(_records + headerOffset);
+		if (0 == header) {
+			break;
+		}
+		/* do not read the text before the header */
+		MM_AtomicOperations::readBarrier();
+
+		uintptr_t length = header >> ASYNC_RECORD_KIND_SHIFT;
+		uintptr_t recordSize = MM_Math::roundToCeiling(ASYNC_RECORD_HEADER_SIZE, ASYNC_RECORD_HEADER_SIZE + length);
+		if (ASYNC_RECORD_KIND_TEXT == (header & ASYNC_RECORD_KIND_MASK)) {
+			uintptr_t textOffset = (headerOffset + ASYNC_RECORD_HEADER_SIZE) % _recordsSize;
+			uintptr_t firstPart = OMR_MIN(length, _recordsSize - textOffset);
+			writeText(env, (const char *)(_records + textOffset), firstPart);
+			if (length > firstPart) {
+				writeText(env, (const char *)_records, length - firstPart);
+			}
+			reportDroppedRecords(env);
+		} else {
+			/* report the drops of the cycle in its own file, then rotate files (if required) at the same point in the output as the synchronous writers */
+			reportDroppedRecords(env);
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+		}
+
+		/* clear the record so that a producer reusing the space starts from an unpublished header */
+		uintptr_t firstPart = OMR_MIN(recordSize, _recordsSize - headerOffset);
+		memset(_records + headerOffset, 0, firstPart);
+		memset(_records, 0, recordSize - firstPart);
+		MM_AtomicOperations::writeBarrier();
+		_recordsWritten += recordSize;
+	}
+
+	reportDroppedRecords(env);
+}
+
+/**
+ * Write a comment with the number of records dropped since the last report, if any. Called by the
+ * I/O thread only, before a record is marked written so that a thread waiting for the records to be
+ * written also sees the drops reported.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::reportDroppedRecords(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	uintptr_t droppedRecords = _droppedRecords;
+	if (droppedRecords != _reportedDroppedRecords) {
+		char comment[64];
+		uintptr_t commentLength = omrstr_printf(comment, sizeof(comment), "<!-- %zu verbose records dropped -->\n", droppedRecords - _reportedDroppedRecords);
+		writeText(env, comment, commentLength);
+		_reportedDroppedRecords = droppedRecords;
+	}
+}
+
+/**
+ * Write text to the log file, reopening it if required. Called by the I/O thread, or by the
+ * thread opening a log file while no records are queued.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeText(MM_EnvironmentBase *env, const char *string, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/**
+		 * Under normal circumstances, new file should be opened during endOfCycle call.
+		 * This path works as one backup, in case we failed to open the file,  we’ll attempt to open it again before outputting the string.
+		 */
+		openFile(env);
+	}
+
+	if(-1 != _logFileDescriptor){
+		omrfile_write_text(_logFileDescriptor, string, length);
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, string, length);
+	}
+}
+
+/**
+ * Wait until the I/O thread has written every record queued so far.
+ * Used before the file is closed by a thread other than the I/O thread.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::waitForRecordsWritten(MM_EnvironmentBase *env)
+{
+	if ((NULL != _ioMonitor) && (omrthread_self() != _ioThread)) {
+		omrthread_monitor_enter(_ioMonitor);
+		uintptr_t recordsReserved = _recordsReserved;
+		while ((STATE_WAITING == _ioThreadState) && ((intptr_t)(recordsReserved - _recordsWritten) > 0)) {
+			omrthread_monitor_notify_all(_ioMonitor);
+			omrthread_monitor_wait_timed(_ioMonitor, ASYNC_IO_THREAD_WAIT_MILLIS, 0);
+		}
+		omrthread_monitor_exit(_ioMonitor);
+	}
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	omrfile_printf(_logFileDescriptor, getHeader(env), version);
+	/* Print an Initialized Stanza in new file, written directly behind the header rather than queued:
+	 * on rotation this runs on the I/O thread, where queuing would put the stanza behind records of
+	 * the next cycle (or drop it if the ring buffer is full). Any other caller has just drained the
+	 * ring buffer in closeFile(), or is opening the first file before anything was queued.
+	 */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			writeText(env, buffer->contents(), strlen(buffer->contents()));
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to, once all queued records are written.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	waitForRecordsWritten(env);
+
+	if(-1 != _logFileDescriptor) {
+		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	appendRecord(env, ASYNC_RECORD_KIND_TEXT, string, strlen(string));
+}
+
+/**
+ * Queue an end of cycle marker so that the I/O thread rotates files at this point in the
+ * output, and wake the I/O thread unless it is already busy.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	appendRecord(env, ASYNC_RECORD_KIND_END_OF_CYCLE, NULL, 0);
+
+	/* never block the reporting thread; if the monitor is held the I/O thread is awake anyway */
+	if (0 == omrthread_monitor_try_enter(_ioMonitor)) {
+		omrthread_monitor_notify(_ioMonitor);
+		omrthread_monitor_exit(_ioMonitor);
+	}
+}
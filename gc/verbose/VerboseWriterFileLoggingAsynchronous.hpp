@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file from a dedicated I/O thread.
+ *
+ * Formatted records are appended to a ring buffer by the threads reporting GC events
+ * without taking a lock or touching the file system; the I/O thread drains the ring
+ * buffer to the file (and rotates files) outside of the collection. A record which
+ * does not fit in the free space of the ring buffer is dropped and counted, and the
+ * count is reported in the log once the I/O thread has caught up.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * States of the I/O thread
+	 */
+	enum IOThreadState {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED
+	};
+
+	OMR_VM *_omrVM; /**< the VM, used to construct the I/O thread environment */
+	intptr_t _logFileDescriptor; /**< the file being written to */
+
+	uint8_t *_records; /**< ring buffer of records, each a header slot followed by the record text */
+	uintptr_t _recordsSize; /**< size of the ring buffer in bytes, a multiple of the header slot size */
+	volatile uintptr_t _recordsReserved; /**< running count of bytes reserved by producers */
+	volatile uintptr_t _recordsWritten; /**< running count of bytes consumed by the I/O thread */
+	volatile uintptr_t _droppedRecords; /**< number of records dropped because the ring buffer was full */
+	uintptr_t _reportedDroppedRecords; /**< number of dropped records already reported in the log */
+
+	omrthread_monitor_t _ioMonitor; /**< monitor used to wake the I/O thread and to wait for it to drain */
+	omrthread_t _ioThread; /**< the I/O thread */
+	volatile IOThreadState _ioThreadState; /**< state of the I/O thread */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+	virtual void flushStream(MM_EnvironmentBase *env) { waitForRecordsWritten(env); }
+
+	/**
+	 * @return number of records dropped because the ring buffer was full
+	 */
+	MMINLINE uintptr_t getDroppedRecords() { return _droppedRecords; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool appendRecord(MM_EnvironmentBase *env, uintptr_t kind, const char *string, uintptr_t length);
+	void writeRecords(MM_EnvironmentBase *env);
+	void writeText(MM_EnvironmentBase *env, const char *string, uintptr_t length);
+	void reportDroppedRecords(MM_EnvironmentBase *env);
+	void waitForRecordsWritten(MM_EnvironmentBase *env);
+
+	bool startIOThread(MM_EnvironmentBase *env);
+	void shutdownIOThread(MM_EnvironmentBase *env);
+	void ioThreadEntryPoint();
+	static int J9THREAD_PROC io_thread_proc(void *info);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file in the compact binary format
+ * described in VerboseBinaryFormat.hpp.
+ *
+ * Each string written is tokenised into one length prefixed record; element and attribute
+ * names and short attribute values are interned in per file dictionaries, and numeric and
+ * timestamp attribute values are stored as varints. MM_VerboseBinaryXMLConverter turns a
+ * binary log back into exactly the XML the synchronous writer would have produced.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	intptr_t _logFileDescriptor; /**< the file being written to */
+	MM_VerboseBinaryEncoder _encoder; /**< encoder state for the current file */
+	uint8_t *_encodeBuffer; /**< records are encoded here before being written */
+	uintptr_t _encodeBufferSize; /**< size of _encodeBuffer in bytes */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Encode text as one record and write it to the current file.
+	 */
+	void writeRecord(MM_EnvironmentBase *env, const char *text, uintptr_t length);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -30,6 +30,8 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "OMRVMThreadListIterator.hpp"
+#include "ParallelDispatcher.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -50,6 +52,7 @@ static void verboseHandlerAcquiredExclusiveToSatisfyAllocation(J9HookInterface**
 static void verboseHandlerMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerExcessiveGCRaised(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerAllocationSitesSampled(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 static void verboseHandlerCompactStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
@@ -158,6 +161,9 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, OMR_GET_CALLSITE(), this);
+
+	/* Allocation-site sampling */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_ALLOCATION_SITES_SAMPLED, verboseHandlerAllocationSitesSampled, OMR_GET_CALLSITE(), (void *)this);
 }
 
 void
@@ -217,6 +223,9 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, NULL);
+
+	/* Allocation-site sampling */
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_ALLOCATION_SITES_SAMPLED, verboseHandlerAllocationSitesSampled, NULL);
 }
 
 const char *
@@ -280,6 +289,26 @@ MM_VerboseHandlerOutputStandard::handleGCOPStanza(MM_EnvironmentBase* env, const
 	writer->flush(env);
 }
 
+void
+MM_VerboseHandlerOutputStandard::outputWorkStealingThreadStats(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	uintptr_t activeThreads = env->getExtensions()->dispatcher->activeThreadCount();
+
+	/* the stats of each thread which marked are left in its environment until its next collection */
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	OMR_VMThread *walkThread = NULL;
+	while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(walkThread);
+		uintptr_t workerID = walkEnv->getWorkerID();
+		if ((walkEnv == env) || ((GC_WORKER_THREAD == walkEnv->getThreadType()) && (0 != workerID) && (workerID < activeThreads))) {
+			MM_WorkPacketStats *workPacketStats = &walkEnv->_workPacketStats;
+			writer->formatAndOutput(env, 1, "<work-stealing thread=\"%zu\" stealattempts=\"%zu\" steals=\"%zu\" idle=\"%zu\" />",
+					workerID, workPacketStats->_stealAttempts, workPacketStats->_stealCount, workPacketStats->_idleCount);
+		}
+	}
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
 {
@@ -295,8 +324,26 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "mark", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
-	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
-			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if (extensions->workStealingMarking) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" stealattempts=\"%zu\" steals=\"%zu\" idle=\"%zu\" />",
+				markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned,
+				workPacketStats->_stealAttempts, workPacketStats->_stealCount, workPacketStats->_idleCount);
+		outputWorkStealingThreadStats(env);
+	} else {
+		writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
+				markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	}
+	uintptr_t affinityLeaderCount = extensions->_numaManager.getAffinityLeaderCount();
+	if (extensions->numaAwareParallelGC && (1 < affinityLeaderCount)) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<numa-packet-info nodes=\"%zu\" mainnode=\"%zu\" localpops=\"%zu\" remotepops=\"%zu\" />",
+				affinityLeaderCount, env->getNumaNode(), workPacketStats->_nodeLocalPops, workPacketStats->_nodeRemotePops);
+	}
+	if (0 != extensions->markingPrefetchDepth) {
+		writer->formatAndOutput(env, 1, "<prefetch-info depth=\"%zu\" slotsprefetched=\"%zu\" slotsdrained=\"%zu\" />",
+				extensions->markingPrefetchDepth, markStats->_slotsPrefetched, markStats->_slotsDrained);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -322,9 +369,26 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
-
-	handleSweepEndInternal(env, eventData);
+	if (0 != sweepStats->_lazySweepChunks) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		writer->formatAndOutput(env, 1, "<lazy-sweep-info chunks=\"%zu\" deferred=\"%zu\" />",
+				sweepStats->_lazySweepChunks, sweepStats->_lazySweepChunksDeferred);
+		handleSweepEndInternal(env, eventData);
+		handleGCOPOuterStanzaEnd(env);
+		writer->flush(env);
+	} else if (0 != sweepStats->_sweepIncrements) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		writer->formatAndOutput(env, 1, "<sweep-increment-info budgetus=\"%zu\" increments=\"%zu\" overbudget=\"%zu\" regionsreturned=\"%zu\" />",
+				extensions->sweepIncrementMicro, sweepStats->_sweepIncrements, sweepStats->_sweepIncrementsOverBudget, sweepStats->_sweepRegionsReturned);
+		handleSweepEndInternal(env, eventData);
+		handleGCOPOuterStanzaEnd(env);
+		writer->flush(env);
+	} else {
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		handleSweepEndInternal(env, eventData);
+	}
 	exitAtomicReportingBlock();
 }
 
@@ -362,7 +426,8 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
 	MM_VerboseManager* manager = getManager();
 	MM_VerboseWriterChain* writer = manager->getWriterChain();
-	MM_CompactStats *compactStats = &MM_GCExtensionsBase::getExtensions(env->getOmrVM())->globalGCStats.compactStats;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_CompactStats *compactStats = &extensions->globalGCStats.compactStats;
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, compactStats->_startTime, compactStats->_endTime);
 
@@ -372,6 +437,11 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (0 != compactStats->_incrementalSubAreas) {
+			writer->formatAndOutput(env, 1, "<compact-incremental subareas=\"%zu\" compacted=\"%zu\" dense=\"%zu\" threshold=\"%zu\" leastgarbage=\"%zu\" />",
+					compactStats->_incrementalSubAreas, compactStats->_incrementalCompactedSubAreas, compactStats->_incrementalDenseSubAreas,
+					extensions->incrementalCompactionGarbageThreshold, compactStats->_incrementalLeastGarbage);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -430,6 +500,10 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (0 != extensions->scavengerHotFieldCoLocation) {
+		writer->formatAndOutput(env, 1, "<hot-field-colocation limit=\"%zu\" sampledobjects=\"%zu\" colocated=\"%zu\" />",
+				extensions->scavengerHotFieldCoLocation, scavengerStats->_hotFieldSampledObjects, scavengerStats->_hotFieldCoLocatedCount);
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -444,6 +518,10 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 			writer->formatAndOutput(env, 1, "<warning details=\"remembered set overflow triggered\" />");
 		}
 	}
+	if (extensions->scavengerRememberedSetOverflowCards && ((0 != scavengerStats->_rememberedSetOverflowCardsWalked) || (0 != scavengerStats->_rememberedSetOverflowHeapWalks))) {
+		writer->formatAndOutput(env, 1, "<remembered-set-overflow cardswalked=\"%zu\" heapwalks=\"%zu\" />",
+				scavengerStats->_rememberedSetOverflowCardsWalked, scavengerStats->_rememberedSetOverflowHeapWalks);
+	}
 	if(scavengerStats->_scanCacheOverflow) {
 		writer->formatAndOutput(env, 1, "<warning details=\"scan cache overflow (new chunk allocation acquired durationms=%zu, fromHeap=%s)\" />", scavengerStats->_scanCacheAllocationDurationDuringSavenger, (0 != scavengerStats->_scanCacheAllocationFromHeap)?"true":"false");
 	}
@@ -678,6 +756,9 @@ MM_VerboseHandlerOutputStandard::handleConcurrentKickoff(J9HookInterface** hook,
 				env, 1, "<kickoff reason=\"%s\" targetBytes=\"%zu\" thresholdFreeBytes=\"%zu\" remainingFree=\"%zu\" tenureFreeBytes=\"%zu\" />",
 				reasonString, event->traceTarget, event->kickOffThreshold, event->remainingFree, event->commonData->tenureFreeBytes);
 	}
+	if (0 < event->conHelpersStarted) {
+		writer->formatAndOutput(env, 1, "<helpers active=\"%zu\" started=\"%zu\" />", event->conHelpersActive, event->conHelpersStarted);
+	}
 	writer->formatAndOutput(env, 0, "</concurrent-kickoff>");
 	writer->flush(env);
 
@@ -1149,3 +1230,9 @@ verboseHandlerExcessiveGCRaised(J9HookInterface** hook, uintptr_t eventNum, void
 {
 	((MM_VerboseHandlerOutput *)userData)->handleExcessiveGCRaised(hook, eventNum, eventData);
 }
+
+void
+verboseHandlerAllocationSitesSampled(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput *)userData)->handleAllocationSitesSampled(hook, eventNum, eventData);
+}
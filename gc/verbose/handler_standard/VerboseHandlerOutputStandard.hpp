@@ -61,6 +61,12 @@ protected:
 
 	void handleGCOPStanza(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess);
 
+	/**
+	 * Output the work stealing statistics of each GC thread which took part in the mark phase.
+	 * @param env[in] the thread reporting the mark end
+	 */
+	void outputWorkStealingThreadStats(MM_EnvironmentBase *env);
+
 	virtual bool hasOutputMemoryInfoInnerStanza();
 	virtual void outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
@@ -215,6 +215,10 @@ typedef struct J9MemorySegmentList {
 
 #if defined(OMR_GC_REALTIME)
 
+#if !defined(J9GC_REMEMBERED_SET_RESERVED_INDEX)
+#define J9GC_REMEMBERED_SET_RESERVED_INDEX 0
+#endif /* !defined(J9GC_REMEMBERED_SET_RESERVED_INDEX) */
+
 typedef struct MM_GCRememberedSet {
 	uintptr_t globalFragmentIndex;
 	uintptr_t preservedGlobalFragmentIndex;
@@ -244,6 +244,13 @@ struct ModronLnrlOptions {
 #define MMINLINE_DEBUG inline
 #endif /* OMR_OS_WINDOWS */
 
+/* Hint that the cache line holding addr will shortly be read. No-op where the compiler has no prefetch builtin. */
+#if defined(__GNUC__)
+#define MM_PREFETCH_READ(addr) __builtin_prefetch((const void *)(addr), 0, 3)
+#else /* defined(__GNUC__) */
+#define MM_PREFETCH_READ(addr) ((void)(addr))
+#endif /* defined(__GNUC__) */
+
 /**
  * Lightweight Non-Reentrant Locks (LWNR) Spinlock Support
  * We can't use spinlocks on platforms that do not support semaphores.
@@ -294,7 +301,8 @@ typedef enum {
 	COMPACT_CONTRACT = 11,
 	COMPACT_AGGRESSIVE= 12,
 	COMPACT_PAGE = 13,
-	COMPACT_MICRO_FRAG = 14
+	COMPACT_MICRO_FRAG = 14,
+	COMPACT_INCREMENTAL = 15
 } CompactReason;
 
 typedef enum {
@@ -435,6 +443,7 @@ typedef enum {
 	SATISFY_EXPAND,
 	FORCED_NURSERY_CONTRACT,
 	SOFT_MX_CONTRACT,
+	PAUSE_TIME_GOAL_CONTRACT,
 } ContractReason;
 
 typedef enum {
@@ -447,7 +456,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	THROUGHPUT_GOAL_EXPAND
 } ExpandReason;
 
 typedef enum {
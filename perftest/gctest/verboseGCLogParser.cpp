@@ -25,6 +25,7 @@
 #include <vector>
 #include <iterator>
 #include <numeric>
+#include <string>
 #include <stdio.h>
 
 #include "pugixml.hpp"
@@ -32,6 +33,7 @@
 #include "omr.h"
 #include "omrport.h"
 #include "omrthread.h"
+#include "VerboseBinaryFormat.hpp"
 
 const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
@@ -39,8 +41,10 @@ const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']"
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
+const uintptr_t BINARY_LOG_READ_SIZE = 64 * 1024;
 
 double getAvg(std::vector<double> v);
+pugi::xml_parse_result loadVerboseLog(pugi::xml_document* doc, char* fileName, OMRPortLibrary* portLibrary);
 void analyze(char* fileName, OMRPortLibrary portLibrary);
 
 int main(void)
@@ -102,6 +106,75 @@ getAvg(std::vector<double> v)
 	return avg;
 }
 
+void
+appendVerboseLogText(void* userData, const char* text, uintptr_t length)
+{
+	((std::string*)userData)->append(text, length);
+}
+
+/**
+ * Load a verbose log written either as XML or in the binary format (-Xgc:verboseBinaryFormat).
+ * Binary logs are decoded back to XML a piece at a time, so only the XML text is held in full.
+ */
+pugi::xml_parse_result
+loadVerboseLog(pugi::xml_document* doc, char* fileName, OMRPortLibrary* portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	pugi::xml_parse_result result;
+
+	intptr_t fileDescriptor = omrfile_open(fileName, EsOpenRead, 0444);
+	if (-1 == fileDescriptor) {
+		result.status = pugi::status_file_not_found;
+		return result;
+	}
+
+	uint8_t magic[VERBOSE_BINARY_MAGIC_LENGTH];
+	intptr_t magicRead = omrfile_read(fileDescriptor, magic, VERBOSE_BINARY_MAGIC_LENGTH);
+	if ((0 > magicRead) || !MM_VerboseBinaryDecoder::isBinaryLog(magic, (uintptr_t)magicRead)) {
+		omrfile_close(fileDescriptor);
+		return doc->load_file(fileName);
+	}
+
+	std::string xmlText;
+	MM_VerboseBinaryXMLConverter converter(appendVerboseLogText, &xmlText);
+	MM_VerboseBinaryDecoder decoder(&converter);
+	std::vector<uint8_t> buffer(BINARY_LOG_READ_SIZE);
+	uintptr_t pending = VERBOSE_BINARY_MAGIC_LENGTH;
+	memcpy(&buffer[0], magic, VERBOSE_BINARY_MAGIC_LENGTH);
+
+	result.status = pugi::status_ok;
+	for (;;) {
+		intptr_t consumed = decoder.decode(&buffer[0], pending);
+		if (0 > consumed) {
+			result.status = pugi::status_io_error;
+			break;
+		}
+		pending -= (uintptr_t)consumed;
+		memmove(&buffer[0], &buffer[0] + consumed, pending);
+		if (pending == buffer.size()) {
+			/* a single record is larger than the buffer */
+			buffer.resize(buffer.size() * 2);
+		}
+
+		/* omrfile_read() reports the end of the file as a failure */
+		intptr_t bytesRead = omrfile_read(fileDescriptor, &buffer[pending], (intptr_t)(buffer.size() - pending));
+		if (0 >= bytesRead) {
+			if (0 != pending) {
+				omrtty_printf("Truncated record at the end of binary verbose GC file : %s\n", fileName);
+				result.status = pugi::status_io_error;
+			}
+			break;
+		}
+		pending += (uintptr_t)bytesRead;
+	}
+	omrfile_close(fileDescriptor);
+
+	if (pugi::status_ok == result.status) {
+		result = doc->load_buffer(xmlText.data(), xmlText.length());
+	}
+	return result;
+}
+
 void
 analyze(char* fileName, OMRPortLibrary portLibrary)
 {
@@ -132,7 +205,7 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double avgGCDuration = 0;
 
 	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
+	pugi::xml_parse_result result = loadVerboseLog(&doc, fileName, &portLibrary);
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 	if(!result) {